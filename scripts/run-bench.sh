@@ -0,0 +1,13 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+script_dir="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" &>/dev/null && pwd)"
+project_root="$(cd "${script_dir}/.." && pwd)"
+
+cd "$project_root"
+
+for bench in ./build-release/source/OpenGLTemplate-Core/*_Bench; do
+
+    echo "Running ${bench}..."
+    "${bench}" "$@"
+done
@@ -0,0 +1,24 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+script_dir="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" &>/dev/null && pwd)"
+project_root="$(cd "${script_dir}/.." && pwd)"
+
+cd "$project_root"
+
+# usage: run-startup-bench.sh [RUNS] [APP OPTIONS...]
+runs="${1:-10}"
+shift || true
+
+app=./build-release/source/OpenGLTemplate-App/OpenGLTemplate-App
+times=()
+
+for ((run = 1; run <= runs; ++run)); do
+
+    time_ms="$("${app}" --frames 1 --startup-report "$@" | sed -n 's/^time to first frame: \([0-9.]*\) ms$/\1/p')"
+    echo "run ${run}: ${time_ms} ms to first frame"
+    times+=("${time_ms}")
+done
+
+median="$(printf '%s\n' "${times[@]}" | sort -n | awk '{ value[NR] = $1 } END { print (NR % 2) ? value[(NR + 1) / 2] : (value[NR / 2] + value[NR / 2 + 1]) / 2 }')"
+echo "median: ${median} ms to first frame over ${runs} runs"
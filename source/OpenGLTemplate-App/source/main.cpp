@@ -6,8 +6,14 @@
 // project: cpp-opengl-glfw-glad-cmake
 // file: main.cpp
 ////////////////////////////////////////////////////////////////////////////////
-#include <iostream>
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <random>
+#include <string>
 
 #include <cmath>
 
@@ -15,9 +21,37 @@
 #include <GLFW/glfw3.h>
 
 #include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
-#include "glm/ext/scalar_constants.hpp"
+
+#include "Affine2D.hpp"
+#include "AllocationCounter.hpp"
+#include "BatchRenderer.hpp"
+#include "CameraUniformBlock.hpp"
+#include "DrawList.hpp"
+#include "EntityStore.hpp"
+#include "FrameDamage.hpp"
+#include "FramePacer.hpp"
+#include "GLRenderDevice.hpp"
+#include "GpuTimer.hpp"
+#include "IndexedMesh.hpp"
+#include "InputMap.hpp"
+#include "InstanceBuilder.hpp"
+#include "JobSystem.hpp"
+#include "Logger.hpp"
+#include "MeshLod.hpp"
+#include "MeshPack.hpp"
+#include "MeshRegistry.hpp"
+#include "Models.hpp"
+#include "Profiler.hpp"
+#include "RecordingRenderDevice.hpp"
+#include "RenderThread.hpp"
+#include "ShaderCache.hpp"
+#include "SimulationClock.hpp"
+#include "SpatialIndex.hpp"
+#include "StartupTracer.hpp"
+#include "StreamBuffer.hpp"
+#include "SoftwareRenderDevice.hpp"
+#include "TransformKernels.hpp"
+#include "UniformBuffer.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Application Settings Macros
@@ -26,13 +60,26 @@
 #define SCREEN_WIDTH        1920
 #define WINDOW_TITLE        "Bocan Online C++ OpenGL 2D Demo"
 
-#define MODEL_LENGTH        100   // pixels
-#define CIRCLE_SEGMENTS     150   // number of points (must be divisible by 3)
 #define ROTATION_SPEED       90   // degrees per second
 #define TRANSLATION_SPEED   300   // pixels per second
 #define SCALE_SPEED           1   // percent of scale per second
 
-#define INFOLOG_SIZE        512
+#define STATS_INTERVAL      1.0   // seconds between frame stats reports
+#define PROFILE_TRACE_FILE  "frame_trace.json"  // written when P is pressed
+#define SHADER_CACHE_DIR    "shader_cache"      // linked program binaries
+
+#define PACING_DEFAULT_RATE 60.0  // capped and low-latency rate without --fps-cap or a monitor
+#define IDLE_WAIT_SECONDS   0.5   // longest --idle wait for events before checking again
+
+#define HEADLESS_FRAMES     600   // frames rendered by --headless without --frames
+#define HEADLESS_FRAME_TIME (1.0 / 60.0)    // simulated seconds per headless frame
+
+#define TRAIL_LENGTH        120     // simulation steps of user motion in the trail
+#define STREAM_FRAME_BYTES  65536   // streamed vertex bytes per frame
+
+#ifndef MESH_PACK_PATH                  // set by CMake to the compiled assets/models.txt
+#define MESH_PACK_PATH      "models.bmesh"
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Custom Types for State Management
@@ -64,624 +111,1743 @@ enum class KeyboardInputType {
     Key2,           // Swap to Triangle Model
     Key3,           // Swap to Hexagon Model
     Key4,           // Swap to Circle Model
+    KeyP,           // Export Profiler Trace
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Default Key Bindings
+// --Rebind with action_map.Rebind(action, key). Held actions run every
+//   simulation step while the key is down, pressed actions once per press.
+////////////////////////////////////////////////////////////////////////////////
+struct KeyBinding {
+
+    int key;
+    KeyboardInputType action;
+    Core::ActionTrigger trigger;
+    const char* name;
+};
+
+const KeyBinding default_key_bindings[] = {
+
+    {GLFW_KEY_UP,     KeyboardInputType::KeyUp,          Core::ActionTrigger::Held,    "UP"},
+    {GLFW_KEY_DOWN,   KeyboardInputType::KeyDown,        Core::ActionTrigger::Held,    "DOWN"},
+    {GLFW_KEY_LEFT,   KeyboardInputType::KeyLeft,        Core::ActionTrigger::Held,    "LEFT"},
+    {GLFW_KEY_RIGHT,  KeyboardInputType::KeyRight,       Core::ActionTrigger::Held,    "RIGHT"},
+    {GLFW_KEY_COMMA,  KeyboardInputType::KeyLessThan,    Core::ActionTrigger::Held,    "LESS THAN"},
+    {GLFW_KEY_PERIOD, KeyboardInputType::KeyGreaterThan, Core::ActionTrigger::Held,    "GREATER THAN"},
+    {GLFW_KEY_W,      KeyboardInputType::KeyW,           Core::ActionTrigger::Held,    "W"},
+    {GLFW_KEY_S,      KeyboardInputType::KeyS,           Core::ActionTrigger::Held,    "S"},
+    {GLFW_KEY_A,      KeyboardInputType::KeyA,           Core::ActionTrigger::Held,    "A"},
+    {GLFW_KEY_D,      KeyboardInputType::KeyD,           Core::ActionTrigger::Held,    "D"},
+    {GLFW_KEY_O,      KeyboardInputType::KeyO,           Core::ActionTrigger::Pressed, "O"},
+    {GLFW_KEY_H,      KeyboardInputType::KeyH,           Core::ActionTrigger::Pressed, "H"},
+    {GLFW_KEY_Q,      KeyboardInputType::KeyQ,           Core::ActionTrigger::Held,    "Q"},
+    {GLFW_KEY_E,      KeyboardInputType::KeyE,           Core::ActionTrigger::Held,    "E"},
+    {GLFW_KEY_Z,      KeyboardInputType::KeyZ,           Core::ActionTrigger::Held,    "Z"},
+    {GLFW_KEY_X,      KeyboardInputType::KeyX,           Core::ActionTrigger::Held,    "X"},
+    {GLFW_KEY_R,      KeyboardInputType::KeyR,           Core::ActionTrigger::Pressed, "R"},
+    {GLFW_KEY_G,      KeyboardInputType::KeyG,           Core::ActionTrigger::Pressed, "G"},
+    {GLFW_KEY_B,      KeyboardInputType::KeyB,           Core::ActionTrigger::Pressed, "B"},
+    {GLFW_KEY_SPACE,  KeyboardInputType::KeySpace,       Core::ActionTrigger::Pressed, "SPACE"},
+    {GLFW_KEY_1,      KeyboardInputType::Key1,           Core::ActionTrigger::Pressed, "1"},
+    {GLFW_KEY_2,      KeyboardInputType::Key2,           Core::ActionTrigger::Pressed, "2"},
+    {GLFW_KEY_3,      KeyboardInputType::Key3,           Core::ActionTrigger::Pressed, "3"},
+    {GLFW_KEY_4,      KeyboardInputType::Key4,           Core::ActionTrigger::Pressed, "4"},
+    {GLFW_KEY_P,      KeyboardInputType::KeyP,           Core::ActionTrigger::Pressed, "P"},
+};
+
+enum class UserModel {
+
+    None = 0,
+    Square,
+    Triangle,
+    Hexagon,
+    Circle,
 };
 
-enum class UserModel {
+////////////////////////////////////////////////////////////////////////////////
+// Entity Initialization
+// Scene Entities: 
+// --Environment Object Coordinate Grid (Red X-Axis and Green Y-Axis)
+// --Environment Object (Orange Square)
+// --User/Player Object (Various Colors and Various Models)
+////////////////////////////////////////////////////////////////////////////////
+Core::EntityStore entity_store;      // transforms, colors and meshes of all entities
+
+Core::EntityHandle x_axis_entity;
+Core::EntityHandle y_axis_entity;
+Core::EntityHandle env_entity;
+Core::EntityHandle usr_entity;
+
+////////////////////////////////////////////////////////////////////////////////
+// Render Device
+// --Every draw, bind and upload goes through render_device: the GL 3.3
+//   backend normally, or the recording backend with --headless, which needs
+//   no window or GPU and keeps the submitted command stream in memory.
+// --With --software the headless device also rasterizes every frame on the
+//   CPU, and --capture writes the last frame to an image file.
+// --The GL backend loads linked programs from shader_cache when the driver
+//   matches, and compiles them in the background while models are set up.
+////////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<Core::RenderDevice> render_device;
+Core::SoftwareRenderDevice* software_device = nullptr;  // render_device with --software
+Core::ShaderCache shader_cache;         // program binaries by source and driver
+bool use_shader_cache = true;
+
+Core::ProgramId line_program{};         // per-entity path
+Core::ProgramId instanced_program{};    // batched path
+
+constexpr Core::NameHash U_MODEL_MAT  = Core::HashName("u_Model_mat");
+constexpr Core::NameHash U_COLOR_VEC  = Core::HashName("u_Color_vec");
+constexpr Core::NameHash U_POSITION_EXTENT = Core::HashName("u_Position_extent");
+constexpr Core::NameHash CAMERA_BLOCK = Core::HashName("Camera");
+
+Core::CameraUniformBlock camera_block;  // CPU copy of proj_mat and view_mat
+Core::UniformBuffer camera_ubo;         // uploaded at most once per frame
+
+Core::MeshRegistry mesh_registry;   // one shared vertex buffer and vertex array
+Core::MeshPack mesh_pack;           // mapped model geometry, loaded into mesh_registry
+
+Core::MeshId x_axis_mesh{};         // range of the x-axis model
+Core::MeshId y_axis_mesh{};         // range of the y-axis model
+Core::MeshId square_mesh{};         // range of the square model
+Core::MeshId triangle_mesh{};       // range of the triangle model
+Core::MeshId hexagon_mesh{};        // range of the hexagon model
+Core::MeshId circle_mesh{};         // range of the circle model
+
+std::vector<Core::MeshId> stress_meshes;    // the user models plus any other pack meshes
+
+Core::MeshLod mesh_lod;             // circle tessellations chosen by size on screen
+
+const Core::Color usr_color_vec    = {1.0f, 1.0f,  1.0f, 1.0f};
+const Core::Color x_axis_color_vec = {1.0f, 0.0f,  0.0f, 1.0f};
+const Core::Color y_axis_color_vec = {0.0f, 1.0f,  0.0f, 1.0f};
+const Core::Color env_color_vec    = {1.0f, 0.65f, 0.0f, 1.0f};
+const Core::Color trail_color_vec  = {0.5f, 0.5f,  0.5f, 1.0f};
+
+Core::Affine2D view_mat;            // view transform for single camera
+Core::Affine2D previous_view_mat;   // view transform of the previous sim step
+Core::Affine2D proj_mat;            // orthographic projection transform
+
+////////////////////////////////////////////////////////////////////////////////
+// Keyboard Input
+// --Key callbacks update input_state; it is snapshotted once per frame and
+//   only keys that are down or changed are dispatched through action_map.
+////////////////////////////////////////////////////////////////////////////////
+Core::InputState input_state;
+Core::ActionMap action_map;
+
+////////////////////////////////////////////////////////////////////////////////
+// Fixed Timestep Simulation
+// --Input and motion advance in fixed steps of the simulation clock, at a
+//   rate independent of rendering (--tick-rate HZ).
+// --Rendering interpolates between the last two steps by Alpha().
+////////////////////////////////////////////////////////////////////////////////
+Core::SimulationClock simulation_clock;
+
+////////////////////////////////////////////////////////////////////////////////
+// Frame Pacing
+// --frame_pacer decides when each frame starts and presents (--pacing MODE):
+//   vsync (default), uncapped, capped at --fps-cap HZ, or low-latency, which
+//   starts each frame as late as its work allows so input is sampled late.
+// --Input-to-present latency and present jitter are reported with the
+//   frame stats.
+////////////////////////////////////////////////////////////////////////////////
+Core::FramePacer frame_pacer;
+
+////////////////////////////////////////////////////////////////////////////////
+// Damage Tracking
+// --Whatever changes the camera, an entity, the window or the meshes marks
+//   frame_damage; with --idle a frame that would repeat the last one is
+//   skipped and the loop waits for events instead of spinning.
+// --view_proj_cache keeps proj * view between frames of a still camera.
+////////////////////////////////////////////////////////////////////////////////
+Core::FrameDamage frame_damage;
+Core::ViewProjectionCache view_proj_cache;
+bool idle_rendering = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Batch Rendering and Stress Mode
+// --Batched path draws every instance of a mesh with one instanced call.
+// --Stress entities are spawned with --stress N to compare both paths.
+// --The batched path transforms, culls and fills instances on every worker;
+//   render device calls stay on this (the context) thread.
+////////////////////////////////////////////////////////////////////////////////
+bool use_batch_renderer = true;
+
+Core::BatchRenderer batch_renderer;
+Core::InstanceBuilder instance_builder;
+
+////////////////////////////////////////////////////////////////////////////////
+// Per-Entity Draw Order
+// --The per-entity path collects its draws in the packet's DrawList, sorted
+//   by program, mesh and color so submitting it skips redundant binds and
+//   uniform uploads (--no-draw-sort submits in entity order).
+// --The user entity goes on a layer of its own, so it stays on top.
+////////////////////////////////////////////////////////////////////////////////
+bool sort_draws = true;
+
+std::unique_ptr<Core::JobSystem> job_system;    // created once --threads is known
+
+////////////////////////////////////////////////////////////////////////////////
+// View Culling
+// --spatial_index holds every entity's bounding circle by entity slot, so
+//   each frame only the entities near the camera's visible rectangle are
+//   transformed and drawn (--no-spatial-index draws through all of them).
+// --Only the user entity moves; its bounds are refreshed once per frame.
+////////////////////////////////////////////////////////////////////////////////
+bool use_spatial_index = true;
+
+Core::SpatialIndex spatial_index;
+std::vector<std::uint32_t> visible_slots;       // query result, entity slots
+std::vector<std::uint32_t> visible_entities;    // dense indices, ascending
+
+////////////////////////////////////////////////////////////////////////////////
+// Streamed Geometry
+// --Geometry rebuilt every frame (the user entity's motion trail) is written
+//   straight into stream_buffer and drawn from it in the same frame.
+// --stream_vertex_array reads float positions from the stream through a
+//   static 0, 1, 2... index buffer; base_vertex picks the frame's range.
+////////////////////////////////////////////////////////////////////////////////
+Core::StreamBuffer stream_buffer;
+Core::BufferId stream_index_buffer{};
+Core::VertexArrayId stream_vertex_array{};
+
+std::vector<float> trail_points;    // x, y of the user entity per step, oldest first
+
+std::size_t frame_culled{};         // entities culled by the last OnRender
+
+unsigned int frame_draw_calls{};    // draw calls of the last collected frame
+std::size_t frame_state_changes{};  // state changes of the last collected frame
+std::size_t frame_skipped_state{};  // redundant binds and uniforms its draw list skipped
+double frame_cpu_time{};            // build plus submit seconds of it, before swap
+
+double stats_cpu_time{};            // summed since the last frame stats report
+unsigned int stats_frames{};
+Core::AllocationStats stats_allocations;    // heap totals at the last report
+
+Core::RenderDeviceStats run_device_stats;   // summed over every rendered frame
+double run_cpu_time{};
+
+////////////////////////////////////////////////////////////////////////////////
+// Render Thread
+// --This thread polls input, simulates and builds an immutable RenderPacket
+//   per frame; render_thread owns the context and submits the packets, so
+//   frame N is drawn while frame N + 1 is simulated (--no-render-thread
+//   submits each packet right away on this thread instead).
+// --Render device, stream buffer, camera buffer and GPU timer calls are
+//   made on the render thread only; results come back in the packet.
+// --Resolving mesh LODs grows the registry the render thread draws from, so
+//   it is drained first; the next packet uploads the new meshes.
+// --The software device rasterizes on render_job_system: the per-frame join
+//   of job_system belongs to this thread.
+////////////////////////////////////////////////////////////////////////////////
+bool use_render_thread = true;
+
+Core::RenderThread render_thread;
+std::unique_ptr<Core::JobSystem> render_job_system;     // with --software and the thread
+
+std::uint64_t frames_built = 0;     // packets built, resize redraws included
+bool meshes_changed = false;        // LODs resolved since the last packet
+
+bool viewport_changed = false;      // resized since the last packet
+int viewport_width = SCREEN_WIDTH;
+int viewport_height = SCREEN_HEIGHT;
+
+////////////////////////////////////////////////////////////////////////////////
+// Frame Profiler
+// --PROFILE_SCOPE records CPU scopes on every thread; gpu_timer reads GPU
+//   frame time back a few frames late and is a no-op without timer queries.
+// --Press P to write a chrome://tracing file of the recent frames.
+////////////////////////////////////////////////////////////////////////////////
+Core::GpuTimer gpu_timer;
+
+////////////////////////////////////////////////////////////////////////////////
+// Startup Timeline
+// --startup_tracer times each init phase up to the first finished frame;
+//   --startup-report prints the timeline when the app exits.
+// --Setting up models needs no context, so it runs as a job while this
+//   thread creates the window, context and shader programs.
+////////////////////////////////////////////////////////////////////////////////
+Core::StartupTracer startup_tracer;
+bool startup_report = false;
+std::size_t first_frame_phase = 0;  // ended by the render thread
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+// --Limited abstraction of OpenGL functions. This is a deliberate choice.
+////////////////////////////////////////////////////////////////////////////////
+void OnKey(GLFWwindow* window, int key, int scancode, int action, int mods);
+void OnAction(GLFWwindow* window, KeyboardInputType action, float delta_time);
+void BindDefaultActions();
+void OnWindowResize(GLFWwindow* window, int width, int height);
+void OnWindowRefresh(GLFWwindow* window);
+void OnRender(GLFWwindow* window, const Core::FrameTiming& timing);
+void BuildRenderPacket(Core::RenderPacket& packet, const Core::FrameTiming& timing);
+void RenderFrame(GLFWwindow* window, Core::RenderPacket& packet);
+void CollectFrameResults(Core::RenderPacket& packet);
+void UpdateCameraBlock(const Core::CameraBlockData& camera);
+void ExportProfile();
+double NowSeconds();
+
+Core::MeshId RegisterModel(const float* line_vertices, std::size_t float_count);
+Core::MeshId FindOrRegisterModel(const char* name, const float* line_vertices, std::size_t float_count);
+void LoadMeshPack(const std::string& path);
+void SetupModels(const std::string& mesh_pack_path);
+
+Core::MeshId ModelMesh(UserModel model);
+
+void CreateSceneEntities(int stress_count, int fb_width, int fb_height);
+void SpawnStressEntities(int count, int fb_width, int fb_height);
+void UpdateEntityBounds(Core::EntityHandle entity);
+void InitStreamedGeometry();
+void RecordTrail(Core::EntityHandle entity);
+void BuildTrail(Core::EntityHandle entity, float alpha, std::vector<float>& trail);
+void DrawTrail(const std::vector<float>& trail);
+void QueryVisibleEntities(const Core::Affine2D& view_proj);
+
+void ResetCamera();
+void RotateCamera(KeyboardInputType, float, GLFWwindow*);
+void TranslateCamera(KeyboardInputType, float);
+void ZoomCamera(KeyboardInputType, float);
+
+void ResetModel(Core::EntityHandle);
+void RotateModel(Core::EntityHandle, KeyboardInputType, float);
+void TranslateModel(Core::EntityHandle, KeyboardInputType, float);
+void ScaleModel(Core::EntityHandle, KeyboardInputType, float);
+void ColorModel(Core::EntityHandle, KeyboardInputType);
+void SwapModel(Core::EntityHandle, KeyboardInputType);
+
+////////////////////////////////////////////////////////////////////////////////
+// Vertex Shader Source Code
+////////////////////////////////////////////////////////////////////////////////
+constexpr auto vertex_shader_source = R"(
+    
+    #version 330 core
+
+    layout (location = 0) in vec2 a_Position;   // normalized int16
+
+    layout (std140) uniform Camera {
+
+        mat4 u_Proj_mat;
+        mat4 u_View_mat;
+    };
+
+    uniform mat4 u_Model_mat;
+    uniform float u_Position_extent;
+
+    void main() {
+
+        vec4 position = vec4(a_Position * u_Position_extent, 0.0, 1.0);
+        gl_Position = u_Proj_mat * u_View_mat * u_Model_mat * position;
+    }
+)";
+
+////////////////////////////////////////////////////////////////////////////////
+// Fragment Shader Source Code
+////////////////////////////////////////////////////////////////////////////////
+constexpr auto fragment_shader_source = R"(
+
+    #version 330 core
+
+    out vec4 FragColor;
+
+    uniform vec4 u_Color_vec;
+
+    void main() {
+
+        FragColor = u_Color_vec;
+    }
+)";
+
+////////////////////////////////////////////////////////////////////////////////
+// Instanced Vertex Shader Source Code
+// --Per-instance 2D affine transform (locations 1-3) and color (location 4).
+// --The transform already includes view and projection (see TransformBatch).
+////////////////////////////////////////////////////////////////////////////////
+constexpr auto instanced_vertex_shader_source = R"(
+    
+    #version 330 core
+
+    layout (location = 0) in vec2 a_Position;   // normalized int16
+    layout (location = 1) in vec2 a_Transform_x;
+    layout (location = 2) in vec2 a_Transform_y;
+    layout (location = 3) in vec2 a_Transform_t;
+    layout (location = 4) in vec4 a_Color_vec;
+
+    uniform float u_Position_extent;
+
+    out vec4 v_Color_vec;
+
+    void main() {
+
+        vec2 position = a_Position * u_Position_extent;
+
+        v_Color_vec = a_Color_vec;
+        gl_Position = vec4(a_Transform_x * position.x + a_Transform_y * position.y
+                           + a_Transform_t, 0.0, 1.0);
+    }
+)";
+
+////////////////////////////////////////////////////////////////////////////////
+// Instanced Fragment Shader Source Code
+////////////////////////////////////////////////////////////////////////////////
+constexpr auto instanced_fragment_shader_source = R"(
+
+    #version 330 core
+
+    in vec4 v_Color_vec;
+
+    out vec4 FragColor;
+
+    void main() {
+
+        FragColor = v_Color_vec;
+    }
+)";
+
+int main(int argc, char** argv) {
+
+////////////////////////////////////////////////////////////////////////////////
+// Parse Command Line Arguments
+// --stress N           spawn N extra entities
+// --per-entity-draw    use one Draw() call per entity instead of batching
+// --no-draw-sort       submit per-entity draws in entity order, unsorted
+// --no-spatial-index   test every entity against the view instead of querying
+// --threads N          total threads for frame jobs, including this one
+// --tick-rate HZ       fixed simulation steps per second
+// --headless           no window or GPU, render into the recording device
+// --frames N           exit after N frames
+// --software           headless, rasterized on the CPU by the software device
+// --capture PATH       with --software, write the last frame to PATH (.png/.ppm)
+// --meshes PATH        mesh pack to load instead of the one built with the app
+// --no-shader-cache    always compile shaders from source
+// --startup-report     print the time of each init phase and to first frame
+// --pacing MODE        vsync, uncapped, capped or low-latency
+// --fps-cap HZ         frame rate of capped and low-latency pacing
+// --no-render-thread   submit each frame on this thread, after building it
+// --idle               only render frames in which something changed
+////////////////////////////////////////////////////////////////////////////////
+    int stress_count = 0;
+    unsigned int worker_count = Core::JobSystem::DefaultWorkerCount();
+
+    bool headless = false;
+    long long frame_limit = 0;      // 0 runs until the window closes
+
+    bool software = false;
+    std::string capture_path;
+
+    std::string mesh_pack_path = MESH_PACK_PATH;
+
+    Core::PacingMode pacing_mode = Core::PacingMode::VSync;
+    double pacing_rate = 0.0;       // 0 follows the monitor
+
+    for (int i = 1; i < argc; ++i) {
+
+        std::string arg = argv[i];
+
+        if (arg == "--stress" && i + 1 < argc) {
+
+            stress_count = std::stoi(argv[++i]);
+        }
+        else if (arg == "--per-entity-draw") {
+
+            use_batch_renderer = false;
+        }
+        else if (arg == "--no-draw-sort") {
+
+            sort_draws = false;
+        }
+        else if (arg == "--no-spatial-index") {
+
+            use_spatial_index = false;
+        }
+        else if (arg == "--threads" && i + 1 < argc) {
+
+            worker_count = static_cast<unsigned int>(std::max(std::stoi(argv[++i]) - 1, 0));
+        }
+        else if (arg == "--tick-rate" && i + 1 < argc) {
+
+            simulation_clock.SetTickRate(std::max(std::stod(argv[++i]), 1.0));
+        }
+        else if (arg == "--headless") {
+
+            headless = true;
+        }
+        else if (arg == "--frames" && i + 1 < argc) {
+
+            frame_limit = std::max(std::stoll(argv[++i]), 0LL);
+        }
+        else if (arg == "--software") {
+
+            headless = true;
+            software = true;
+        }
+        else if (arg == "--capture" && i + 1 < argc) {
+
+            capture_path = argv[++i];
+        }
+        else if (arg == "--meshes" && i + 1 < argc) {
+
+            mesh_pack_path = argv[++i];
+        }
+        else if (arg == "--no-shader-cache") {
+
+            use_shader_cache = false;
+        }
+        else if (arg == "--startup-report") {
+
+            startup_report = true;
+        }
+        else if (arg == "--pacing" && i + 1 < argc) {
+
+            if (!Core::ParsePacingMode(argv[++i], pacing_mode)) {
+
+                LOG_WARN("Unknown pacing mode: %s", argv[i]);
+            }
+        }
+        else if (arg == "--fps-cap" && i + 1 < argc) {
+
+            pacing_rate = std::max(std::stod(argv[++i]), 1.0);
+        }
+        else if (arg == "--no-render-thread") {
+
+            use_render_thread = false;
+        }
+        else if (arg == "--idle") {
+
+            idle_rendering = true;
+        }
+        else {
+
+            LOG_WARN("Unknown argument: %s", arg.c_str());
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Start Job System Workers and Set Up Models
+// --Models are registered on a worker while the window, context and shader
+//   programs are created below; they are waited for just before upload.
+// --With --threads 1 the job runs on this thread when it is waited for.
+////////////////////////////////////////////////////////////////////////////////
+    job_system = std::make_unique<Core::JobSystem>(worker_count);
+
+    LOG_INFO("Job System:\t%u workers", job_system->WorkerCount());
+
+    // by value: an early exit below must not leave the job a dangling path
+    const Core::JobHandle models_job = job_system->Schedule([mesh_pack_path]() {
+
+        SetupModels(mesh_pack_path);
+    });
+
+////////////////////////////////////////////////////////////////////////////////
+// Initialize Graphical User Interface Window Using GLFW
+// --Skipped with --headless: there is no window, context or GPU at all.
+////////////////////////////////////////////////////////////////////////////////
+    GLFWwindow* window = nullptr;
+    std::size_t startup_phase = 0;
+
+    if (headless && frame_limit == 0) {
+
+        frame_limit = HEADLESS_FRAMES;
+    }
+
+    if (!headless) {
+
+        startup_phase = startup_tracer.Begin("glfw init");
+
+        if (!glfwInit()) {
+
+            LOG_ERROR("Failed to initialize GLFW");
+            job_system->Wait(models_job);
+            return -1;
+        }
+
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#ifdef __APPLE__
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+        startup_tracer.End(startup_phase);
+        startup_phase = startup_tracer.Begin("window");
+
+        window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT,
+                                  WINDOW_TITLE, NULL, NULL);
+
+        if (!window) {
+        
+            LOG_ERROR("Failed to create GLFW window");
+            job_system->Wait(models_job);
+            glfwTerminate();
+            return -1;
+        }
+
+        glfwMakeContextCurrent(window);
+    
+        float x_scale;
+        float y_scale;
+    
+        glfwGetWindowContentScale(window, &x_scale, &y_scale);
+        glfwSetWindowSize(window, SCREEN_WIDTH/x_scale, SCREEN_HEIGHT/y_scale);
+        glfwSetWindowSizeLimits(window,  640/x_scale,  360/y_scale, 
+                                        3024/x_scale, 1964/y_scale);
+
+        startup_tracer.End(startup_phase);
+
+////////////////////////////////////////////////////////////////////////////////
+// Initialize and Load OpenGL Functions with GLAD
+////////////////////////////////////////////////////////////////////////////////
+        startup_phase = startup_tracer.Begin("glad");
+
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+
+            LOG_ERROR("Failed to initialize GLAD");
+            job_system->Wait(models_job);
+            glfwTerminate();
+            return -1;
+        }
+
+        startup_tracer.End(startup_phase);
+        startup_phase = startup_tracer.Begin("render device");
+
+        auto device = std::make_unique<Core::GLRenderDevice>();
+
+        if (use_shader_cache) {
+
+            shader_cache.SetDirectory(SHADER_CACHE_DIR);
+            device->SetShaderCache(&shader_cache);
+        }
+
+        render_device = std::move(device);
+    }
+    else if (software) {
+
+        startup_phase = startup_tracer.Begin("render device");
+
+        // tile-parallel rasterization
+        auto device = std::make_unique<Core::SoftwareRenderDevice>(SCREEN_WIDTH, SCREEN_HEIGHT,
+                                                                   job_system.get());
+        software_device = device.get();
+        render_device = std::move(device);
+    }
+    else {
+
+        startup_phase = startup_tracer.Begin("render device");
+        render_device = std::make_unique<Core::RecordingRenderDevice>();
+    }
+
+    startup_tracer.End(startup_phase);
+
+    LOG_INFO("Render Device:\t%s", render_device->Name());
+
+////////////////////////////////////////////////////////////////////////////////
+// Configure Frame Pacing
+// --Without --fps-cap, capped and low-latency pacing run at the refresh
+//   rate of the primary monitor.
+////////////////////////////////////////////////////////////////////////////////
+    if (pacing_rate <= 0.0) {
+
+        pacing_rate = PACING_DEFAULT_RATE;
+
+        const GLFWvidmode* video_mode = window ? glfwGetVideoMode(glfwGetPrimaryMonitor()) : nullptr;
+
+        if (video_mode && video_mode->refreshRate > 0) {
+
+            pacing_rate = video_mode->refreshRate;
+        }
+    }
+
+    frame_pacer.SetMode(pacing_mode, pacing_rate);
+
+    if (window) {
+
+        glfwSwapInterval(frame_pacer.SwapInterval());
+    }
+
+    LOG_INFO("Frame Pacing:\t%s\t%.1f Hz", Core::PacingModeName(frame_pacer.Mode()), frame_pacer.RateHz());
+
+////////////////////////////////////////////////////////////////////////////////
+// Compile and Link Shader Programs with the Render Device
+// --Programs are only started here; models finish and upload while the driver
+//   compiles, and the first use of each program below waits for it.
+////////////////////////////////////////////////////////////////////////////////
+    const double shader_start_time = NowSeconds();
+
+    startup_phase = startup_tracer.Begin("shader programs");
+
+    line_program = render_device->CreateProgram(vertex_shader_source, fragment_shader_source);
+    instanced_program = render_device->CreateProgram(instanced_vertex_shader_source,
+                                                     instanced_fragment_shader_source);
+
+    startup_tracer.End(startup_phase);
+
+////////////////////////////////////////////////////////////////////////////////
+// Upload Shared Vertex Buffer and Vertex Array
+// --Waits for the models job started above, see SetupModels.
+////////////////////////////////////////////////////////////////////////////////
+    startup_phase = startup_tracer.Begin("wait for models");
+    job_system->Wait(models_job);
+    startup_tracer.End(startup_phase);
+
+    startup_phase = startup_tracer.Begin("mesh upload");
+    mesh_registry.Upload(*render_device);
+
+    startup_tracer.End(startup_phase);
+
+////////////////////////////////////////////////////////////////////////////////
+// Configure Shader Programs
+// --Uniforms and attributes are reflected once, never looked up per draw.
+////////////////////////////////////////////////////////////////////////////////
+    startup_phase = startup_tracer.Begin("configure programs");
+
+    camera_ubo.Create(*render_device, Core::CameraUniformBlock::Size(), CAMERA_BLOCK_BINDING);
+
+    render_device->BindUniformBlock(line_program, CAMERA_BLOCK, camera_ubo.Binding());
+
+    const float position_extent = POSITION_EXTENT;
+
+    render_device->UseProgram(line_program);
+    render_device->SetUniform(U_POSITION_EXTENT, Core::UniformType::Float, &position_extent);
+    render_device->UseProgram(instanced_program);
+    render_device->SetUniform(U_POSITION_EXTENT, Core::UniformType::Float, &position_extent);
+
+    // a rejected binary was a hit that then compiled from source
+    const Core::ShaderCacheStats& shader_stats = shader_cache.Stats();
+
+    LOG_INFO("Shader Programs:\tready %.2f ms after creation\t%zu from cache\t%zu rejected",
+             (NowSeconds() - shader_start_time) * 1e3, shader_stats.hits - shader_stats.rejects,
+             shader_stats.rejects);
+
+    startup_tracer.End(startup_phase);
+
+////////////////////////////////////////////////////////////////////////////////
+// Initialize Batch Renderer
+////////////////////////////////////////////////////////////////////////////////
+    startup_phase = startup_tracer.Begin("batch renderer");
+
+    batch_renderer.Init(*render_device, instanced_program, mesh_registry,
+                        static_cast<std::size_t>(stress_count) + 16);
+
+    startup_tracer.End(startup_phase);
+    startup_phase = startup_tracer.Begin("stream buffer");
+
+    InitStreamedGeometry();
+
+    startup_tracer.End(startup_phase);
+
+    LOG_INFO("Stream Buffer:\t%s\t%d bytes per frame",
+             Core::StreamModeName(stream_buffer.Mode()), STREAM_FRAME_BYTES);
+
+    LOG_INFO("Transform Kernels:\t%s", Core::SimdLevelName(Core::ActiveSimdLevel()));
+
+////////////////////////////////////////////////////////////////////////////////
+// Start GPU Frame Timer
+////////////////////////////////////////////////////////////////////////////////
+    startup_phase = startup_tracer.Begin("gpu timer");
+
+    if (!headless && !gpu_timer.Init(Core::DefaultProfiler())) {
+
+        LOG_WARN("GPU timer queries unavailable, profiling CPU only");
+    }
+
+    startup_tracer.End(startup_phase);
+
+////////////////////////////////////////////////////////////////////////////////
+// Set Scene Initial Conditions
+////////////////////////////////////////////////////////////////////////////////
+    BindDefaultActions();
+  
+    int fb_width = SCREEN_WIDTH;    // framebuffer width
+    int fb_height = SCREEN_HEIGHT;  // framebuffer height
+
+    if (window) {
+
+        glfwSetFramebufferSizeCallback(window, OnWindowResize);
+        glfwSetWindowRefreshCallback(window, OnWindowRefresh);
+        glfwSetKeyCallback(window, OnKey);
+
+        glfwGetFramebufferSize(window, &fb_width, &fb_height);
+
+        LOG_INFO("GLFW Window Ready:\t%d\t%d", fb_width, fb_height);
+    }
+    else {
+
+        LOG_INFO("Headless Ready:\t%d\t%d\t%lld frames", fb_width, fb_height, frame_limit);
+    }
+
+    render_device->SetViewport(0, 0, fb_width, fb_height);
+    mesh_lod.SetViewport(fb_width, fb_height);
+   
+    double last_frame_start_time = NowSeconds();
+    double stats_start_time = NowSeconds();
+
+    startup_phase = startup_tracer.Begin("scene entities");
+    CreateSceneEntities(stress_count, fb_width, fb_height);
+    startup_tracer.End(startup_phase);
+    
+    proj_mat = Core::Affine2D::Ortho(-fb_width/2.0f,   fb_width/2.0f,
+                                     -fb_height/2.0f,  fb_height/2.0f);
+
+////////////////////////////////////////////////////////////////////////////////
+// Start Render Thread
+// --The context is released here and made current on the render thread;
+//   this thread makes no render device calls until it is stopped.
+////////////////////////////////////////////////////////////////////////////////
+    if (use_render_thread && software_device) {
+
+        render_job_system = std::make_unique<Core::JobSystem>(worker_count);
+        software_device->SetJobSystem(render_job_system.get());
+    }
+
+    if (use_render_thread && window) {
+
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    render_thread.Start([window](Core::RenderPacket& packet) {
+
+        RenderFrame(window, packet);
+    },
+    use_render_thread,
+    [window]() {
+
+        if (window) {
+
+            glfwMakeContextCurrent(window);
+        }
+    },
+    [window]() {
+
+        if (window) {
+
+            glfwMakeContextCurrent(nullptr);
+        }
+    });
+
+    LOG_INFO("Render Thread:\t%s\t%zu packets", render_thread.IsThreaded() ? "threaded" : "inline",
+             render_thread.PacketCount());
+
+////////////////////////////////////////////////////////////////////////////////
+// Main Loop
+////////////////////////////////////////////////////////////////////////////////
+    long long frames_rendered = 0;
+    long long frames_skipped = 0;   // --idle frames with nothing to redraw
+
+    first_frame_phase = startup_tracer.Begin("first frame");
+
+    while (window ? !glfwWindowShouldClose(window) : true) {
+
+        if (frame_limit > 0 && frames_rendered + frames_skipped >= frame_limit) {
+
+            break;
+        }
+
+        // nothing to draw: sleep until input, a resize or the timeout
+        if (idle_rendering && window && !frame_damage.NeedsRedraw()) {
+
+            PROFILE_SCOPE("Idle Wait");
+            glfwWaitEventsTimeout(IDLE_WAIT_SECONDS);
+        }
+
+        Core::FrameTiming frame_timing;
+
+        {
+            PROFILE_SCOPE("Pacing");
+            frame_timing = frame_pacer.BeginFrame();    // right before input is sampled
+        }
+
+        double current_frame_start_time = NowSeconds();
+        double frame_time = current_frame_start_time - last_frame_start_time;
+        last_frame_start_time = current_frame_start_time;
+
+        // headless runs step the simulation at a fixed rate so they are repeatable
+        if (headless) {
+
+            frame_time = HEADLESS_FRAME_TIME;
+        }
+
+        Core::DefaultProfiler().MarkFrame();
+
+        {
+            PROFILE_SCOPE("Input");
+
+            if (window) {
+
+                glfwPollEvents();
+            }
+
+            input_state.Snapshot();
+
+            // one-shot actions apply once per press, even on frames without a step
+            action_map.Dispatch(input_state, Core::ActionTrigger::Pressed, [&](Core::ActionId action) {
+
+                OnAction(window, static_cast<KeyboardInputType>(action), 0.0f);
+            });
+        }
+
+        {
+            PROFILE_SCOPE("Simulation");
+
+            const int simulation_steps = simulation_clock.Advance(frame_time);
+            const float step_seconds = static_cast<float>(simulation_clock.StepSeconds());
+
+            for (int step = 0; step < simulation_steps; ++step) {
+
+                entity_store.BeginStep();
+                previous_view_mat = view_mat;
+
+                action_map.Dispatch(input_state, Core::ActionTrigger::Held, [&](Core::ActionId action) {
+
+                    OnAction(window, static_cast<KeyboardInputType>(action), step_seconds);
+                });
+
+                RecordTrail(usr_entity);
+
+                frame_damage.EndStep();
+            }
+        }
+
+        if (idle_rendering && !frame_damage.NeedsRedraw()) {
+
+            frame_pacer.SkipFrame();
+            frames_skipped += 1;
+            continue;
+        }
+
+        UpdateEntityBounds(usr_entity);
+
+        OnRender(window, frame_timing);
+
+        {
+            PROFILE_SCOPE("Frame Join");
+            job_system->WaitAll();      // per-frame join
+        }
+
+        frames_rendered += 1;
+
+        if (current_frame_start_time - stats_start_time >= STATS_INTERVAL && stats_frames > 0) {
+
+            LOG_INFO("Frame Stats:\t%s\t%zu entities\t%zu culled\t%u draw calls\t%zu state changes\t%zu skipped\t%llu ticks\t%.3f ms cpu",
+                     use_batch_renderer ? "batched" : "per-entity",
+                     entity_store.Size(),
+                     frame_culled,
+                     frame_draw_calls,
+                     frame_state_changes,
+                     frame_skipped_state,
+                     static_cast<unsigned long long>(simulation_clock.TickCount()),
+                     1000.0 * stats_cpu_time / stats_frames);
+
+            const Core::FrameTimeStats frame_stats = Core::DefaultProfiler().CpuFrameStats();
+            const Core::FrameTimeStats gpu_stats = Core::DefaultProfiler().GpuFrameStats();
+
+            LOG_INFO("Frame Times:\tp50 %.2f\tp95 %.2f\tp99 %.2f ms\tgpu p50 %.2f\tp99 %.2f ms",
+                     frame_stats.p50_ms, frame_stats.p95_ms, frame_stats.p99_ms,
+                     gpu_stats.p50_ms, gpu_stats.p99_ms);
+
+            const Core::FramePacingStats pacing_stats = frame_pacer.Stats();
+
+            LOG_INFO("Frame Pacing:\t%s\tlatency %.2f ms\tmax %.2f ms\tinterval %.2f ms\tjitter %.2f ms\t%llu missed",
+                     Core::PacingModeName(frame_pacer.Mode()),
+                     pacing_stats.latency_ms, pacing_stats.max_latency_ms,
+                     pacing_stats.interval_ms, pacing_stats.jitter_ms,
+                     static_cast<unsigned long long>(pacing_stats.missed));
+
+            frame_pacer.ResetStats();
+
+            // every thread's heap use, should stay 0 once the scene settles
+            const Core::AllocationStats allocations = Core::AllocationCounts();
+            const Core::AllocationStats allocated = allocations - stats_allocations;
+
+            LOG_INFO("Frame Memory:\t%.1f allocations\t%.0f bytes per frame",
+                     static_cast<double>(allocated.allocations) / stats_frames,
+                     static_cast<double>(allocated.bytes) / stats_frames);
+
+            stats_allocations = allocations;
+            stats_start_time = current_frame_start_time;
+            stats_cpu_time = 0.0;
+            stats_frames = 0;
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Stop Render Thread
+// --Every submitted frame is rendered first; the results of the frames
+//   still in the packets are collected and the context comes back here.
+////////////////////////////////////////////////////////////////////////////////
+    render_thread.Stop();
+
+    for (Core::RenderPacket& packet : render_thread.Packets()) {
+
+        CollectFrameResults(packet);
+    }
+
+    if (use_render_thread && window) {
+
+        glfwMakeContextCurrent(window);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Run Summary
+// --Per-frame averages of the whole run, the numbers to compare between
+//   --headless runs.
+////////////////////////////////////////////////////////////////////////////////
+    if (frames_rendered > 0) {
+
+        const double frames = static_cast<double>(frames_rendered);
+
+        LOG_INFO("Run Summary:\t%s\t%lld frames\t%.3f ms cpu\t%.1f draw calls\t%.1f state changes\t%.0f bytes uploaded",
+                 render_device->Name(),
+                 frames_rendered,
+                 1000.0 * run_cpu_time / frames,
+                 run_device_stats.draw_calls / frames,
+                 run_device_stats.StateChanges() / frames,
+                 run_device_stats.bytes_uploaded / frames);
+
+        if (idle_rendering) {
+
+            LOG_INFO("Idle Frames:\t%lld skipped\t%llu view-projection updates",
+                     frames_skipped,
+                     static_cast<unsigned long long>(view_proj_cache.Recomputes()));
+        }
+
+        LOG_INFO("Render Thread:\t%s\t%llu stalls\t%.3f ms waiting for a packet",
+                 use_render_thread ? "threaded" : "inline",
+                 static_cast<unsigned long long>(render_thread.StallCount()),
+                 1000.0 * render_thread.StallSeconds());
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Capture Last Frame
+////////////////////////////////////////////////////////////////////////////////
+    if (!capture_path.empty()) {
+
+        if (!software_device) {
+
+            LOG_WARN("--capture needs --software, no image written");
+        }
+        else if (software_device->WriteImage(capture_path)) {
+
+            LOG_INFO("Captured Frame:\t%s", capture_path.c_str());
+        }
+        else {
+
+            LOG_ERROR("Failed to write %s", capture_path.c_str());
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Startup Report
+// --Printed after the log is flushed so the table is not interleaved.
+////////////////////////////////////////////////////////////////////////////////
+    if (startup_report) {
+
+        Core::DefaultLogger().Flush();
+        startup_tracer.WriteReport(std::cout);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Delete Objects and Programs, Close Window, Exit Program
+////////////////////////////////////////////////////////////////////////////////
+    if (software_device) {
+
+        software_device->SetJobSystem(nullptr);
+    }
+
+    render_job_system.reset();
+    job_system.reset();
+    gpu_timer.Destroy();
+    batch_renderer.Shutdown();
+
+    stream_buffer.Shutdown();
+    render_device->DestroyVertexArray(stream_vertex_array);
+    render_device->DestroyBuffer(stream_index_buffer);
+
+    mesh_registry.Destroy();
+    camera_ubo.Destroy();
+    render_device->DestroyProgram(line_program);
+    render_device->DestroyProgram(instanced_program);
+    render_device.reset();
+    software_device = nullptr;
+
+    if (window) {
+
+        glfwTerminate(); 
+    }
+
+    return 0;
+}
+
+void OnWindowResize(GLFWwindow* window, int width, int height) {
+
+    LOG_INFO("GLFW Window Resize:\t%d\t%d", width, height);
+    
+    proj_mat = Core::Affine2D::Ortho(-width/2.0f,   width/2.0f,
+                                     -height/2.0f,  height/2.0f);
+
+    // set by the render thread with the next packet
+    viewport_changed = true;
+    viewport_width = width;
+    viewport_height = height;
+
+    mesh_lod.SetViewport(width, height);
+
+    frame_damage.Mark(Core::DamageFlag::Window);
+
+    OnRender(window, frame_pacer.Unpaced());
+}
+
+void OnWindowRefresh(GLFWwindow* window) {
+
+    // exposed after being covered; redrawn by the loop
+    frame_damage.Mark(Core::DamageFlag::Window);
+}
+
+void OnKey(GLFWwindow* window, int key, int scancode, int action, int mods) {
+
+    if (action == GLFW_REPEAT) {
+
+        return;
+    }
+
+    input_state.OnKey(key, action == GLFW_PRESS);
+
+    const Core::ActionId bound_action = action_map.ActionFor(key);
+
+    // logged once per press, not every frame the key is held
+    if (action == GLFW_PRESS && bound_action != 0) {
+
+        for (const KeyBinding& binding : default_key_bindings) {
+
+            if (binding.action == static_cast<KeyboardInputType>(bound_action)) {
+
+                LOG_DEBUG("GLFW Keyboard Input:\t%s", binding.name);
+            }
+        }
+    }
+}
+
+void BindDefaultActions() {
+
+    for (const KeyBinding& binding : default_key_bindings) {
+
+        action_map.Bind(binding.key, static_cast<Core::ActionId>(binding.action), binding.trigger);
+    }
+}
+
+void OnAction(GLFWwindow* window, KeyboardInputType action, float delta_time) {
+
+    switch(action) {
+        case(KeyboardInputType::KeyUp):
+        case(KeyboardInputType::KeyDown):
+            TranslateModel(usr_entity, action, delta_time);
+            break;
+        case(KeyboardInputType::KeyLeft):
+        case(KeyboardInputType::KeyRight):
+            RotateModel(usr_entity, action, delta_time);
+            break;
+        case(KeyboardInputType::KeyLessThan):
+        case(KeyboardInputType::KeyGreaterThan):
+            ScaleModel(usr_entity, action, delta_time);
+            break;
+        case(KeyboardInputType::KeyW):
+        case(KeyboardInputType::KeyS):
+        case(KeyboardInputType::KeyA):
+        case(KeyboardInputType::KeyD):
+            TranslateCamera(action, delta_time);
+            break;
+        case(KeyboardInputType::KeyO):
+            ResetCamera();
+            break;
+        case(KeyboardInputType::KeyH):
+            ResetModel(usr_entity);
+            break;
+        case(KeyboardInputType::KeyQ):
+        case(KeyboardInputType::KeyE):
+            RotateCamera(action, delta_time, window);
+            break;
+        case(KeyboardInputType::KeyZ):
+        case(KeyboardInputType::KeyX):
+            ZoomCamera(action, delta_time);
+            break;
+        case(KeyboardInputType::KeyR):
+        case(KeyboardInputType::KeyG):
+        case(KeyboardInputType::KeyB):
+        case(KeyboardInputType::KeySpace):
+            ColorModel(usr_entity, action);
+            break;
+        case(KeyboardInputType::Key1):
+        case(KeyboardInputType::Key2):
+        case(KeyboardInputType::Key3):
+        case(KeyboardInputType::Key4):
+            SwapModel(usr_entity, action);
+            break;
+        case(KeyboardInputType::KeyP):
+            ExportProfile();
+            break;
+        default:
+            LOG_WARN("Invalid keyboard input.");
+            return;
+    }
+}
+
+void OnRender(GLFWwindow* window, const Core::FrameTiming& timing) {
+
+    PROFILE_SCOPE("OnRender");
+
+    Core::RenderPacket* packet = nullptr;
+
+    {
+        PROFILE_SCOPE("Acquire Packet");
+        packet = &render_thread.Acquire();
+    }
+
+    CollectFrameResults(*packet);
+    BuildRenderPacket(*packet, timing);
+
+    render_thread.Submit(*packet);
+
+    frame_damage.EndFrame();
+
+    // tessellations requested this frame are drawn from the next one on
+    if (mesh_lod.HasRequests()) {
+
+        render_thread.Drain();
+
+        if (const std::size_t built = mesh_lod.Resolve(mesh_registry)) {
+
+            meshes_changed = true;
+            frame_damage.Mark(Core::DamageFlag::Content);
+
+            LOG_DEBUG("Mesh LOD:\t%zu built\t%zu resident", built, mesh_lod.ResidentCount());
+        }
+    }
+}
 
-    None = 0,
-    Square,
-    Triangle,
-    Hexagon,
-    Circle,
-};
+void BuildRenderPacket(Core::RenderPacket& packet, const Core::FrameTiming& timing) {
 
-////////////////////////////////////////////////////////////////////////////////
-// Entity Initialization
-// Scene Entities: 
-// --Environment Object Coordinate Grid (Red X-Axis and Green Y-Axis)
-// --Environment Object (Orange Square)
-// --User/Player Object (Various Colors and Various Models)
-////////////////////////////////////////////////////////////////////////////////
-UserModel active_usr_model = UserModel::Square;
+    PROFILE_SCOPE("Build Packet");
 
-unsigned int shader_program{};
+    const double build_start_time = NowSeconds();
 
-unsigned int vao{};             // vertex array object
+    packet.frame = frames_built++;
+    packet.timing = timing;
 
-unsigned int vbo_x_axis{};      // vertex buffer object x-axis
-unsigned int vbo_y_axis{};      // vertex buffer object y-axis
-unsigned int vbo_square{};      // vertex buffer object square model
-unsigned int vbo_triangle{};    // vertex buffer object triangle model
-unsigned int vbo_hexagon{};     // vertex buffer object hexagon model
-unsigned int vbo_circle{};      // vertex buffer object circle model
+    packet.set_viewport = viewport_changed;
+    packet.viewport_width = viewport_width;
+    packet.viewport_height = viewport_height;
+    viewport_changed = false;
 
-glm::vec4 usr_color_vec    = glm::vec4(1.0f);
-glm::vec4 x_axis_color_vec = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
-glm::vec4 y_axis_color_vec = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
-glm::vec4 env_color_vec    = glm::vec4(1.0f, 0.65f, 0.0f, 1.0f);
+    packet.upload_meshes = meshes_changed;
+    meshes_changed = false;
 
-glm::mat4 mvp_mat = glm::mat4(1.0f);
+    const float alpha = simulation_clock.Alpha();
 
-glm::mat4 xyz_model_mat = glm::mat4(1.0f);  // model matrix for grid objects
-glm::mat4 env_model_mat = glm::mat4(1.0f);  // model matrix for env object
-glm::mat4 usr_model_mat = glm::mat4(1.0f);  // model matrix for user object
+    view_proj_cache.Update(proj_mat, Core::Lerp(previous_view_mat, view_mat, alpha));
 
-glm::mat4 view_mat = glm::mat4(1.0f);       // view matrix for single camera
-glm::mat4 proj_mat = glm::mat4(1.0f);       // orthographic projection matrix
+    proj_mat.ToMat4(packet.camera.proj_mat);
+    view_proj_cache.View().ToMat4(packet.camera.view_mat);
 
-////////////////////////////////////////////////////////////////////////////////
-// Function Declarations
-// --Limited abstraction of OpenGL functions. This is a deliberate choice.
-////////////////////////////////////////////////////////////////////////////////
-void OnKeyboardInput(GLFWwindow* window, float delta_time);
-void OnWindowResize(GLFWwindow* window, int width, int height);
-void OnRender(GLFWwindow* window);
+    const Core::Affine2D& view_proj = view_proj_cache.ViewProjection();
 
-void GenerateCircleVertices();
+    if (use_spatial_index) {
 
-void Draw(unsigned int buffer, glm::mat4 model_mat, glm::vec4 color, int vertices_size);
+        QueryVisibleEntities(view_proj);
+    }
 
-void ResetCamera();
-void RotateCamera(KeyboardInputType, float, GLFWwindow*);
-void TranslateCamera(KeyboardInputType, float);
-void ZoomCamera(KeyboardInputType, float);
+    BuildTrail(usr_entity, alpha, packet.trail);
 
-void ResetModel(GLFWwindow*);
-void RotateModel(KeyboardInputType, float);
-void TranslateModel(KeyboardInputType, float);
-void ScaleModel(KeyboardInputType, float);
-void ColorModel(KeyboardInputType);
-void SwapModel(KeyboardInputType);
+    packet.batched = use_batch_renderer;
+    packet.draws.Clear();
 
-////////////////////////////////////////////////////////////////////////////////
-// Models Source Code (Coordinate Axis, Square, Triangle, Hexagon)
-////////////////////////////////////////////////////////////////////////////////
+    if (use_batch_renderer) {
 
-std::array<float, 6> x_axis_vertices {
+        packet.instances.Reset(mesh_registry.MeshCount());
 
-     -MODEL_LENGTH*10.0f,  0.0f,  0.0f, // left point
-      MODEL_LENGTH*10.0f,  0.0f,  0.0f, // right point
-};
+        instance_builder.Build(*job_system, entity_store, mesh_registry,
+                               view_proj, packet.instances, alpha,
+                               use_spatial_index ? &visible_entities : nullptr);
 
-std::array<float, 6> y_axis_vertices {
+        frame_culled = instance_builder.CulledCount();
+    }
+    else {
 
-     0.0f,  MODEL_LENGTH*7.0f,  0.0f, // top point
-     0.0f, -MODEL_LENGTH*7.0f,  0.0f, // bottom point
-};
+        const Core::MeshId* meshes = entity_store.Meshes();
+        const Core::Color* colors = entity_store.Colors();
 
-std::array<float, 24> square_vertices {
-    
-    -MODEL_LENGTH/2.0f,  MODEL_LENGTH/2.0f,  0.0f, // top-left
-     MODEL_LENGTH/2.0f,  MODEL_LENGTH/2.0f,  0.0f, // top-right
-     MODEL_LENGTH/2.0f,  MODEL_LENGTH/2.0f,  0.0f, // top-right
-     MODEL_LENGTH/2.0f, -MODEL_LENGTH/2.0f,  0.0f, // bottom-right
-     MODEL_LENGTH/2.0f, -MODEL_LENGTH/2.0f,  0.0f, // bottom-right
-    -MODEL_LENGTH/2.0f, -MODEL_LENGTH/2.0f,  0.0f, // bottom-left
-    -MODEL_LENGTH/2.0f, -MODEL_LENGTH/2.0f,  0.0f, // bottom-left
-    -MODEL_LENGTH/2.0f,  MODEL_LENGTH/2.0f,  0.0f, // top-left
-};
+        const std::size_t drawn = use_spatial_index ? visible_entities.size() : entity_store.Size();
+        frame_culled = entity_store.Size() - drawn;
 
-std::array<float, 18> triangle_vertices {
+        const std::uint32_t usr_index = entity_store.IndexOf(usr_entity);
 
-    0.0f,               (-MODEL_LENGTH/2.0f * std::cosf(60)), 0.0f, // top
-   -MODEL_LENGTH/2.0f,  ( MODEL_LENGTH/2.0f * std::cosf(60)), 0.0f, // right
-   -MODEL_LENGTH/2.0f,  ( MODEL_LENGTH/2.0f * std::cosf(60)), 0.0f, // right
-    MODEL_LENGTH/2.0f,  ( MODEL_LENGTH/2.0f * std::cosf(60)), 0.0f, // left
-    MODEL_LENGTH/2.0f,  ( MODEL_LENGTH/2.0f * std::cosf(60)), 0.0f, // left
-    0.0f,               (-MODEL_LENGTH/2.0f * std::cosf(60)), 0.0f, // top
-};
+        Core::DrawCommand draw;
+        draw.program = line_program;
 
-std::array<float, 36> hexagon_vertices {
-   
-    -MODEL_LENGTH/4.0f, ( MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // top-left
-     MODEL_LENGTH/4.0f, ( MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // top-right
-     MODEL_LENGTH/4.0f, ( MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // top-right
-     MODEL_LENGTH/2.0f, 0.0f,                                                         0.0f, // right
-     MODEL_LENGTH/2.0f, 0.0f,                                                         0.0f, // right
-     MODEL_LENGTH/4.0f, (-MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // bottom-right
-     MODEL_LENGTH/4.0f, (-MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // bottom-right
-    -MODEL_LENGTH/4.0f, (-MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // bottom-left
-    -MODEL_LENGTH/4.0f, (-MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // bottom-left
-    -MODEL_LENGTH/2.0f, 0.0f,                                                         0.0f, // left
-    -MODEL_LENGTH/2.0f, 0.0f,                                                         0.0f, // left
-    -MODEL_LENGTH/4.0f, ( MODEL_LENGTH/2.0f * static_cast<float>(std::sqrt(3))/2.0f), 0.0f, // top-left
-};
+        for (std::size_t n = 0; n < drawn; ++n) {
 
-std::array<float, CIRCLE_SEGMENTS * 3> circle_vertices {};
+            const std::uint32_t i = use_spatial_index ? visible_entities[n] : static_cast<std::uint32_t>(n);
 
-////////////////////////////////////////////////////////////////////////////////
-// Vertex Shader Source Code
-////////////////////////////////////////////////////////////////////////////////
-constexpr auto vertex_shader_source = R"(
-    
-    #version 330 core
+            entity_store.ModelMatrix(i, draw.model_mat, alpha);
 
-    layout (location = 0) in vec4 a_Position;
-    uniform mat4 u_MVP_mat;
+            draw.mesh = mesh_lod.Select(meshes[i],
+                                        view_proj * Core::Affine2D::FromMat4(draw.model_mat),
+                                        mesh_registry.Range(meshes[i]).bounding_radius);
+            draw.color = colors[i];
 
-    void main() {
+            packet.draws.Add(i == usr_index ? 1 : 0, draw);
+        }
+
+        if (sort_draws) {
 
-        gl_Position = u_MVP_mat * a_Position;
+            PROFILE_SCOPE("Sort Draws");
+            packet.draws.Sort();
+        }
     }
-)";
 
-////////////////////////////////////////////////////////////////////////////////
-// Fragment Shader Source Code
-////////////////////////////////////////////////////////////////////////////////
-constexpr auto fragment_shader_source = R"(
+    packet.build_seconds = NowSeconds() - build_start_time;
+}
 
-    #version 330 core
+void RenderFrame(GLFWwindow* window, Core::RenderPacket& packet) {
 
-    out vec4 FragColor;
+    PROFILE_SCOPE("RenderFrame");
 
-    uniform vec4 u_Color_vec;
+    const double submit_start_time = NowSeconds();
 
-    void main() {
+    if (packet.upload_meshes) {
 
-        FragColor = u_Color_vec;
+        mesh_registry.Upload(*render_device);
     }
-)";
-
-int main(int argc, char** argv) {
 
-////////////////////////////////////////////////////////////////////////////////
-// Initialize Graphical User Interface Window Using GLFW
-////////////////////////////////////////////////////////////////////////////////
-    if (!glfwInit()) {
+    if (packet.set_viewport) {
 
-        std::cerr << "Failed to initialize GLFW" << std::endl;
-        return -1;
+        render_device->SetViewport(0, 0, packet.viewport_width, packet.viewport_height);
     }
 
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    render_device->BeginFrame();
+    stream_buffer.BeginFrame();
+    gpu_timer.BeginFrame();
 
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
+    const float clear_color_vec[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    render_device->Clear(clear_color_vec);
 
+    UpdateCameraBlock(packet.camera);
 
-    GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT,
-                                          WINDOW_TITLE, NULL, NULL);
+    // under the entities
+    DrawTrail(packet.trail);
 
-    if (!window) {
-        
-        std::cerr << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
+    if (packet.batched) {
+
+        batch_renderer.Begin();
+        batch_renderer.Flush(packet.instances);
     }
+    else {
 
-    glfwMakeContextCurrent(window);
-    glfwSwapInterval(1);
-    
-    float x_scale;
-    float y_scale;
-    
-    glfwGetWindowContentScale(window, &x_scale, &y_scale);
-    glfwSetWindowSize(window, SCREEN_WIDTH/x_scale, SCREEN_HEIGHT/y_scale);
-    glfwSetWindowSizeLimits(window,  640/x_scale,  360/y_scale, 
-                                    3024/x_scale, 1964/y_scale);
+        packet.draws.Submit(mesh_registry, *render_device);
+    }
 
-////////////////////////////////////////////////////////////////////////////////
-// Initialize and Load OpenGL Functions with GLAD
-////////////////////////////////////////////////////////////////////////////////
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+    gpu_timer.EndFrame();
+    stream_buffer.EndFrame();
+    render_device->EndFrame();
 
-        std::cerr << "Failed to initialize GLAD" << std::endl;
-        glfwTerminate();
-        return -1;
+    if (render_job_system) {
+
+        render_job_system->WaitAll();   // software rasterization join
     }
-    
-////////////////////////////////////////////////////////////////////////////////
-// Compile and Load Vertex Shader and Fragment Shader with OpenGL
-////////////////////////////////////////////////////////////////////////////////
-    int success = 0;
-    char info_log[INFOLOG_SIZE];
-   
-    unsigned int vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertex_shader, 1, &vertex_shader_source, nullptr);
-    glCompileShader(vertex_shader);
 
-    glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &success);
+    packet.device_stats = render_device->FrameStats();
+    packet.submit_seconds = NowSeconds() - submit_start_time;
+
+    {
+        PROFILE_SCOPE("Swap");
 
-    if (!success) {
+        frame_pacer.BeforePresent(packet.timing);
 
-        glGetShaderInfoLog(vertex_shader, INFOLOG_SIZE, nullptr, info_log);
-        std::cout << "Vertex Shader Compilation Failed: " << info_log << std::endl;
+        if (window) {
+
+            glfwSwapBuffers(window);
+        }
+
+        frame_pacer.EndFrame(packet.timing);
     }
 
-    unsigned int fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment_shader, 1, &fragment_shader_source, nullptr);
-    glCompileShader(fragment_shader);
+    if (packet.frame == 0) {
+
+        startup_tracer.End(first_frame_phase);
+        startup_tracer.MarkFirstFrame();
+    }
+}
 
-    glGetShaderiv(fragment_shader, GL_COMPILE_STATUS, &success);
+void CollectFrameResults(Core::RenderPacket& packet) {
 
-    if (!success) {
+    if (!packet.rendered) {
 
-        glGetShaderInfoLog(fragment_shader, INFOLOG_SIZE, nullptr, info_log);
-        std::cout << "Fragment Shader Compilation Failed: " << info_log << std::endl;
+        return;
     }
 
-////////////////////////////////////////////////////////////////////////////////
-// Create and Link Shader Program with OpenGL
-////////////////////////////////////////////////////////////////////////////////
-    shader_program = glCreateProgram();
-    
-    glAttachShader(shader_program, vertex_shader);
-    glAttachShader(shader_program, fragment_shader);
-    glLinkProgram(shader_program);
-    glValidateProgram(shader_program);
+    const Core::RenderDeviceStats& device_stats = packet.device_stats;
+
+    frame_draw_calls = static_cast<unsigned int>(device_stats.draw_calls);
+    frame_state_changes = device_stats.StateChanges();
+    frame_skipped_state = packet.draws.Stats().skipped_binds + packet.draws.Stats().skipped_uniforms;
+    frame_cpu_time = packet.build_seconds + packet.submit_seconds;
+
+    stats_cpu_time += frame_cpu_time;
+    stats_frames += 1;
+
+    run_cpu_time += frame_cpu_time;
+    run_device_stats.draw_calls += device_stats.draw_calls;
+    run_device_stats.instances += device_stats.instances;
+    run_device_stats.program_binds += device_stats.program_binds;
+    run_device_stats.vertex_array_binds += device_stats.vertex_array_binds;
+    run_device_stats.attribute_changes += device_stats.attribute_changes;
+    run_device_stats.uniform_sets += device_stats.uniform_sets;
+    run_device_stats.buffer_uploads += device_stats.buffer_uploads;
+    run_device_stats.bytes_uploaded += device_stats.bytes_uploaded;
 
-    glGetProgramiv(shader_program, GL_LINK_STATUS, &success);
+    packet.rendered = false;    // collected once
+}
+
+void ExportProfile() {
 
-    if (!success) {
+    if (Core::DefaultProfiler().ExportChromeTrace(PROFILE_TRACE_FILE)) {
+
+        LOG_INFO("Profiler Trace:\t%s", PROFILE_TRACE_FILE);
+    }
+    else {
 
-        glGetProgramInfoLog(shader_program, INFOLOG_SIZE, nullptr, info_log);
-        std::cout << "Shader Program Linking Failed: " << info_log << std::endl;
+        LOG_WARN("Failed to write profiler trace: %s", PROFILE_TRACE_FILE);
     }
+}
 
-    glDeleteShader(vertex_shader);
-    glDeleteShader(fragment_shader);
+double NowSeconds() {
 
-////////////////////////////////////////////////////////////////////////////////
-// Initialize Vertex Buffer and Vertex Array with OpenGL
-////////////////////////////////////////////////////////////////////////////////
+    using Clock = std::chrono::steady_clock;
+    static const Clock::time_point start_time = Clock::now();
 
-    glGenVertexArrays(1, &vao); 
-    glBindVertexArray(vao);
+    return std::chrono::duration<double>(Clock::now() - start_time).count();
+}
 
-    GenerateCircleVertices();
-    
-    glGenBuffers(1, &vbo_x_axis);
-    glGenBuffers(1, &vbo_y_axis);
-    glGenBuffers(1, &vbo_square);
-    glGenBuffers(1, &vbo_triangle);
-    glGenBuffers(1, &vbo_hexagon);
-    glGenBuffers(1, &vbo_circle);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_x_axis);
-    glBufferData(GL_ARRAY_BUFFER, x_axis_vertices.size() * sizeof(float), 
-                 x_axis_vertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
-  
+void UpdateCameraBlock(const Core::CameraBlockData& camera) {
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_y_axis);
-    glBufferData(GL_ARRAY_BUFFER, y_axis_vertices.size() * sizeof(float), 
-                 y_axis_vertices.data(), GL_STATIC_DRAW);
+    camera_block.SetProjection(camera.proj_mat);
+    camera_block.SetView(camera.view_mat);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
+    if (camera_block.ConsumeDirty()) {
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_square);
-    glBufferData(GL_ARRAY_BUFFER, square_vertices.size() * sizeof(float),
-                 square_vertices.data(), GL_STATIC_DRAW);
+        camera_ubo.Update(&camera_block.Data(), Core::CameraUniformBlock::Size());
+    }
+}
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
- 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_triangle);
-    glBufferData(GL_ARRAY_BUFFER, triangle_vertices.size() * sizeof(float),
-                 triangle_vertices.data(), GL_STATIC_DRAW);
+Core::MeshId RegisterModel(const float* line_vertices, std::size_t float_count) {
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
+    Core::IndexedMesh mesh = Core::BuildIndexedMesh(line_vertices, float_count);
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_hexagon);
-    glBufferData(GL_ARRAY_BUFFER, hexagon_vertices.size() * sizeof(float),
-                 hexagon_vertices.data(), GL_STATIC_DRAW);
+    LOG_INFO("Mesh Registered:\t%zu bytes as lines\t%zu bytes indexed",
+             float_count * sizeof(float), static_cast<std::size_t>(mesh.ByteSize()));
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
+    return mesh_registry.Register(mesh);
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_circle);
-    glBufferData(GL_ARRAY_BUFFER, circle_vertices.size() * sizeof(float),
-                 circle_vertices.data(), GL_STATIC_DRAW);
+Core::MeshId FindOrRegisterModel(const char* name, const float* line_vertices, std::size_t float_count) {
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
+    // pack meshes are loaded first, so their MeshIds are their pack indices
+    const int packed = mesh_pack.Find(Core::HashName(name));
 
-////////////////////////////////////////////////////////////////////////////////
-// Set Scene Initial Conditions
-////////////////////////////////////////////////////////////////////////////////
-    glfwSetFramebufferSizeCallback(window, OnWindowResize);
-  
-    int fb_width{};                 // framebuffer width
-    int fb_height{};                // framebuffer height
-    glfwGetFramebufferSize(window, &fb_width, &fb_height);
+    if (packed >= 0) {
 
-    std::cout << "GLFW Window Ready:\t" << fb_width << "\t" << fb_height << std::endl;
+        return static_cast<Core::MeshId>(packed);
+    }
 
-    glViewport(0, 0, fb_width, fb_height);
-   
-    float last_frame_start_time = 0.0f;
- 
-    env_model_mat = glm::translate(env_model_mat, glm::vec3(200.0, 200.0, 0.0f));
-    
-    proj_mat = glm::ortho(-fb_width/2.0f,   fb_width/2.0f,
-                          -fb_height/2.0f,  fb_height/2.0f, 
-                          -1.0f,            1.0f);
+    return RegisterModel(line_vertices, float_count);
+}
 
-////////////////////////////////////////////////////////////////////////////////
-// Main Loop
-////////////////////////////////////////////////////////////////////////////////
-    while (!glfwWindowShouldClose(window)) {
+void LoadMeshPack(const std::string& path) {
 
-        float current_frame_start_time = static_cast<float>(glfwGetTime());
-        float delta_time = current_frame_start_time - last_frame_start_time;
-        last_frame_start_time = current_frame_start_time;
-        
-        glfwPollEvents();
+    const double start_time = NowSeconds();
 
-        OnKeyboardInput(window, delta_time);
-        OnRender(window);
+    if (!mesh_pack.Open(path)) {
+
+        LOG_WARN("Mesh Pack:\t%s not loaded (%s), using built-in models", path.c_str(), mesh_pack.Error());
+        return;
     }
 
+    mesh_registry.Load(mesh_pack);
+
+    LOG_INFO("Mesh Pack:\t%s\t%zu meshes\t%zu vertices\t%.3f ms", path.c_str(), mesh_pack.MeshCount(),
+             mesh_pack.VertexCount(), (NowSeconds() - start_time) * 1e3);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-// Delete Objects and Programs, Close Window, Exit Program
+// Register Models
+// --Models come from the mesh pack compiled from assets/models.txt; a shape
+//   can be added there without rebuilding the app. Models missing from the
+//   pack (or every model, without a pack) fall back to Models.hpp.
+// --Line lists are converted to deduplicated, quantized line strips.
+// --Runs as a startup job: nothing else touches mesh_pack, mesh_registry,
+//   the model MeshIds or mesh_lod until the job is waited for.
 ////////////////////////////////////////////////////////////////////////////////
-    glDeleteVertexArrays(1, &vao);
-    glDeleteBuffers(1, &vbo_x_axis);
-    glDeleteBuffers(1, &vbo_y_axis);
-    glDeleteBuffers(1, &vbo_square);
-    glDeleteBuffers(1, &vbo_triangle);
-    glDeleteBuffers(1, &vbo_hexagon);
-    glDeleteProgram(shader_program);
+void SetupModels(const std::string& mesh_pack_path) {
 
-    glfwTerminate(); 
-    return 0;
-}
+    Core::StartupScope scope(startup_tracer, "models");
 
-void OnWindowResize(GLFWwindow* window, int width, int height) {
+    LoadMeshPack(mesh_pack_path);
 
-    std::cout << "GLFW Window Resize:\t" << width << "\t" << height << std::endl;
-    
-    proj_mat = glm::ortho(-width/2.0f,   width/2.0f,
-                          -height/2.0f,  height/2.0f, 
-                          -1.0f,         1.0f);
+    x_axis_mesh   = FindOrRegisterModel("x_axis",   Core::x_axis_vertices.data(),   Core::x_axis_vertices.size());
+    y_axis_mesh   = FindOrRegisterModel("y_axis",   Core::y_axis_vertices.data(),   Core::y_axis_vertices.size());
+    square_mesh   = FindOrRegisterModel("square",   Core::square_vertices.data(),   Core::square_vertices.size());
+    triangle_mesh = FindOrRegisterModel("triangle", Core::triangle_vertices.data(), Core::triangle_vertices.size());
+    hexagon_mesh  = FindOrRegisterModel("hexagon",  Core::hexagon_vertices.data(),  Core::hexagon_vertices.size());
+    circle_mesh   = FindOrRegisterModel("circle",   Core::circle_vertices.data(),   Core::circle_vertices.size());
 
-    glViewport(0, 0, width, height);
+    stress_meshes = {square_mesh, triangle_mesh, hexagon_mesh, circle_mesh};
 
-    OnRender(window);
-}
+    for (std::size_t mesh = 0; mesh < mesh_pack.MeshCount(); ++mesh) {
 
-void OnKeyboardInput(GLFWwindow* window, float delta_time) {
+        const Core::MeshId id = static_cast<Core::MeshId>(mesh);
 
-    if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "UP" << std::endl;
-        TranslateModel(KeyboardInputType::KeyUp, delta_time); 
+        if (id != x_axis_mesh && id != y_axis_mesh &&
+            std::find(stress_meshes.begin(), stress_meshes.end(), id) == stress_meshes.end()) {
+
+            stress_meshes.push_back(id);
+        }
     }
 
-    if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS) { 
+    mesh_lod.AddCurve(circle_mesh, Core::BuildCircleMesh);
+    instance_builder.SetLod(&mesh_lod);
+}
 
-        std::cout << "GLFW Keyboard Input:\t" << "DOWN" << std::endl;
-        TranslateModel(KeyboardInputType::KeyDown, delta_time); 
-    }
-    
-    if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS) { 
+Core::MeshId ModelMesh(UserModel model) {
 
-        std::cout << "GLFW Keyboard Input:\t" << "LEFT" << std::endl;
-        RotateModel(KeyboardInputType::KeyLeft, delta_time); 
+    switch(model) {
+        case UserModel::Square:
+            return square_mesh;
+        case UserModel::Triangle:
+            return triangle_mesh;
+        case UserModel::Hexagon:
+            return hexagon_mesh;
+        case UserModel::Circle:
+            return circle_mesh;
+        default:
+            LOG_WARN("Invalid model selection.");
+            return square_mesh;
     }
+}
 
-    if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS) { 
+void CreateSceneEntities(int stress_count, int fb_width, int fb_height) {
 
-        std::cout << "GLFW Keyboard Input:\t" << "RIGHT" << std::endl;
-        RotateModel(KeyboardInputType::KeyRight, delta_time); 
-    }
+    Core::EntityDesc desc;
 
-    if (glfwGetKey(window, GLFW_KEY_COMMA) == GLFW_PRESS) { 
+    desc.mesh = x_axis_mesh;
+    desc.color = x_axis_color_vec;
+    x_axis_entity = entity_store.Create(desc);
 
-        std::cout << "GLFW Keyboard Input:\t" << "LESS THAN" << std::endl;
-        ScaleModel(KeyboardInputType::KeyLessThan, delta_time); 
-    }
-    
-    if (glfwGetKey(window, GLFW_KEY_PERIOD) == GLFW_PRESS) { 
+    desc.mesh = y_axis_mesh;
+    desc.color = y_axis_color_vec;
+    y_axis_entity = entity_store.Create(desc);
 
-        std::cout << "GLFW Keyboard Input:\t" << "GREATER THAN" << std::endl;
-        ScaleModel(KeyboardInputType::KeyGreaterThan, delta_time); 
-    }
+    desc.mesh = square_mesh;
+    desc.color = env_color_vec;
+    desc.position_x = 200.0f;
+    desc.position_y = 200.0f;
+    env_entity = entity_store.Create(desc);
 
-    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) { 
+    SpawnStressEntities(stress_count, fb_width, fb_height);
 
-        std::cout << "GLFW Keyboard Input:\t" << "W" << std::endl;
-        TranslateCamera(KeyboardInputType::KeyW, delta_time);
-    }
+    // created last so it is drawn on top
+    usr_entity = entity_store.Create(Core::EntityDesc{0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+                                                      usr_color_vec, square_mesh});
 
-    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) { 
+    for (std::uint32_t i = 0; i < entity_store.Size(); ++i) {
 
-        std::cout << "GLFW Keyboard Input:\t" << "S" << std::endl;
-        TranslateCamera(KeyboardInputType::KeyS, delta_time);
+        UpdateEntityBounds(entity_store.HandleAt(i));
     }
+}
 
-    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) { 
+void SpawnStressEntities(int count, int fb_width, int fb_height) {
 
-        std::cout << "GLFW Keyboard Input:\t" << "A" << std::endl;
-        TranslateCamera(KeyboardInputType::KeyA, delta_time);
-    }
+    std::mt19937 rng(1234);     // fixed seed so runs are comparable
+    std::uniform_real_distribution<float> x_dist(-fb_width/2.0f, fb_width/2.0f);
+    std::uniform_real_distribution<float> y_dist(-fb_height/2.0f, fb_height/2.0f);
+    std::uniform_real_distribution<float> angle_dist(0.0f, 360.0f);
+    std::uniform_real_distribution<float> unit_dist(0.0f, 1.0f);
+    std::uniform_int_distribution<std::size_t> model_dist(0, stress_meshes.size() - 1);
 
-    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "D" << std::endl;
-        TranslateCamera(KeyboardInputType::KeyD, delta_time);
-    }
-   
-    if (glfwGetKey(window, GLFW_KEY_O) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "O" << std::endl;
-        ResetCamera();
-    }
-   
-    if (glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "H" << std::endl;
-        ResetModel(window);
-    }
-   
-    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "Q" << std::endl;
-        RotateCamera(KeyboardInputType::KeyQ, delta_time, window);
-    }
-    
-    if (glfwGetKey(window, GLFW_KEY_Z) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "Z" << std::endl;
-        ZoomCamera(KeyboardInputType::KeyZ, delta_time);
-    }
-    
-    if (glfwGetKey(window, GLFW_KEY_X) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "X" << std::endl;
-        ZoomCamera(KeyboardInputType::KeyX, delta_time);
-    }
-    
-    if (glfwGetKey(window, GLFW_KEY_E) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "E" << std::endl;
-        RotateCamera(KeyboardInputType::KeyE, delta_time, window);
-    }
-    
-    if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS) { 
+    entity_store.Reserve(entity_store.Size() + count + 1);
 
-        std::cout << "GLFW Keyboard Input:\t" << "R" << std::endl;
-        ColorModel(KeyboardInputType::KeyR); 
-    }
+    for (int i = 0; i < count; ++i) {
 
-    if (glfwGetKey(window, GLFW_KEY_G) == GLFW_PRESS) { 
+        Core::EntityDesc desc;
+        desc.position_x = x_dist(rng);
+        desc.position_y = y_dist(rng);
+        desc.rotation = glm::radians(angle_dist(rng));
+        desc.scale_x = desc.scale_y = 0.1f + 0.2f * unit_dist(rng);
+        desc.color = Core::Color{unit_dist(rng), unit_dist(rng), unit_dist(rng), 1.0f};
+        desc.mesh = stress_meshes[model_dist(rng)];
 
-        std::cout << "GLFW Keyboard Input:\t" << "G" << std::endl;
-        ColorModel(KeyboardInputType::KeyG); 
+        entity_store.Create(desc);
     }
 
-    if (glfwGetKey(window, GLFW_KEY_B) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "B" << std::endl;
-        ColorModel(KeyboardInputType::KeyB); 
-    }
-    
-    if (glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "SPACE" << std::endl;
-        ColorModel(KeyboardInputType::KeySpace); 
+    if (count > 0) {
+
+        LOG_INFO("Stress Mode:\t%d entities spawned", count);
     }
-    
-    if (glfwGetKey(window, GLFW_KEY_1) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "1" << std::endl;
-        SwapModel(KeyboardInputType::Key1); 
+}
+
+void UpdateEntityBounds(Core::EntityHandle entity) {
+
+    const std::uint32_t i = entity_store.IndexOf(entity);
+    const float mesh_radius = mesh_registry.Range(entity_store.Meshes()[i]).bounding_radius;
+
+    // the previous step too, rendering interpolates between the two
+    float previous_x, previous_y, previous_rotation, previous_scale_x, previous_scale_y;
+    entity_store.InterpolateTransforms(0.0f, i, i + 1, &previous_x, &previous_y, &previous_rotation,
+                                       &previous_scale_x, &previous_scale_y);
+
+    const float x = entity_store.PositionX()[i];
+    const float y = entity_store.PositionY()[i];
+
+    const float scale = std::max({std::fabs(entity_store.ScaleX()[i]), std::fabs(entity_store.ScaleY()[i]),
+                                  std::fabs(previous_scale_x), std::fabs(previous_scale_y)});
+
+    const float radius = mesh_radius * scale + std::hypot(x - previous_x, y - previous_y);
+
+    spatial_index.Insert(entity.slot, x, y, radius);
+}
+
+void QueryVisibleEntities(const Core::Affine2D& view_proj) {
+
+    PROFILE_SCOPE("Spatial Query");
+
+    visible_slots.clear();
+    spatial_index.Query(Core::VisibleBounds(view_proj), visible_slots);
+
+    visible_entities.resize(visible_slots.size());
+
+    for (std::size_t n = 0; n < visible_slots.size(); ++n) {
+
+        visible_entities[n] = entity_store.IndexOfSlot(visible_slots[n]);
     }
 
-    if (glfwGetKey(window, GLFW_KEY_2) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "2" << std::endl;
-        SwapModel(KeyboardInputType::Key2); 
+    // entity order is draw order
+    std::sort(visible_entities.begin(), visible_entities.end());
+}
+
+void InitStreamedGeometry() {
+
+    stream_buffer.Init(*render_device, Core::BufferTarget::Vertex, STREAM_FRAME_BYTES);
+
+    std::vector<std::uint16_t> indices(TRAIL_LENGTH + 1);
+
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+
+        indices[i] = static_cast<std::uint16_t>(i);
     }
-    
-    if (glfwGetKey(window, GLFW_KEY_3) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "3" << std::endl;
-        SwapModel(KeyboardInputType::Key3); 
+
+    stream_index_buffer = render_device->CreateBuffer(Core::BufferTarget::Index,
+                                                      indices.size() * sizeof(std::uint16_t),
+                                                      indices.data(), Core::BufferUsage::Static);
+
+    stream_vertex_array = render_device->CreateVertexArray(stream_index_buffer);
+
+    Core::VertexAttribute position;
+    position.location = 0;
+    position.buffer = stream_buffer.Buffer();
+    position.components = 2;
+    position.stride = 2 * sizeof(float);
+
+    render_device->SetVertexAttribute(stream_vertex_array, position);
+}
+
+void RecordTrail(Core::EntityHandle entity) {
+
+    const std::uint32_t i = entity_store.IndexOf(entity);
+    const float x = entity_store.PositionX()[i];
+    const float y = entity_store.PositionY()[i];
+
+    const std::size_t size = trail_points.size();
+
+    if (size >= 2 && trail_points[size - 2] == x && trail_points[size - 1] == y) {
+
+        return;
     }
-    
-    if (glfwGetKey(window, GLFW_KEY_4) == GLFW_PRESS) { 
-        
-        std::cout << "GLFW Keyboard Input:\t" << "4" << std::endl;
-        SwapModel(KeyboardInputType::Key4); 
+
+    if (size >= 2 * TRAIL_LENGTH) {
+
+        trail_points.erase(trail_points.begin(), trail_points.begin() + 2);
     }
+
+    trail_points.push_back(x);
+    trail_points.push_back(y);
 }
 
-void OnRender(GLFWwindow* window) {
+void BuildTrail(Core::EntityHandle entity, float alpha, std::vector<float>& trail) {
 
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT);
-    glUseProgram(shader_program);
-   
-    Draw(vbo_x_axis, xyz_model_mat, x_axis_color_vec, x_axis_vertices.size());
-    Draw(vbo_y_axis, xyz_model_mat, y_axis_color_vec, y_axis_vertices.size());
-    Draw(vbo_square, env_model_mat, env_color_vec, square_vertices.size());
-    
-    switch(active_usr_model) {
-        case UserModel::Square:
-            Draw(vbo_square, usr_model_mat, usr_color_vec, square_vertices.size());
-            break;
-        case UserModel::Triangle:
-            Draw(vbo_triangle, usr_model_mat, usr_color_vec, triangle_vertices.size());
-            break;
-        case UserModel::Hexagon:
-            Draw(vbo_hexagon, usr_model_mat, usr_color_vec, hexagon_vertices.size());
-            break;
-        case UserModel::Circle:
-            Draw(vbo_circle, usr_model_mat, usr_color_vec, circle_vertices.size());
-            break;
-        default:
-            std::cerr << "Invalid model selection." << std::endl;
-            return;
+    trail.clear();
+
+    // nothing until the entity has moved
+    if (trail_points.size() < 4) {
+
+        return;
     }
-    
-    glfwSwapBuffers(window);
+
+    // ends at the interpolated position, so the trail stays attached
+    const std::uint32_t i = entity_store.IndexOf(entity);
+
+    float head[5];
+    entity_store.InterpolateTransforms(alpha, i, i + 1, &head[0], &head[1], &head[2], &head[3], &head[4]);
+
+    trail.assign(trail_points.begin(), trail_points.end());
+    trail.push_back(head[0]);
+    trail.push_back(head[1]);
 }
 
-void GenerateCircleVertices() {
+void DrawTrail(const std::vector<float>& trail) {
 
-    circle_vertices[ 0 ] = MODEL_LENGTH/2.0f * std::cosf(2.0f * glm::pi<float>() * 0 / CIRCLE_SEGMENTS);
-    circle_vertices[ 1 ] = MODEL_LENGTH/2.0f * std::sinf(2.0f * glm::pi<float>() * 0 / CIRCLE_SEGMENTS);
-    circle_vertices[ 2 ] = 0.0f;
+    if (trail.empty()) {
 
-    for(int i = 3; i < CIRCLE_SEGMENTS - 3; i+=6) {
-        
-        circle_vertices[ i ] = MODEL_LENGTH/2.0f * std::cosf(2.0f * glm::pi<float>() * i / CIRCLE_SEGMENTS);
+        return;
+    }
 
-        if(circle_vertices[ i ] < 0.1f && circle_vertices[ i ] > -0.1f) {
+    const std::size_t point_count = trail.size() / 2;
+    const std::size_t stride = 2 * sizeof(float);
 
-            circle_vertices[ i ] = 0.0f;
-        }
-        circle_vertices[i+1] = MODEL_LENGTH/2.0f * std::sinf(2.0f * glm::pi<float>() * i / CIRCLE_SEGMENTS);
-        
-        if(circle_vertices[i+1] < 0.1f && circle_vertices[i+1] > -0.1f) {
+    Core::StreamAllocation allocation = stream_buffer.AllocateVertices(point_count, stride);
 
-            circle_vertices[i+1] = 0.0f;
-        }
-        circle_vertices[i+2] = 0.0f;
-        circle_vertices[i+3] = circle_vertices[ i ];
-        circle_vertices[i+4] = circle_vertices[i+1];
-        circle_vertices[i+5] = circle_vertices[i+2];
+    if (!allocation) {
+
+        return;
     }
-    circle_vertices[CIRCLE_SEGMENTS-3] = MODEL_LENGTH/2.0f * std::cosf(2.0f * glm::pi<float>() * 0 / CIRCLE_SEGMENTS);
-    circle_vertices[CIRCLE_SEGMENTS-2] = MODEL_LENGTH/2.0f * std::sinf(2.0f * glm::pi<float>() * 0 / CIRCLE_SEGMENTS);
-    circle_vertices[CIRCLE_SEGMENTS-1] = 0.0f;
-}
 
-void Draw(unsigned int buffer, glm::mat4 model_mat, glm::vec4 color, int vertices_size) {
+    std::copy(trail.begin(), trail.end(), static_cast<float*>(allocation.data));
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0); 
-    glBindBuffer(GL_ARRAY_BUFFER, buffer);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), 0);
-    glEnableVertexAttribArray(0);
-    
-    mvp_mat = proj_mat * view_mat * model_mat;
+    stream_buffer.Flush();
+
+    // the line program scales positions by the extent, undo it for world units
+    float model_mat[16];
+    Core::Affine2D::Scale(1.0f / POSITION_EXTENT, 1.0f / POSITION_EXTENT).ToMat4(model_mat);
 
-    auto position_loc = glGetUniformLocation(shader_program, "u_MVP_mat");
-    glUniformMatrix4fv(position_loc, 1, GL_FALSE, glm::value_ptr(mvp_mat));
+    render_device->UseProgram(line_program);
+    render_device->BindVertexArray(stream_vertex_array);
+    render_device->SetUniform(U_MODEL_MAT, Core::UniformType::Mat4, model_mat);
+    render_device->SetUniform(U_COLOR_VEC, Core::UniformType::Vec4, &trail_color_vec.r);
 
-    auto color_loc = glGetUniformLocation(shader_program, "u_Color_vec");
-    glUniform4f(color_loc, color[0], color[1], color[2], color[3]);
+    Core::DrawCall draw;
+    draw.primitive = Core::PrimitiveType::LineStrip;
+    draw.index_count = static_cast<int>(point_count);
+    draw.base_vertex = static_cast<int>(allocation.offset / stride);
 
-    glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(vertices_size / 3));
+    render_device->Draw(draw);
 }
 
 void ResetCamera() {
 
-    view_mat = glm::mat4(1.0f);
+    view_mat = Core::Affine2D::Identity();
+
+    // a reset jumps, it should not be interpolated from the old view
+    previous_view_mat = view_mat;
+    frame_damage.Mark(Core::DamageFlag::Camera);
 }
 
 void RotateCamera(KeyboardInputType key, float delta_time, GLFWwindow* window) {
@@ -695,76 +1861,83 @@ void RotateCamera(KeyboardInputType key, float delta_time, GLFWwindow* window) {
         case(KeyboardInputType::KeyE):
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
    
-    // glm::rotate(M, a, axis) returns mat_A * R(a), correct order is R(a) * mat_A
-    view_mat = glm::rotate(glm::mat4(1.0f), glm::radians(rotation_angle_per_frame),
-                           glm::vec3(0.0f, 0.0f, 1.0f)) * view_mat;
-
-
+    // rotate about the screen center, correct order is R(a) * view_mat
+    view_mat = Core::Affine2D::Rotation(glm::radians(rotation_angle_per_frame)) * view_mat;
+    frame_damage.Mark(Core::DamageFlag::Camera);
 }
 
 void TranslateCamera(KeyboardInputType key, float delta_time) {
 
     float translation_units_per_frame = TRANSLATION_SPEED * delta_time;
 
-    glm::vec3 translation_vec = glm::vec3(0.0f);
+    float translation_x = 0.0f;
+    float translation_y = 0.0f;
 
     switch(key) {
         case(KeyboardInputType::KeyW):
-            translation_vec.y = -translation_units_per_frame;
+            translation_y = -translation_units_per_frame;
             break;
         case(KeyboardInputType::KeyS):
-            translation_vec.y = translation_units_per_frame;
+            translation_y = translation_units_per_frame;
             break;
         case(KeyboardInputType::KeyA):
-            translation_vec.x = translation_units_per_frame;
+            translation_x = translation_units_per_frame;
             break;
         case(KeyboardInputType::KeyD):
-            translation_vec.x = -translation_units_per_frame;
+            translation_x = -translation_units_per_frame;
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
     
-    view_mat = glm::translate(glm::mat4(1.0f), translation_vec) * view_mat;
-
+    view_mat = Core::Affine2D::Translation(translation_x, translation_y) * view_mat;
+    frame_damage.Mark(Core::DamageFlag::Camera);
 }
 void ZoomCamera(KeyboardInputType key, float delta_time) {
 
     float scale_units_per_frame = SCALE_SPEED * delta_time;
 
-    glm::vec3 scale_vec = glm::vec3(0.0f);
+    float scale_factor = 1.0f;
 
     switch(key) {
         case(KeyboardInputType::KeyZ):
-            scale_vec = glm::vec3(1.0f + scale_units_per_frame); 
+            scale_factor = 1.0f + scale_units_per_frame; 
             break;
         case(KeyboardInputType::KeyX):
-            scale_vec = glm::vec3(1.0f - scale_units_per_frame);
+            scale_factor = 1.0f - scale_units_per_frame;
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
 
-    view_mat = glm::scale(glm::mat4(1.0f), scale_vec) * view_mat;
+    view_mat = Core::Affine2D::Scale(scale_factor, scale_factor) * view_mat;
+    frame_damage.Mark(Core::DamageFlag::Camera);
 }
 
-void ResetModel(GLFWwindow* window) {
+void ResetModel(Core::EntityHandle entity) {
 
-    int fb_width{};                 // framebuffer width
-    int fb_height{};                // framebuffer height
-    glfwGetFramebufferSize(window, &fb_width, &fb_height);
+    const std::uint32_t i = entity_store.IndexOf(entity);
 
-    usr_model_mat = glm::mat4(1.0f);
-    usr_color_vec = glm::vec4(1.0f);
+    entity_store.PositionX()[i] = 0.0f;
+    entity_store.PositionY()[i] = 0.0f;
+    entity_store.Rotation()[i] = 0.0f;
+    entity_store.ScaleX()[i] = 1.0f;
+    entity_store.ScaleY()[i] = 1.0f;
+    entity_store.Colors()[i] = usr_color_vec;
+
+    // without this the next frames would lerp (and spin back through the
+    // unwrapped rotation) from the pre-reset transform
+    entity_store.SnapTransform(i);
+    frame_damage.Mark(Core::DamageFlag::Entities);
 }
 
-void RotateModel(KeyboardInputType key, float delta_time) {
+void RotateModel(Core::EntityHandle entity, KeyboardInputType key, float delta_time) {
 
     float rotation_angle_per_frame = ROTATION_SPEED * delta_time;
 
@@ -775,95 +1948,118 @@ void RotateModel(KeyboardInputType key, float delta_time) {
             rotation_angle_per_frame *= -1;
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
 
-    usr_model_mat = glm::rotate(usr_model_mat,
-                               glm::radians(rotation_angle_per_frame),
-                               glm::vec3(0.0f, 0.0f, 1.0f));
+    const std::uint32_t i = entity_store.IndexOf(entity);
+
+    entity_store.SaveTransform(i);
+    entity_store.Rotation()[i] += glm::radians(rotation_angle_per_frame);
+    frame_damage.Mark(Core::DamageFlag::Entities);
 }
 
-void TranslateModel(KeyboardInputType key, float delta_time) {
+void TranslateModel(Core::EntityHandle entity, KeyboardInputType key, float delta_time) {
    
     float translation_units_per_frame = TRANSLATION_SPEED * delta_time;
 
-    glm::vec3 translation_matrix = glm::vec3(0.0f);
+    float local_y = 0.0f;
 
     switch(key) {
         case(KeyboardInputType::KeyUp):
-            translation_matrix.y = translation_units_per_frame;
+            local_y = translation_units_per_frame;
             break;
         case(KeyboardInputType::KeyDown):
-            translation_matrix.y = -translation_units_per_frame;
+            local_y = -translation_units_per_frame;
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
-    
-    usr_model_mat = glm::translate(usr_model_mat, translation_matrix);
+
+    // move along the model's own (rotated and scaled) y-axis
+    const std::uint32_t i = entity_store.IndexOf(entity);
+    const float rotation = entity_store.Rotation()[i];
+    const float scaled_y = local_y * entity_store.ScaleY()[i];
+
+    entity_store.SaveTransform(i);
+    entity_store.PositionX()[i] += -std::sin(rotation) * scaled_y;
+    entity_store.PositionY()[i] +=  std::cos(rotation) * scaled_y;
+    frame_damage.Mark(Core::DamageFlag::Entities);
 }
 
-void ScaleModel(KeyboardInputType key, float delta_time) {
+void ScaleModel(Core::EntityHandle entity, KeyboardInputType key, float delta_time) {
     
     float scale_units_per_frame = SCALE_SPEED * delta_time;
 
-    glm::vec3 scale_matrix = glm::vec3(0.0f);
+    float scale_factor = 1.0f;
 
     switch(key) {
         case(KeyboardInputType::KeyGreaterThan):
-            scale_matrix = glm::vec3(1.0f + scale_units_per_frame); 
+            scale_factor = 1.0f + scale_units_per_frame; 
             break;
         case(KeyboardInputType::KeyLessThan):
-            scale_matrix = glm::vec3(1.0f - scale_units_per_frame);
+            scale_factor = 1.0f - scale_units_per_frame;
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
 
-    usr_model_mat = glm::scale(usr_model_mat, scale_matrix);
+    const std::uint32_t i = entity_store.IndexOf(entity);
+
+    entity_store.SaveTransform(i);
+    entity_store.ScaleX()[i] *= scale_factor;
+    entity_store.ScaleY()[i] *= scale_factor;
+    frame_damage.Mark(Core::DamageFlag::Entities);
 }
 
-void ColorModel(KeyboardInputType key) {
+void ColorModel(Core::EntityHandle entity, KeyboardInputType key) {
+
+    Core::Color& color = entity_store.Colors()[entity_store.IndexOf(entity)];
 
     switch(key) {
         case(KeyboardInputType::KeyR):
-            usr_color_vec = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+            color = Core::Color{1.0f, 0.0f, 0.0f, 1.0f};
             break;
         case(KeyboardInputType::KeyG):
-            usr_color_vec = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
+            color = Core::Color{0.0f, 1.0f, 0.0f, 1.0f};
             break;
         case(KeyboardInputType::KeyB):
-            usr_color_vec = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); 
+            color = Core::Color{0.0f, 0.0f, 1.0f, 1.0f};
             break;
         case(KeyboardInputType::KeySpace):
-            usr_color_vec = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+            color = Core::Color{1.0f, 1.0f, 1.0f, 1.0f};
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
+
+    frame_damage.Mark(Core::DamageFlag::Entities);
 }
 
-void SwapModel(KeyboardInputType key) {
+void SwapModel(Core::EntityHandle entity, KeyboardInputType key) {
+
+    Core::MeshId& mesh = entity_store.Meshes()[entity_store.IndexOf(entity)];
 
     switch(key) {
         case(KeyboardInputType::Key1):
-            active_usr_model = UserModel::Square;
+            mesh = ModelMesh(UserModel::Square);
             break;
         case(KeyboardInputType::Key2):
-            active_usr_model = UserModel::Triangle;
+            mesh = ModelMesh(UserModel::Triangle);
             break;
         case(KeyboardInputType::Key3):
-            active_usr_model = UserModel::Hexagon;
+            mesh = ModelMesh(UserModel::Hexagon);
             break;
         case(KeyboardInputType::Key4):
-            active_usr_model = UserModel::Circle;
+            mesh = ModelMesh(UserModel::Circle);
             break;
         default:
-            std::cerr << "Invalid keyboard input." << std::endl;
+            LOG_WARN("Invalid keyboard input.");
             return;
     }
+
+    frame_damage.Mark(Core::DamageFlag::Entities);
 }
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: main.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "MeshPack.hpp"
+#include "MeshRegistry.hpp"
+#include "MeshSource.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Asset Compiler
+// --Compiles mesh source files (see MeshSource.hpp) into one mesh pack the
+//   app maps at startup (see MeshPack.hpp). Run by the build, see the App's
+//   CMakeLists.txt.
+// --usage: OpenGLTemplate-AssetCompiler SOURCE... -o PACK
+// --Meshes keep the order of the sources; names must be unique across all
+//   of them. Nothing is written if any source has an error.
+////////////////////////////////////////////////////////////////////////////////
+static bool ReadText(const char* path, std::string& text) {
+
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file) {
+
+        return false;
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    text = contents.str();
+
+    return true;
+}
+
+int main(int argc, char** argv) {
+
+    std::vector<const char*> source_paths;
+    const char* output_path = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+
+            output_path = argv[++i];
+        }
+        else {
+
+            source_paths.push_back(argv[i]);
+        }
+    }
+
+    if (source_paths.empty() || !output_path) {
+
+        std::fprintf(stderr, "usage: %s SOURCE... -o PACK\n", argv[0]);
+        return 2;
+    }
+
+    Core::MeshRegistry registry;
+    std::vector<std::string> names;
+    std::unordered_set<std::string> seen;
+
+    for (const char* path : source_paths) {
+
+        std::string text;
+
+        if (!ReadText(path, text)) {
+
+            std::fprintf(stderr, "%s: error: cannot read file\n", path);
+            return 1;
+        }
+
+        std::vector<Core::MeshSource> meshes;
+        std::string error;
+
+        if (!Core::ParseMeshSource(text, meshes, error)) {
+
+            std::fprintf(stderr, "%s: error: %s\n", path, error.c_str());
+            return 1;
+        }
+
+        for (const Core::MeshSource& mesh : meshes) {
+
+            if (!seen.insert(mesh.name).second) {
+
+                std::fprintf(stderr, "%s: error: mesh %s is already defined in an earlier source\n",
+                             path, mesh.name.c_str());
+                return 1;
+            }
+
+            registry.Register(Core::BuildIndexedMesh(mesh.line_vertices.data(), mesh.line_vertices.size()));
+            names.push_back(mesh.name);
+        }
+    }
+
+    if (!Core::WriteMeshPack(output_path, registry, names)) {
+
+        std::fprintf(stderr, "%s: error: cannot write file\n", output_path);
+        return 1;
+    }
+
+    std::printf("%s: %zu meshes, %zu vertices, %zu indices\n", output_path, registry.MeshCount(),
+                registry.VertexCount(), registry.IndexCount());
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Affine2D.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "Affine2D.hpp"
+
+#include <cmath>
+
+namespace Core {
+
+Affine2D Affine2D::Translation(float x, float y) {
+
+    return Affine2D{1.0f, 0.0f, 0.0f, 1.0f, x, y};
+}
+
+Affine2D Affine2D::Rotation(float radians) {
+
+    const float cos_r = std::cos(radians);
+    const float sin_r = std::sin(radians);
+
+    return Affine2D{cos_r, sin_r, -sin_r, cos_r, 0.0f, 0.0f};
+}
+
+Affine2D Affine2D::Scale(float x, float y) {
+
+    return Affine2D{x, 0.0f, 0.0f, y, 0.0f, 0.0f};
+}
+
+Affine2D Affine2D::FromTRS(float x, float y, float radians, float scale_x, float scale_y) {
+
+    const float cos_r = std::cos(radians);
+    const float sin_r = std::sin(radians);
+
+    return Affine2D{cos_r * scale_x, sin_r * scale_x, -sin_r * scale_y, cos_r * scale_y, x, y};
+}
+
+Affine2D Affine2D::Ortho(float left, float right, float bottom, float top) {
+
+    return Affine2D{2.0f / (right - left), 0.0f,
+                    0.0f, 2.0f / (top - bottom),
+                    -(right + left) / (right - left), -(top + bottom) / (top - bottom)};
+}
+
+Affine2D Affine2D::FromMat4(const float* mat) {
+
+    return Affine2D{mat[0], mat[1], mat[4], mat[5], mat[12], mat[13]};
+}
+
+void Affine2D::ToMat4(float* out_mat) const {
+
+    out_mat[0]  = a;    out_mat[1]  = b;    out_mat[2]  = 0.0f; out_mat[3]  = 0.0f;
+    out_mat[4]  = c;    out_mat[5]  = d;    out_mat[6]  = 0.0f; out_mat[7]  = 0.0f;
+    out_mat[8]  = 0.0f; out_mat[9]  = 0.0f; out_mat[10] = 1.0f; out_mat[11] = 0.0f;
+    out_mat[12] = tx;   out_mat[13] = ty;   out_mat[14] = 0.0f; out_mat[15] = 1.0f;
+}
+
+Affine2D operator*(const Affine2D& lhs, const Affine2D& rhs) {
+
+    return Affine2D{lhs.a * rhs.a  + lhs.c * rhs.b,
+                    lhs.b * rhs.a  + lhs.d * rhs.b,
+                    lhs.a * rhs.c  + lhs.c * rhs.d,
+                    lhs.b * rhs.c  + lhs.d * rhs.d,
+                    lhs.a * rhs.tx + lhs.c * rhs.ty + lhs.tx,
+                    lhs.b * rhs.tx + lhs.d * rhs.ty + lhs.ty};
+}
+
+Affine2D Inverse(const Affine2D& transform) {
+
+    const float determinant = transform.a * transform.d - transform.b * transform.c;
+
+    if (determinant == 0.0f) {
+
+        return Affine2D{0.0f, 0.0f, 0.0f, 0.0f, -transform.tx, -transform.ty};
+    }
+
+    const float inverse_determinant = 1.0f / determinant;
+
+    const float a =  transform.d * inverse_determinant;
+    const float b = -transform.b * inverse_determinant;
+    const float c = -transform.c * inverse_determinant;
+    const float d =  transform.a * inverse_determinant;
+
+    return Affine2D{a, b, c, d,
+                    -(a * transform.tx + c * transform.ty),
+                    -(b * transform.tx + d * transform.ty)};
+}
+
+Affine2D Lerp(const Affine2D& from, const Affine2D& to, float alpha) {
+
+    return Affine2D{from.a  + alpha * (to.a  - from.a),
+                    from.b  + alpha * (to.b  - from.b),
+                    from.c  + alpha * (to.c  - from.c),
+                    from.d  + alpha * (to.d  - from.d),
+                    from.tx + alpha * (to.tx - from.tx),
+                    from.ty + alpha * (to.ty - from.ty)};
+}
+
+} // namespace Core
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Affine2D.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// 2D Affine Transform
+// --A 3x2 matrix stored column-major like glm, so the 2x2 linear part is
+//   (a, b) and (c, d) followed by the translation (tx, ty):
+//
+//       | a  c  tx |       x' = a*x + c*y + tx
+//       | b  d  ty |       y' = b*x + d*y + ty
+//
+// --Everything rendered is 2D, so this replaces a full mat4 (6 floats
+//   instead of 16) for model, view and projection transforms.
+////////////////////////////////////////////////////////////////////////////////
+struct Affine2D {
+
+    float a  = 1.0f;
+    float b  = 0.0f;
+    float c  = 0.0f;
+    float d  = 1.0f;
+    float tx = 0.0f;
+    float ty = 0.0f;
+
+    static Affine2D Identity() { return Affine2D{}; }
+    static Affine2D Translation(float x, float y);
+    static Affine2D Rotation(float radians);
+    static Affine2D Scale(float x, float y);
+
+    // translate * rotate * scale, the same order as EntityStore::ModelMatrix()
+    static Affine2D FromTRS(float x, float y, float radians, float scale_x, float scale_y);
+
+    // xy part of glm::ortho(left, right, bottom, top, near, far)
+    static Affine2D Ortho(float left, float right, float bottom, float top);
+
+    // xy part of a column-major 4x4 matrix that only acts in the z = 0 plane
+    static Affine2D FromMat4(const float* mat);
+
+    void ToMat4(float* out_mat) const;
+
+    void Apply(float x, float y, float& out_x, float& out_y) const {
+
+        out_x = a * x + c * y + tx;
+        out_y = b * x + d * y + ty;
+    }
+};
+
+static_assert(sizeof(Affine2D) == 6 * sizeof(float), "Affine2D must stay tightly packed");
+
+// lhs * rhs, i.e. rhs is applied first
+Affine2D operator*(const Affine2D& lhs, const Affine2D& rhs);
+
+// undoes transform; a singular transform (zero scale) maps everything to its origin
+Affine2D Inverse(const Affine2D& transform);
+
+// component-wise blend, close enough for the small change of one sim step
+Affine2D Lerp(const Affine2D& from, const Affine2D& to, float alpha);
+
+} // namespace Core
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Affine2D.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "Affine2D.hpp"
+#include "EntityStore.hpp"
+#include "UnitTest.hpp"
+
+#include <cmath>
+
+using namespace Core;
+
+TEST_CASE(FromTRSMatchesComposedTransforms) {
+
+    const Affine2D trs = Affine2D::FromTRS(10.0f, -5.0f, 0.7f, 2.0f, 3.0f);
+    const Affine2D composed = Affine2D::Translation(10.0f, -5.0f)
+                            * Affine2D::Rotation(0.7f)
+                            * Affine2D::Scale(2.0f, 3.0f);
+
+    CHECK_NEAR(trs.a,  composed.a,  1e-6f);
+    CHECK_NEAR(trs.b,  composed.b,  1e-6f);
+    CHECK_NEAR(trs.c,  composed.c,  1e-6f);
+    CHECK_NEAR(trs.d,  composed.d,  1e-6f);
+    CHECK_NEAR(trs.tx, composed.tx, 1e-6f);
+    CHECK_NEAR(trs.ty, composed.ty, 1e-6f);
+}
+
+TEST_CASE(MultiplyAppliesRightHandSideFirst) {
+
+    const Affine2D move = Affine2D::Translation(1.0f, 0.0f);
+    const Affine2D turn = Affine2D::Rotation(1.5707963f);
+
+    float x;
+    float y;
+
+    // rotate (1, 0) to (0, 1), then move to (1, 1)
+    (move * turn).Apply(1.0f, 0.0f, x, y);
+    CHECK_NEAR(x, 1.0f, 1e-6f);
+    CHECK_NEAR(y, 1.0f, 1e-6f);
+
+    // move (1, 0) to (2, 0), then rotate to (0, 2)
+    (turn * move).Apply(1.0f, 0.0f, x, y);
+    CHECK_NEAR(x, 0.0f, 1e-6f);
+    CHECK_NEAR(y, 2.0f, 1e-6f);
+}
+
+TEST_CASE(OrthoMapsBoundsToClipSpace) {
+
+    const Affine2D ortho = Affine2D::Ortho(-640.0f, 640.0f, -360.0f, 360.0f);
+
+    float x;
+    float y;
+
+    ortho.Apply(640.0f, -360.0f, x, y);
+    CHECK_NEAR(x,  1.0f, 1e-6f);
+    CHECK_NEAR(y, -1.0f, 1e-6f);
+
+    Affine2D::Ortho(0.0f, 100.0f, 0.0f, 50.0f).Apply(50.0f, 25.0f, x, y);
+    CHECK_NEAR(x, 0.0f, 1e-6f);
+    CHECK_NEAR(y, 0.0f, 1e-6f);
+}
+
+TEST_CASE(InverseUndoesTheTransform) {
+
+    const Affine2D transform = Affine2D::Ortho(-640.0f, 640.0f, -360.0f, 360.0f)
+                             * Affine2D::FromTRS(30.0f, -12.0f, 0.7f, 2.0f, 0.5f);
+
+    const Affine2D identity = Inverse(transform) * transform;
+
+    CHECK_NEAR(identity.a, 1.0f, 1e-5f);
+    CHECK_NEAR(identity.b, 0.0f, 1e-5f);
+    CHECK_NEAR(identity.c, 0.0f, 1e-5f);
+    CHECK_NEAR(identity.d, 1.0f, 1e-5f);
+    CHECK_NEAR(identity.tx, 0.0f, 1e-4f);
+    CHECK_NEAR(identity.ty, 0.0f, 1e-4f);
+}
+
+TEST_CASE(Mat4RoundTripMatchesEntityModelMatrix) {
+
+    EntityStore store;
+
+    EntityDesc desc;
+    desc.position_x = 12.0f;
+    desc.position_y = -4.0f;
+    desc.rotation = 2.5f;
+    desc.scale_x = 0.5f;
+    desc.scale_y = 1.5f;
+
+    store.Create(desc);
+
+    float entity_mat[16];
+    float affine_mat[16];
+
+    store.ModelMatrix(0, entity_mat);
+    Affine2D::FromTRS(12.0f, -4.0f, 2.5f, 0.5f, 1.5f).ToMat4(affine_mat);
+
+    for (int i = 0; i < 16; ++i) {
+
+        CHECK_NEAR(entity_mat[i], affine_mat[i], 1e-6f);
+    }
+
+    const Affine2D round_trip = Affine2D::FromMat4(affine_mat);
+    CHECK_NEAR(round_trip.c, -std::sin(2.5f) * 1.5f, 1e-6f);
+    CHECK_NEAR(round_trip.tx, 12.0f, 1e-6f);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: AllocationCounter.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "AllocationCounter.hpp"
+#include "BatchRenderer.hpp"
+#include "Benchmark.hpp"
+#include "DrawList.hpp"
+#include "InstanceBuilder.hpp"
+#include "JobSystem.hpp"
+#include "Models.hpp"
+#include "RecordingRenderDevice.hpp"
+#include "SoftwareRenderDevice.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+using namespace Core;
+
+#define ENTITY_COUNT    10000
+#define WARMUP_FRAMES   60      // capacities settle, workers register
+#define STEADY_FRAMES   100     // per timed run, must not allocate
+#define TARGET_WIDTH    640
+#define TARGET_HEIGHT   360
+
+////////////////////////////////////////////////////////////////////////////////
+// Steady-State Frame Allocations
+// --Runs the template's two draw paths, batched instances and a sorted draw
+//   list, on the recording and software devices. After warming up, not one
+//   frame may touch the heap; the benchmark exits with 1 if any does.
+////////////////////////////////////////////////////////////////////////////////
+template<typename Frame>
+static bool RunSteadyFrames(const char* name, std::size_t items, Frame&& frame) {
+
+    for (int i = 0; i < WARMUP_FRAMES; ++i) {
+
+        frame();
+    }
+
+    AllocationStats allocated;
+
+    Bench::Run(name, items * STEADY_FRAMES, [&]() {
+
+        AllocationScope scope;
+
+        for (int i = 0; i < STEADY_FRAMES; ++i) {
+
+            frame();
+        }
+
+        const AllocationStats delta = scope.Delta();
+        allocated.allocations += delta.allocations;
+        allocated.bytes += delta.bytes;
+    });
+
+    std::printf("  %llu allocations, %llu bytes in steady-state frames\n",
+                static_cast<unsigned long long>(allocated.allocations),
+                static_cast<unsigned long long>(allocated.bytes));
+
+    return allocated.allocations == 0;
+}
+
+static bool RunDevice(RecordingRenderDevice& device, const EntityStore& store, JobSystem& jobs,
+                      const char* batched_name, const char* sorted_name) {
+
+    MeshRegistry meshes;
+    meshes.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    meshes.Register(BuildIndexedMesh(hexagon_vertices.data(), hexagon_vertices.size()));
+    meshes.Register(BuildIndexedMesh(circle_vertices.data(), circle_vertices.size()));
+    meshes.Upload(device);
+
+    const ProgramId instanced_program = device.CreateProgram("vs", "fs");
+    const ProgramId line_program = device.CreateProgram("vs", "fs");
+
+    const Affine2D view_proj = Affine2D::Ortho(-TARGET_WIDTH / 2.0f, TARGET_WIDTH / 2.0f,
+                                               -TARGET_HEIGHT / 2.0f, TARGET_HEIGHT / 2.0f);
+
+    InstanceBuilder builder;
+    BatchRenderer batch;
+    batch.Init(device, instanced_program, meshes, 1024);
+
+    bool steady = RunSteadyFrames(batched_name, store.Size(), [&]() {
+
+        device.BeginFrame();
+        batch.Begin();
+        builder.Build(jobs, store, meshes, view_proj, batch, 0.5f);
+        jobs.WaitAll();
+        batch.Flush();
+        device.EndFrame();
+    });
+
+    DrawList draws;
+
+    steady &= RunSteadyFrames(sorted_name, store.Size(), [&]() {
+
+        device.BeginFrame();
+        draws.Clear();
+
+        for (std::uint32_t i = 0; i < store.Size(); ++i) {
+
+            DrawCommand command;
+            command.program = line_program;
+            command.mesh = store.Meshes()[i];
+            command.color = store.Colors()[i];
+
+            (view_proj * Affine2D::Translation(store.PositionX()[i], store.PositionY()[i])).ToMat4(command.model_mat);
+            draws.Add(0, command);
+        }
+
+        draws.Sort();
+        draws.Submit(meshes, device);
+        device.EndFrame();
+    });
+
+    batch.Shutdown();
+
+    return steady;
+}
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : ENTITY_COUNT;
+
+    if (!AllocationTrackingEnabled()) {
+
+        std::printf("built with ALLOCATION_TRACKING 0, nothing to check\n");
+        return 0;
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-TARGET_WIDTH, TARGET_WIDTH);
+    std::uniform_real_distribution<float> shade(0.0f, 1.0f);
+
+    EntityStore store;
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        EntityDesc desc;
+        desc.position_x = position(rng);
+        desc.position_y = position(rng);
+        desc.scale_x = desc.scale_y = 8.0f;
+        desc.color = Color{shade(rng), shade(rng), 1.0f, 1.0f};
+        desc.mesh = static_cast<MeshId>(i % 3);
+        store.Create(desc);
+    }
+
+    JobSystem jobs;
+
+    std::printf("%zu entities, %u workers\n", count, jobs.WorkerCount());
+
+    RecordingRenderDevice recording;
+    bool steady = RunDevice(recording, store, jobs, "recording, batched", "recording, sorted draws");
+
+    SoftwareRenderDevice software(TARGET_WIDTH, TARGET_HEIGHT, &jobs);
+    steady &= RunDevice(software, store, jobs, "software, batched", "software, sorted draws");
+
+    if (!steady) {
+
+        std::printf("FAILED: steady-state frames allocated\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: AllocationCounter.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace Core {
+
+// constant-initialized, so counting works for allocations made before main()
+static std::atomic<std::uint64_t> allocation_count{0};
+static std::atomic<std::uint64_t> free_count{0};
+static std::atomic<std::uint64_t> allocated_bytes{0};
+
+bool AllocationTrackingEnabled() {
+
+    return ALLOCATION_TRACKING != 0;
+}
+
+AllocationStats AllocationCounts() {
+
+    AllocationStats stats;
+    stats.allocations = allocation_count.load(std::memory_order_relaxed);
+    stats.frees = free_count.load(std::memory_order_relaxed);
+    stats.bytes = allocated_bytes.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+} // namespace Core
+
+#if ALLOCATION_TRACKING
+
+////////////////////////////////////////////////////////////////////////////////
+// Replacement Operator New and Delete
+// --The array, nothrow and sized forms all end up in these; an alignment of
+//   zero means the default heap.
+// --The aligned forms use aligned_alloc, which free() releases as well; MSVC
+//   has no aligned_alloc, so there they pair _aligned_malloc with
+//   _aligned_free instead.
+////////////////////////////////////////////////////////////////////////////////
+static void* CountedAllocate(std::size_t size, std::size_t alignment) {
+
+    Core::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    Core::allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (size == 0) {
+
+        size = 1;
+    }
+
+    while (true) {
+
+        void* pointer = nullptr;
+
+#ifdef _WIN32
+        if (alignment == 0) {
+
+            pointer = std::malloc(size);
+        }
+        else {
+
+            // every aligned form goes here, as the aligned deletes use _aligned_free
+            pointer = _aligned_malloc(size, alignment);
+        }
+#else
+        if (alignment <= alignof(std::max_align_t)) {
+
+            pointer = std::malloc(size);
+        }
+        else {
+
+            // aligned_alloc wants a multiple of the alignment
+            pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+        }
+#endif
+
+        if (pointer) {
+
+            return pointer;
+        }
+
+        std::new_handler handler = std::get_new_handler();
+
+        if (!handler) {
+
+            throw std::bad_alloc();
+        }
+
+        handler();
+    }
+}
+
+static void CountedFree(void* pointer) noexcept {
+
+    if (pointer) {
+
+        Core::free_count.fetch_add(1, std::memory_order_relaxed);
+        std::free(pointer);
+    }
+}
+
+static void CountedAlignedFree(void* pointer) noexcept {
+
+    if (pointer) {
+
+        Core::free_count.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+}
+
+void* operator new(std::size_t size) {
+
+    return CountedAllocate(size, 0);
+}
+
+void* operator new[](std::size_t size) {
+
+    return CountedAllocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+
+    try {
+
+        return CountedAllocate(size, 0);
+    }
+    catch (...) {
+
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+
+    try {
+
+        return CountedAllocate(size, 0);
+    }
+    catch (...) {
+
+        return nullptr;
+    }
+}
+
+void operator delete(void* pointer) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { CountedAlignedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { CountedAlignedFree(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { CountedAlignedFree(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { CountedAlignedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { CountedFree(pointer); }
+
+#endif
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: AllocationCounter.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// set to 0 to keep the standard operator new and delete (counts stay 0)
+#ifndef ALLOCATION_TRACKING
+#define ALLOCATION_TRACKING         1
+#endif
+
+namespace Core {
+
+struct AllocationStats {
+
+    std::uint64_t allocations = 0;  // operator new calls, every form
+    std::uint64_t frees = 0;        // operator delete calls with a pointer
+    std::uint64_t bytes = 0;        // requested by those allocations
+
+    AllocationStats operator-(const AllocationStats& start) const {
+
+        return {allocations - start.allocations, frees - start.frees, bytes - start.bytes};
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Allocation Counter
+// --Core replaces the global operator new and delete with ones that count
+//   every heap allocation of the program, on every thread, before calling
+//   malloc and free. Counting is one relaxed atomic add per call.
+// --Meant for asserting that a steady-state frame does not touch the heap:
+//   take an AllocationScope around the frame and check Delta() is zero.
+// --Allocations made with malloc directly are not seen.
+////////////////////////////////////////////////////////////////////////////////
+bool AllocationTrackingEnabled();
+
+// totals since the program started
+AllocationStats AllocationCounts();
+
+class AllocationScope {
+
+public:
+    AllocationScope() : start(AllocationCounts()) {}
+
+    // since construction, by every thread
+    AllocationStats Delta() const { return AllocationCounts() - start; }
+
+private:
+    AllocationStats start;
+};
+
+} // namespace Core
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: AllocationCounter.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "AllocationCounter.hpp"
+#include "UnitTest.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Core;
+
+struct alignas(64) CacheLine {
+
+    std::uint8_t bytes[64];
+};
+
+// new and delete pairs the compiler can see through may be left out entirely
+static void* volatile escaped;
+
+template<typename T>
+static T* Escape(T* pointer) {
+
+    escaped = pointer;
+    return pointer;
+}
+
+TEST_CASE(EveryFormOfNewIsCounted) {
+
+    if (!AllocationTrackingEnabled()) {
+
+        return;
+    }
+
+    AllocationScope scope;
+
+    int* single = Escape(new int(7));
+    int* array = Escape(new int[16]);
+    CacheLine* aligned = Escape(new CacheLine);
+    int* nothrow = Escape(new (std::nothrow) int(3));
+
+    CHECK(reinterpret_cast<std::uintptr_t>(aligned) % 64 == 0);
+
+    const AllocationStats allocated = scope.Delta();
+
+    CHECK(allocated.allocations == 4);
+    CHECK(allocated.frees == 0);
+    CHECK(allocated.bytes >= 2 * sizeof(int) + 16 * sizeof(int) + sizeof(CacheLine));
+
+    delete single;
+    delete[] array;
+    delete aligned;
+    delete nothrow;
+
+    CHECK(scope.Delta().frees == 4);
+}
+
+TEST_CASE(ReusedCapacityIsFree) {
+
+    if (!AllocationTrackingEnabled()) {
+
+        return;
+    }
+
+    std::vector<float> values;
+    values.reserve(1024);
+
+    AllocationScope scope;
+
+    for (int frame = 0; frame < 10; ++frame) {
+
+        values.clear();
+        values.resize(1024, 1.0f);
+    }
+
+    CHECK(scope.Delta().allocations == 0);
+
+    Escape(std::make_unique<std::vector<float>>(values).get());
+
+    CHECK(scope.Delta().allocations == 2);
+}
+
+int main() { return Core::Test::RunAll(); }
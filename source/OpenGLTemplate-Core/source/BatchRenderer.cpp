@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: BatchRenderer.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "BatchRenderer.hpp"
+
+#include <cstring>
+
+namespace Core {
+
+void BatchRenderer::Init(RenderDevice& target, ProgramId program, const MeshRegistry& registry,
+                         std::size_t initial_capacity) {
+
+    device = &target;
+    shader_program = program;
+    meshes = &registry;
+
+    instance_buffer = device->CreateBuffer(BufferTarget::Vertex, 0, nullptr, BufferUsage::Stream);
+    Reserve(initial_capacity);
+
+    PointInstanceAttributes(0);
+}
+
+void BatchRenderer::Shutdown() {
+
+    if (device) {
+
+        device->DestroyBuffer(instance_buffer);
+    }
+
+    instance_buffer = 0;
+    instance_capacity = 0;
+    batches.clear();
+}
+
+void BatchRenderer::Begin() {
+
+    Reset(meshes->MeshCount());
+}
+
+void BatchRenderer::Reset(std::size_t mesh_count) {
+
+    batches.resize(mesh_count);
+
+    for (auto& batch : batches) {
+
+        batch.clear();
+    }
+
+    stats = BatchStats{};
+}
+
+void BatchRenderer::Submit(MeshId mesh, const Affine2D& transform, const float* color_vec) {
+
+    InstanceData& instance = batches[mesh].emplace_back();
+
+    instance.transform = transform;
+    std::memcpy(instance.color_vec, color_vec, sizeof(instance.color_vec));
+}
+
+InstanceData* BatchRenderer::Allocate(MeshId mesh, std::size_t count) {
+
+    std::vector<InstanceData>& batch = batches[mesh];
+
+    const std::size_t first = batch.size();
+    batch.resize(first + count);
+
+    return batch.data() + first;
+}
+
+void BatchRenderer::Flush(const BatchRenderer& collected) {
+
+    std::size_t total_instances = 0;
+
+    for (const auto& batch : collected.batches) {
+
+        total_instances += batch.size();
+    }
+
+    if (total_instances == 0) {
+
+        return;
+    }
+
+    Reserve(total_instances);
+
+    device->UseProgram(shader_program);
+    meshes->Bind();
+
+    // orphan last frame's storage so the upload never waits on in-flight draws
+    device->ReallocateBuffer(instance_buffer, instance_capacity * sizeof(InstanceData));
+
+    std::size_t first_instance = 0;
+
+    for (MeshId mesh = 0; mesh < collected.batches.size(); ++mesh) {
+
+        const std::size_t count = collected.batches[mesh].size();
+
+        if (count == 0) {
+
+            continue;
+        }
+
+        const std::size_t offset = first_instance * sizeof(InstanceData);
+
+        device->UploadBuffer(instance_buffer, offset, count * sizeof(InstanceData),
+                             collected.batches[mesh].data());
+
+        // GL 3.3 has no base instance, so point the instance attributes at
+        // this mesh's slice of the shared instance buffer
+        PointInstanceAttributes(offset);
+
+        meshes->DrawInstanced(mesh, static_cast<int>(count));
+
+        first_instance += count;
+        stats.draw_calls += 1;
+        stats.instances += count;
+    }
+}
+
+void BatchRenderer::PointInstanceAttributes(std::size_t offset) {
+
+    VertexAttribute attribute;
+    attribute.buffer = instance_buffer;
+    attribute.format = AttributeFormat::Float;
+    attribute.stride = sizeof(InstanceData);
+    attribute.divisor = 1;
+
+    for (unsigned int column = 0; column < 3; ++column) {
+
+        attribute.location = 1 + column;
+        attribute.components = 2;
+        attribute.offset = offset + column * 2 * sizeof(float);
+
+        device->SetVertexAttribute(meshes->VertexArray(), attribute);
+    }
+
+    attribute.location = 4;
+    attribute.components = 4;
+    attribute.offset = offset + offsetof(InstanceData, color_vec);
+
+    device->SetVertexAttribute(meshes->VertexArray(), attribute);
+}
+
+void BatchRenderer::Reserve(std::size_t instance_count) {
+
+    if (instance_count <= instance_capacity && instance_capacity != 0) {
+
+        return;
+    }
+
+    std::size_t new_capacity = instance_capacity ? instance_capacity : 1024;
+
+    while (new_capacity < instance_count) {
+
+        new_capacity *= 2;
+    }
+
+    instance_capacity = new_capacity;
+
+    device->ReallocateBuffer(instance_buffer, instance_capacity * sizeof(InstanceData));
+}
+
+} // namespace Core
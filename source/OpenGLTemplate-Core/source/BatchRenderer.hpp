@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: BatchRenderer.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Affine2D.hpp"
+#include "MeshRegistry.hpp"
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Instance Layout
+// --Matches the instanced vertex shader inputs: the affine transform's three
+//   vec2 columns at locations 1-3 and vec4 color at location 4.
+////////////////////////////////////////////////////////////////////////////////
+struct InstanceData {
+
+    Affine2D transform;
+    float color_vec[4];
+};
+
+static_assert(sizeof(InstanceData) == 40, "InstanceData must match the instanced shader");
+
+struct BatchStats {
+
+    std::size_t draw_calls = 0;
+    std::size_t instances  = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Batch Renderer
+// --Collects instances per mesh during a frame and draws every instance of a
+//   mesh with a single instanced draw call on Flush().
+// --Instance attributes are added to the mesh registry's shared vertex array.
+// --Transforms are submitted in clip space, i.e. projection and view are
+//   already composed in (see TransformBatch).
+////////////////////////////////////////////////////////////////////////////////
+class BatchRenderer {
+
+public:
+    void Init(RenderDevice& device, ProgramId program, const MeshRegistry& registry,
+              std::size_t initial_capacity);
+    void Shutdown();
+
+    void Begin();
+
+    // clears the per-mesh instance lists without touching the device, Begin() calls
+    // this with the registry's mesh count
+    void Reset(std::size_t mesh_count);
+    void Submit(MeshId mesh, const Affine2D& transform, const float* color_vec);
+
+    // appends count instances to a mesh's batch and returns the first one;
+    // call from one thread at a time, the returned slots may be filled by any
+    InstanceData* Allocate(MeshId mesh, std::size_t count);
+    void Flush() { Flush(*this); }
+
+    // draws the instances another renderer collected, e.g. a CPU-only one
+    // (never Init, filled after Reset) handed over from another thread
+    void Flush(const BatchRenderer& collected);
+
+    const BatchStats& Stats() const { return stats; }
+    std::size_t MeshCount() const { return batches.size(); }
+    const std::vector<InstanceData>& Instances(MeshId mesh) const { return batches[mesh]; }
+
+private:
+    void Reserve(std::size_t instance_count);
+    void PointInstanceAttributes(std::size_t offset);
+
+    std::vector<std::vector<InstanceData>> batches;     // indexed by MeshId
+
+    RenderDevice* device = nullptr;
+    const MeshRegistry* meshes = nullptr;
+    ProgramId shader_program{};
+
+    BufferId instance_buffer{};
+    std::size_t instance_capacity{};
+
+    BatchStats stats;
+};
+
+} // namespace Core
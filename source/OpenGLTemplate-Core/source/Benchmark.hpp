@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Benchmark.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Minimal Benchmark Harness
+// --Each *.bench.cpp is its own executable (<Name>_Bench) built with
+//   BUILD_BENCHMARKS. Run them from a release build.
+// --Run() times a callable several times and reports the fastest run,
+//   normalized per item.
+////////////////////////////////////////////////////////////////////////////////
+namespace Core::Bench {
+
+using Clock = std::chrono::steady_clock;
+
+// keeps the optimizer from discarding a computed value
+template<typename T>
+inline void DoNotOptimize(const T& value) {
+
+#ifdef _MSC_VER
+    // no inline asm on MSVC: publish the address and fence the compiler
+    static const volatile void* volatile sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+template<typename Function>
+double Run(const char* name, std::size_t items, Function&& function, int repetitions = 5) {
+
+    std::vector<double> seconds;
+
+    for (int i = 0; i < repetitions; ++i) {
+
+        auto start = Clock::now();
+        function();
+        seconds.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+    }
+
+    const double best = *std::min_element(seconds.begin(), seconds.end());
+
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(3) << best * 1e3 << " ms"
+              << std::setw(12) << std::setprecision(2) << best * 1e9 / items << " ns/item"
+              << std::endl;
+
+    return best;
+}
+
+} // namespace Core::Bench
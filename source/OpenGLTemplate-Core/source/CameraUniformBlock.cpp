@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: CameraUniformBlock.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "CameraUniformBlock.hpp"
+
+#include <cstring>
+
+namespace Core {
+
+static constexpr float IDENTITY_MAT[16] = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f,
+};
+
+CameraUniformBlock::CameraUniformBlock() {
+
+    std::memcpy(data.proj_mat, IDENTITY_MAT, sizeof(IDENTITY_MAT));
+    std::memcpy(data.view_mat, IDENTITY_MAT, sizeof(IDENTITY_MAT));
+}
+
+void CameraUniformBlock::SetProjection(const float* proj_mat) {
+
+    if (std::memcmp(data.proj_mat, proj_mat, sizeof(data.proj_mat)) != 0) {
+
+        std::memcpy(data.proj_mat, proj_mat, sizeof(data.proj_mat));
+        dirty = true;
+    }
+}
+
+void CameraUniformBlock::SetView(const float* view_mat) {
+
+    if (std::memcmp(data.view_mat, view_mat, sizeof(data.view_mat)) != 0) {
+
+        std::memcpy(data.view_mat, view_mat, sizeof(data.view_mat));
+        dirty = true;
+    }
+}
+
+bool CameraUniformBlock::ConsumeDirty() {
+
+    const bool was_dirty = dirty;
+    dirty = false;
+    return was_dirty;
+}
+
+} // namespace Core
@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: CameraUniformBlock.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+
+#define CAMERA_BLOCK_BINDING    0   // uniform buffer binding point of "Camera"
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Camera Block Layout
+// --std140 layout of the shader's "Camera" uniform block.
+////////////////////////////////////////////////////////////////////////////////
+struct CameraBlockData {
+
+    float proj_mat[16];
+    float view_mat[16];
+};
+
+static_assert(sizeof(CameraBlockData) == 128, "Camera block must match std140 layout");
+
+////////////////////////////////////////////////////////////////////////////////
+// Camera Uniform Block
+// --CPU copy of the camera block with dirty tracking, so the buffer is only
+//   uploaded on frames where the projection or view actually changed.
+////////////////////////////////////////////////////////////////////////////////
+class CameraUniformBlock {
+
+public:
+    CameraUniformBlock();
+
+    void SetProjection(const float* proj_mat);
+    void SetView(const float* view_mat);
+
+    bool IsDirty() const { return dirty; }
+
+    // returns true once per change, the caller uploads Data() when it does
+    bool ConsumeDirty();
+
+    const CameraBlockData& Data() const { return data; }
+    static constexpr std::size_t Size() { return sizeof(CameraBlockData); }
+
+private:
+    CameraBlockData data;
+    bool dirty = true;
+};
+
+} // namespace Core
@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: CameraUniformBlock.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "CameraUniformBlock.hpp"
+#include "UnitTest.hpp"
+
+#include <cstddef>
+
+using namespace Core;
+
+static void MakeMatrix(float* out, float diagonal, float tx) {
+
+    for (int i = 0; i < 16; ++i) {
+
+        out[i] = (i % 5 == 0) ? diagonal : 0.0f;
+    }
+
+    out[15] = 1.0f;
+    out[12] = tx;
+}
+
+TEST_CASE(NewBlockIsDirtyOnce) {
+
+    CameraUniformBlock block;
+
+    CHECK(block.IsDirty());
+    CHECK(block.ConsumeDirty());
+    CHECK(!block.IsDirty());
+    CHECK(!block.ConsumeDirty());
+}
+
+TEST_CASE(SettingSameValuesKeepsBlockClean) {
+
+    CameraUniformBlock block;
+    float proj[16];
+    float view[16];
+    MakeMatrix(proj, 0.5f, 0.0f);
+    MakeMatrix(view, 1.0f, 10.0f);
+
+    block.SetProjection(proj);
+    block.SetView(view);
+    CHECK(block.ConsumeDirty());
+
+    block.SetProjection(proj);
+    block.SetView(view);
+    CHECK(!block.IsDirty());
+}
+
+TEST_CASE(ChangingViewOrProjectionMarksDirty) {
+
+    CameraUniformBlock block;
+    float mat[16];
+    block.ConsumeDirty();
+
+    MakeMatrix(mat, 1.0f, 5.0f);
+    block.SetView(mat);
+    CHECK(block.ConsumeDirty());
+    CHECK(block.Data().view_mat[12] == 5.0f);
+
+    MakeMatrix(mat, 2.0f, 0.0f);
+    block.SetProjection(mat);
+    CHECK(block.ConsumeDirty());
+    CHECK(block.Data().proj_mat[0] == 2.0f);
+}
+
+TEST_CASE(LayoutMatchesStd140) {
+
+    CHECK(CameraUniformBlock::Size() == 128);
+    CHECK(offsetof(CameraBlockData, proj_mat) == 0);
+    CHECK(offsetof(CameraBlockData, view_mat) == 64);
+}
+
+int main() { return Core::Test::RunAll(); }
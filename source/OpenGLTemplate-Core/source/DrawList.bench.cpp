@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: DrawList.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "DrawList.hpp"
+#include "Affine2D.hpp"
+#include "Benchmark.hpp"
+#include "Models.hpp"
+#include "RecordingRenderDevice.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+#define DRAW_COUNT      20000
+#define MESH_COUNT      64
+#define PROGRAM_COUNT   2
+#define COLOR_COUNT     8
+
+constexpr NameHash U_MODEL_MAT = HashName("u_Model_mat");
+constexpr NameHash U_COLOR_VEC = HashName("u_Color_vec");
+
+static void PrintStateChanges(const char* name, const RenderDevice& device) {
+
+    const RenderDeviceStats& stats = device.FrameStats();
+
+    std::printf("  %-30s %zu draw calls, %zu state changes (%zu program binds, %zu uniform sets)\n",
+                name, stats.draw_calls, stats.StateChanges(), stats.program_binds, stats.uniform_sets);
+}
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : DRAW_COUNT;
+
+    RecordingRenderDevice device;
+    MeshRegistry meshes;
+
+    const IndexedMesh models[] = {
+        BuildIndexedMesh(square_vertices.data(), square_vertices.size()),
+        BuildIndexedMesh(triangle_vertices.data(), triangle_vertices.size()),
+        BuildIndexedMesh(hexagon_vertices.data(), hexagon_vertices.size()),
+        BuildIndexedMesh(circle_vertices.data(), circle_vertices.size()),
+    };
+
+    for (int mesh = 0; mesh < MESH_COUNT; ++mesh) {
+
+        meshes.Register(models[mesh % 4]);
+    }
+
+    meshes.Upload(device);
+
+    std::vector<ProgramId> programs;
+
+    for (int program = 0; program < PROGRAM_COUNT; ++program) {
+
+        programs.push_back(device.CreateProgram("vs", "fs"));
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> program_dist(0, PROGRAM_COUNT - 1);
+    std::uniform_int_distribution<MeshId> mesh_dist(0, MESH_COUNT - 1);
+    std::uniform_int_distribution<int> color_dist(0, COLOR_COUNT - 1);
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+
+    // every draw has its own transform, colors come from a small palette
+    std::vector<DrawCommand> commands(count);
+
+    for (DrawCommand& command : commands) {
+
+        const float shade = static_cast<float>(color_dist(rng)) / (COLOR_COUNT - 1);
+
+        command.program = programs[program_dist(rng)];
+        command.mesh = mesh_dist(rng);
+        command.color = Color{shade, 1.0f - shade, 0.5f, 1.0f};
+
+        Affine2D::Translation(position(rng), position(rng)).ToMat4(command.model_mat);
+    }
+
+    std::printf("%zu draws, %d meshes, %d programs, %d colors\n", count, MESH_COUNT, PROGRAM_COUNT, COLOR_COUNT);
+
+    Bench::Run("source order, every uniform", count, [&]() {
+
+        device.BeginFrame();
+        meshes.Bind();
+
+        for (const DrawCommand& command : commands) {
+
+            device.UseProgram(command.program);
+            device.SetUniform(U_MODEL_MAT, UniformType::Mat4, command.model_mat);
+            device.SetUniform(U_COLOR_VEC, UniformType::Vec4, &command.color.r);
+            meshes.Draw(command.mesh);
+        }
+    });
+
+    PrintStateChanges("source order", device);
+
+    DrawList list;
+    list.Reserve(count);
+
+    Bench::Run("draw list, unsorted", count, [&]() {
+
+        list.Clear();
+
+        for (const DrawCommand& command : commands) {
+
+            list.Add(0, command);
+        }
+
+        device.BeginFrame();
+        list.Submit(meshes, device);
+    });
+
+    PrintStateChanges("unsorted", device);
+
+    Bench::Run("draw list, radix sorted", count, [&]() {
+
+        list.Clear();
+
+        for (const DrawCommand& command : commands) {
+
+            list.Add(0, command);
+        }
+
+        list.Sort();
+
+        device.BeginFrame();
+        list.Submit(meshes, device);
+    });
+
+    PrintStateChanges("sorted", device);
+
+    std::printf("  %zu uniform sets skipped, %zu program binds skipped\n",
+                list.Stats().skipped_uniforms, list.Stats().skipped_binds);
+
+    // the sort alone, against a comparison sort of the same keys
+    Bench::Run("radix sort only", count, [&]() {
+
+        list.Sort();
+    });
+
+    std::vector<std::uint64_t> keys(count);
+    std::vector<std::uint32_t> order(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        keys[i] = DrawList::MakeKey(0, commands[i].program, commands[i].mesh, commands[i].color);
+    }
+
+    Bench::Run("std::stable_sort only", count, [&]() {
+
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&keys](std::uint32_t lhs, std::uint32_t rhs) {
+
+            return keys[lhs] < keys[rhs];
+        });
+
+        Bench::DoNotOptimize(order.front());
+    });
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: DrawList.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "DrawList.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Core {
+
+static_assert(DRAW_KEY_LAYER_BITS + DRAW_KEY_PROGRAM_BITS + DRAW_KEY_MESH_BITS + DRAW_KEY_MATERIAL_BITS == 64,
+              "Draw key fields must fill 64 bits");
+static_assert(64 % DRAW_SORT_RADIX_BITS == 0, "Radix passes must cover the key");
+
+static constexpr NameHash U_MODEL_MAT = HashName("u_Model_mat");
+static constexpr NameHash U_COLOR_VEC = HashName("u_Color_vec");
+
+static std::uint64_t KeyField(std::uint64_t value, int bits) {
+
+    return value & ((std::uint64_t{1} << bits) - 1);
+}
+
+static std::uint64_t QuantizeChannel(float value) {
+
+    return static_cast<std::uint64_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+std::uint64_t DrawList::MakeKey(std::uint32_t layer, ProgramId program, MeshId mesh, const Color& color) {
+
+    const std::uint64_t material = QuantizeChannel(color.r) << 24 | QuantizeChannel(color.g) << 16 |
+                                   QuantizeChannel(color.b) << 8 | QuantizeChannel(color.a);
+
+    std::uint64_t key = KeyField(layer, DRAW_KEY_LAYER_BITS);
+    key = key << DRAW_KEY_PROGRAM_BITS | KeyField(program, DRAW_KEY_PROGRAM_BITS);
+    key = key << DRAW_KEY_MESH_BITS | KeyField(mesh, DRAW_KEY_MESH_BITS);
+    key = key << DRAW_KEY_MATERIAL_BITS | KeyField(material, DRAW_KEY_MATERIAL_BITS);
+
+    return key;
+}
+
+void DrawList::Clear() {
+
+    commands.clear();
+    keys.clear();
+    order.clear();
+}
+
+void DrawList::Reserve(std::size_t count) {
+
+    commands.reserve(count);
+    keys.reserve(count);
+    order.reserve(count);
+    scratch.reserve(count);
+}
+
+void DrawList::Add(std::uint32_t layer, const DrawCommand& command) {
+
+    order.push_back(static_cast<std::uint32_t>(commands.size()));
+    keys.push_back(MakeKey(layer, command.program, command.mesh, command.color));
+    commands.push_back(command);
+}
+
+void DrawList::Sort() {
+
+    constexpr std::size_t radix = std::size_t{1} << DRAW_SORT_RADIX_BITS;
+    constexpr std::uint64_t digit_mask = radix - 1;
+
+    const std::size_t count = order.size();
+
+    if (count < 2) {
+
+        return;
+    }
+
+    // bits that differ between any two keys; passes over the rest are no-ops
+    std::uint64_t varying = 0;
+
+    for (std::uint64_t key : keys) {
+
+        varying |= key ^ keys[0];
+    }
+
+    // stable from any starting order, so start from Add() order
+    for (std::size_t i = 0; i < count; ++i) {
+
+        order[i] = static_cast<std::uint32_t>(i);
+    }
+
+    scratch.resize(count);
+
+    std::size_t offsets[radix];
+
+    for (int shift = 0; shift < 64; shift += DRAW_SORT_RADIX_BITS) {
+
+        if (((varying >> shift) & digit_mask) == 0) {
+
+            continue;
+        }
+
+        std::fill(offsets, offsets + radix, 0);
+
+        for (std::uint32_t index : order) {
+
+            offsets[(keys[index] >> shift) & digit_mask] += 1;
+        }
+
+        std::size_t total = 0;
+
+        for (std::size_t digit = 0; digit < radix; ++digit) {
+
+            const std::size_t digit_count = offsets[digit];
+            offsets[digit] = total;
+            total += digit_count;
+        }
+
+        for (std::uint32_t index : order) {
+
+            scratch[offsets[(keys[index] >> shift) & digit_mask]++] = index;
+        }
+
+        order.swap(scratch);
+    }
+}
+
+void DrawList::Submit(const MeshRegistry& meshes, RenderDevice& device) {
+
+    stats = DrawListStats{};
+    stats.draws = commands.size();
+
+    if (commands.empty()) {
+
+        return;
+    }
+
+    meshes.Bind();
+
+    // nothing is known about a program's uniforms until this list sets them
+    const DrawCommand* previous = nullptr;
+
+    for (std::size_t i = 0; i < order.size(); ++i) {
+
+        const DrawCommand& command = At(i);
+
+        if (!previous || command.program != previous->program) {
+
+            device.UseProgram(command.program);
+            stats.program_binds += 1;
+            previous = nullptr;
+        }
+        else {
+
+            stats.skipped_binds += 1;
+        }
+
+        if (!previous || std::memcmp(command.model_mat, previous->model_mat, sizeof(command.model_mat)) != 0) {
+
+            device.SetUniform(U_MODEL_MAT, UniformType::Mat4, command.model_mat);
+            stats.uniform_sets += 1;
+        }
+        else {
+
+            stats.skipped_uniforms += 1;
+        }
+
+        if (!previous || std::memcmp(&command.color, &previous->color, sizeof(Color)) != 0) {
+
+            device.SetUniform(U_COLOR_VEC, UniformType::Vec4, &command.color.r);
+            stats.uniform_sets += 1;
+        }
+        else {
+
+            stats.skipped_uniforms += 1;
+        }
+
+        meshes.Draw(command.mesh);
+        previous = &command;
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: DrawList.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "EntityStore.hpp"
+#include "MeshRegistry.hpp"
+#include "RenderDevice.hpp"
+
+#define DRAW_KEY_LAYER_BITS     8   // most significant: layers draw in order
+#define DRAW_KEY_PROGRAM_BITS   8
+#define DRAW_KEY_MESH_BITS      16
+#define DRAW_KEY_MATERIAL_BITS  32  // least significant: the color as RGBA8
+
+#define DRAW_SORT_RADIX_BITS    8   // key bits sorted per radix pass
+
+namespace Core {
+
+// one draw of the line program: a mesh with a model matrix and color
+struct DrawCommand {
+
+    ProgramId program = 0;
+    MeshId mesh = 0;
+    float model_mat[16];
+    Color color;
+};
+
+struct DrawListStats {
+
+    std::size_t draws = 0;
+    std::size_t program_binds = 0;      // issued by Submit()
+    std::size_t uniform_sets = 0;
+    std::size_t skipped_binds = 0;      // redundant with the previous draw
+    std::size_t skipped_uniforms = 0;
+
+    std::size_t StateChanges() const { return program_binds + uniform_sets; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Draw List
+// --Collects a frame's draws, each with a 64-bit sort key of layer,
+//   program, mesh and material (color), most significant first. Sort()
+//   orders them with an LSD radix sort, so draws that share a program, mesh
+//   and color end up next to each other.
+// --Submit() draws in that order and only binds the program and sets the
+//   model and color uniforms when they differ from the previous draw.
+// --Layers keep their order, e.g. a layer above the rest for something that
+//   must be drawn on top. Within a layer the order is by state, not by
+//   Add(); equal keys keep their Add() order.
+// --Fields wider than their key bits are truncated in the key only: draws
+//   still submit correctly, they just sort together.
+////////////////////////////////////////////////////////////////////////////////
+class DrawList {
+
+public:
+    static std::uint64_t MakeKey(std::uint32_t layer, ProgramId program, MeshId mesh, const Color& color);
+
+    void Clear();
+    void Reserve(std::size_t count);
+
+    void Add(std::uint32_t layer, const DrawCommand& command);
+
+    // radix sorts by key; passes over bytes every key shares are skipped
+    void Sort();
+
+    // in sorted order; draws added after the last Sort() follow in Add() order
+    void Submit(const MeshRegistry& meshes, RenderDevice& device);
+
+    std::size_t Size() const { return commands.size(); }
+    bool Empty() const { return commands.empty(); }
+
+    // the i-th command in submit order and its key
+    const DrawCommand& At(std::size_t i) const { return commands[order[i]]; }
+    std::uint64_t KeyAt(std::size_t i) const { return keys[order[i]]; }
+
+    // counted by the last Submit()
+    const DrawListStats& Stats() const { return stats; }
+
+private:
+    std::vector<DrawCommand> commands;
+    std::vector<std::uint64_t> keys;        // one per command
+    std::vector<std::uint32_t> order;       // command indices in submit order
+    std::vector<std::uint32_t> scratch;     // the other radix pass buffer
+
+    DrawListStats stats;
+};
+
+} // namespace Core
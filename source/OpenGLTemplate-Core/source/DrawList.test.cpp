@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: DrawList.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "DrawList.hpp"
+#include "Models.hpp"
+#include "RecordingRenderDevice.hpp"
+#include "UnitTest.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace Core;
+
+static const Color red = {1.0f, 0.0f, 0.0f, 1.0f};
+static const Color blue = {0.0f, 0.0f, 1.0f, 1.0f};
+
+// tagged through the model matrix, so the submitted order can be read back
+static DrawCommand MakeCommand(ProgramId program, MeshId mesh, const Color& color, float tag) {
+
+    DrawCommand command;
+    command.program = program;
+    command.mesh = mesh;
+    command.color = color;
+
+    std::fill(command.model_mat, command.model_mat + 16, 0.0f);
+    command.model_mat[0] = tag;
+
+    return command;
+}
+
+TEST_CASE(KeysOrderByLayerProgramMeshThenColor) {
+
+    const std::uint64_t base = DrawList::MakeKey(0, 2, 5, red);
+
+    CHECK(DrawList::MakeKey(1, 1, 0, red) > base);
+    CHECK(DrawList::MakeKey(0, 3, 0, red) > base);
+    CHECK(DrawList::MakeKey(0, 2, 6, blue) > base);
+    CHECK(DrawList::MakeKey(0, 2, 5, red) == base);
+    CHECK(DrawList::MakeKey(0, 2, 5, blue) != base);
+
+    // only the key is truncated
+    CHECK(DrawList::MakeKey(0, 2 + (1 << DRAW_KEY_PROGRAM_BITS), 5, red) == base);
+}
+
+TEST_CASE(SortGroupsStateAndKeepsAddOrder) {
+
+    DrawList list;
+
+    list.Add(1, MakeCommand(1, 0, red, 0.0f));     // on top of everything
+    list.Add(0, MakeCommand(2, 1, blue, 1.0f));
+    list.Add(0, MakeCommand(1, 1, red, 2.0f));
+    list.Add(0, MakeCommand(2, 1, blue, 3.0f));
+    list.Add(0, MakeCommand(1, 0, blue, 4.0f));
+    list.Add(0, MakeCommand(1, 1, red, 5.0f));
+
+    CHECK(list.At(0).model_mat[0] == 0.0f);
+
+    list.Sort();
+
+    const float expected[] = {4.0f, 2.0f, 5.0f, 1.0f, 3.0f, 0.0f};
+
+    for (std::size_t i = 0; i < list.Size(); ++i) {
+
+        CHECK(list.At(i).model_mat[0] == expected[i]);
+    }
+}
+
+TEST_CASE(RadixSortMatchesStableSort) {
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<std::uint32_t> small(0, 3);
+    std::uniform_int_distribution<std::uint32_t> mesh(0, 300);
+
+    const Color palette[] = {red, blue, Color{}, Color{0.5f, 0.5f, 0.5f, 1.0f}};
+
+    DrawList list;
+    std::vector<std::uint64_t> keys;
+
+    for (int i = 0; i < 10000; ++i) {
+
+        const DrawCommand command = MakeCommand(small(rng) + 1, mesh(rng), palette[small(rng)],
+                                                static_cast<float>(i));
+        const std::uint32_t layer = small(rng) / 3;
+
+        list.Add(layer, command);
+        keys.push_back(DrawList::MakeKey(layer, command.program, command.mesh, command.color));
+    }
+
+    std::vector<std::uint32_t> expected(keys.size());
+    std::iota(expected.begin(), expected.end(), 0u);
+
+    std::stable_sort(expected.begin(), expected.end(), [&keys](std::uint32_t lhs, std::uint32_t rhs) {
+
+        return keys[lhs] < keys[rhs];
+    });
+
+    list.Sort();
+
+    int wrong = 0;
+
+    for (std::size_t i = 0; i < list.Size(); ++i) {
+
+        wrong += list.At(i).model_mat[0] != static_cast<float>(expected[i]);
+        wrong += list.KeyAt(i) != keys[expected[i]];
+    }
+
+    CHECK(wrong == 0);
+}
+
+TEST_CASE(SubmitSkipsRedundantState) {
+
+    RecordingRenderDevice device;
+    MeshRegistry meshes;
+
+    const MeshId square = meshes.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    const MeshId triangle = meshes.Register(BuildIndexedMesh(triangle_vertices.data(), triangle_vertices.size()));
+
+    meshes.Upload(device);
+
+    const ProgramId first = device.CreateProgram("vs", "fs");
+    const ProgramId second = device.CreateProgram("vs", "fs");
+
+    DrawList list;
+
+    // one shared model matrix, so only the color and program changes count
+    list.Add(0, MakeCommand(second, square, red, 1.0f));
+    list.Add(0, MakeCommand(first, triangle, blue, 1.0f));
+    list.Add(0, MakeCommand(first, square, red, 1.0f));
+    list.Add(0, MakeCommand(second, triangle, red, 1.0f));
+    list.Add(0, MakeCommand(first, square, red, 1.0f));
+    list.Sort();
+
+    device.BeginFrame();
+    list.Submit(meshes, device);
+
+    const DrawListStats& stats = list.Stats();
+
+    // first: square red, square red, triangle blue; second: square red, triangle red
+    CHECK(stats.draws == 5);
+    CHECK(stats.program_binds == 2);
+    CHECK(stats.skipped_binds == 3);
+    CHECK(stats.uniform_sets == 5);
+    CHECK(stats.skipped_uniforms == 5);
+
+    CHECK(device.FrameStats().draw_calls == 5);
+    CHECK(device.FrameStats().program_binds == 2);
+    CHECK(device.FrameStats().uniform_sets == stats.uniform_sets);
+
+    // every program was left with the values of its last draw
+    CHECK(device.UniformValue(first, HashName("u_Color_vec"))[2] == 1.0f);
+    CHECK(device.UniformValue(second, HashName("u_Color_vec"))[0] == 1.0f);
+
+    const RenderCommand& last = device.Commands().back();
+
+    CHECK(last.type == RenderCommandType::Draw);
+    CHECK(last.draw.first_index == meshes.Range(triangle).first_index);
+}
+
+TEST_CASE(ClearEmptiesTheList) {
+
+    RecordingRenderDevice device;
+    MeshRegistry meshes;
+    meshes.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    meshes.Upload(device);
+
+    DrawList list;
+    list.Add(0, MakeCommand(device.CreateProgram("vs", "fs"), 0, red, 0.0f));
+    list.Clear();
+    list.Sort();
+
+    device.BeginFrame();
+    list.Submit(meshes, device);
+
+    CHECK(list.Empty());
+    CHECK(list.Stats().draws == 0);
+    CHECK(device.FrameStats().draw_calls == 0);
+}
+
+int main() { return Core::Test::RunAll(); }
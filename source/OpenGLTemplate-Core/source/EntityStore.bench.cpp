@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: EntityStore.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "EntityStore.hpp"
+#include "Benchmark.hpp"
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+#define ENTITY_COUNT    1000000
+
+// array of structures layout for comparison, same fields as the store
+struct EntityRecord {
+
+    float position_x;
+    float position_y;
+    float rotation;
+    float scale_x;
+    float scale_y;
+    Color color;
+    MeshId mesh;
+};
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : ENTITY_COUNT;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+
+    EntityStore store;
+    std::vector<EntityHandle> handles;
+    handles.reserve(count);
+
+    Bench::Run("create", count, [&]() {
+
+        store.Clear();
+        store.Reserve(count);
+        handles.clear();
+
+        for (std::size_t i = 0; i < count; ++i) {
+
+            EntityDesc desc;
+            desc.position_x = dist(rng);
+            desc.position_y = dist(rng);
+            handles.push_back(store.Create(desc));
+        }
+    }, 1);
+
+    std::vector<EntityRecord> records(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        records[i] = EntityRecord{store.PositionX()[i], store.PositionY()[i], 0.0f,
+                                  1.0f, 1.0f, Color{}, 0};
+    }
+
+    const float dt = 1.0f / 60.0f;
+
+    Bench::Run("soa translate (dense iteration)", count, [&]() {
+
+        float* x = store.PositionX();
+        float* y = store.PositionY();
+        const std::size_t size = store.Size();
+
+        for (std::size_t i = 0; i < size; ++i) {
+
+            x[i] += 300.0f * dt;
+            y[i] -= 300.0f * dt;
+        }
+
+        Bench::DoNotOptimize(x[0]);
+    });
+
+    Bench::Run("aos translate (reference)", count, [&]() {
+
+        for (auto& record : records) {
+
+            record.position_x += 300.0f * dt;
+            record.position_y -= 300.0f * dt;
+        }
+
+        Bench::DoNotOptimize(records[0].position_x);
+    });
+
+    Bench::Run("soa model matrices", count, [&]() {
+
+        float mat[16];
+
+        for (std::uint32_t i = 0; i < store.Size(); ++i) {
+
+            store.ModelMatrix(i, mat);
+            Bench::DoNotOptimize(mat[12]);
+        }
+    });
+
+    Bench::Run("handle lookup", count, [&]() {
+
+        float sum = 0.0f;
+
+        for (const auto& handle : handles) {
+
+            sum += store.PositionX()[store.IndexOf(handle)];
+        }
+
+        Bench::DoNotOptimize(sum);
+    });
+
+    Bench::Run("destroy half", count / 2, [&]() {
+
+        for (std::size_t i = 0; i < handles.size(); i += 2) {
+
+            store.Destroy(handles[i]);
+        }
+    }, 1);
+
+    return 0;
+}
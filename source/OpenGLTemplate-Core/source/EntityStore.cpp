@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: EntityStore.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "EntityStore.hpp"
+
+#include <cmath>
+
+namespace Core {
+
+void EntityStore::Reserve(std::size_t capacity) {
+
+    position_x.reserve(capacity);
+    position_y.reserve(capacity);
+    rotation.reserve(capacity);
+    scale_x.reserve(capacity);
+    scale_y.reserve(capacity);
+    colors.reserve(capacity);
+    meshes.reserve(capacity);
+    previous_position_x.reserve(capacity);
+    previous_position_y.reserve(capacity);
+    previous_rotation.reserve(capacity);
+    previous_scale_x.reserve(capacity);
+    previous_scale_y.reserve(capacity);
+    dense_to_slot.reserve(capacity);
+    slots.reserve(capacity);
+}
+
+EntityHandle EntityStore::Create(const EntityDesc& desc) {
+
+    std::uint32_t slot_index;
+
+    if (!free_slots.empty()) {
+
+        slot_index = free_slots.back();
+        free_slots.pop_back();
+    }
+    else {
+
+        slot_index = static_cast<std::uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    Slot& slot = slots[slot_index];
+    slot.dense_index = static_cast<std::uint32_t>(dense_to_slot.size());
+    slot.transform_saved = false;
+
+    position_x.push_back(desc.position_x);
+    position_y.push_back(desc.position_y);
+    rotation.push_back(desc.rotation);
+    scale_x.push_back(desc.scale_x);
+    scale_y.push_back(desc.scale_y);
+    colors.push_back(desc.color);
+    meshes.push_back(desc.mesh);
+    previous_position_x.push_back(desc.position_x);
+    previous_position_y.push_back(desc.position_y);
+    previous_rotation.push_back(desc.rotation);
+    previous_scale_x.push_back(desc.scale_x);
+    previous_scale_y.push_back(desc.scale_y);
+    dense_to_slot.push_back(slot_index);
+
+    return EntityHandle{slot_index, slot.generation};
+}
+
+void EntityStore::Destroy(EntityHandle handle) {
+
+    if (!IsAlive(handle)) {
+
+        return;
+    }
+
+    const std::uint32_t hole = slots[handle.slot].dense_index;
+    const std::uint32_t last = static_cast<std::uint32_t>(dense_to_slot.size() - 1);
+
+    // move the last entity into the hole to keep the arrays dense
+    if (hole != last) {
+
+        position_x[hole] = position_x[last];
+        position_y[hole] = position_y[last];
+        rotation[hole] = rotation[last];
+        scale_x[hole] = scale_x[last];
+        scale_y[hole] = scale_y[last];
+        colors[hole] = colors[last];
+        meshes[hole] = meshes[last];
+        previous_position_x[hole] = previous_position_x[last];
+        previous_position_y[hole] = previous_position_y[last];
+        previous_rotation[hole] = previous_rotation[last];
+        previous_scale_x[hole] = previous_scale_x[last];
+        previous_scale_y[hole] = previous_scale_y[last];
+
+        dense_to_slot[hole] = dense_to_slot[last];
+        slots[dense_to_slot[hole]].dense_index = hole;
+    }
+
+    position_x.pop_back();
+    position_y.pop_back();
+    rotation.pop_back();
+    scale_x.pop_back();
+    scale_y.pop_back();
+    colors.pop_back();
+    meshes.pop_back();
+    previous_position_x.pop_back();
+    previous_position_y.pop_back();
+    previous_rotation.pop_back();
+    previous_scale_x.pop_back();
+    previous_scale_y.pop_back();
+    dense_to_slot.pop_back();
+
+    slots[handle.slot].generation += 1;
+    free_slots.push_back(handle.slot);
+}
+
+void EntityStore::Clear() {
+
+    while (!dense_to_slot.empty()) {
+
+        Destroy(HandleAt(static_cast<std::uint32_t>(dense_to_slot.size() - 1)));
+    }
+}
+
+bool EntityStore::IsAlive(EntityHandle handle) const {
+
+    // destroying an entity bumps its slot generation, invalidating old handles
+    return handle.slot < slots.size() && slots[handle.slot].generation == handle.generation;
+}
+
+EntityHandle EntityStore::HandleAt(std::uint32_t index) const {
+
+    const std::uint32_t slot = dense_to_slot[index];
+    return EntityHandle{slot, slots[slot].generation};
+}
+
+void EntityStore::BeginStep() {
+
+    for (EntityHandle handle : saved_transforms) {
+
+        slots[handle.slot].transform_saved = false;
+
+        if (IsAlive(handle)) {
+
+            SnapTransform(IndexOf(handle));
+        }
+    }
+
+    saved_transforms.clear();
+}
+
+void EntityStore::SaveTransform(std::uint32_t index) {
+
+    Slot& slot = slots[dense_to_slot[index]];
+
+    if (slot.transform_saved) {
+
+        return;
+    }
+
+    slot.transform_saved = true;
+    saved_transforms.push_back(HandleAt(index));
+    SnapTransform(index);
+}
+
+void EntityStore::SnapTransform(std::uint32_t index) {
+
+    previous_position_x[index] = position_x[index];
+    previous_position_y[index] = position_y[index];
+    previous_rotation[index] = rotation[index];
+    previous_scale_x[index] = scale_x[index];
+    previous_scale_y[index] = scale_y[index];
+}
+
+static inline float Lerp(float from, float to, float alpha) {
+
+    return from + alpha * (to - from);
+}
+
+void EntityStore::InterpolateTransforms(float alpha, std::size_t begin, std::size_t end,
+                                        float* out_position_x, float* out_position_y,
+                                        float* out_rotation,
+                                        float* out_scale_x, float* out_scale_y) const {
+
+    for (std::size_t i = begin; i < end; ++i) {
+
+        out_position_x[i - begin] = Lerp(previous_position_x[i], position_x[i], alpha);
+        out_position_y[i - begin] = Lerp(previous_position_y[i], position_y[i], alpha);
+        out_rotation[i - begin] = Lerp(previous_rotation[i], rotation[i], alpha);
+        out_scale_x[i - begin] = Lerp(previous_scale_x[i], scale_x[i], alpha);
+        out_scale_y[i - begin] = Lerp(previous_scale_y[i], scale_y[i], alpha);
+    }
+}
+
+void EntityStore::ModelMatrix(std::uint32_t index, float* out_mat, float alpha) const {
+
+    const float angle = Lerp(previous_rotation[index], rotation[index], alpha);
+    const float sx = Lerp(previous_scale_x[index], scale_x[index], alpha);
+    const float sy = Lerp(previous_scale_y[index], scale_y[index], alpha);
+
+    const float c = std::cos(angle);
+    const float s = std::sin(angle);
+
+    out_mat[0]  =  c * sx;
+    out_mat[1]  =  s * sx;
+    out_mat[2]  =  0.0f;
+    out_mat[3]  =  0.0f;
+
+    out_mat[4]  = -s * sy;
+    out_mat[5]  =  c * sy;
+    out_mat[6]  =  0.0f;
+    out_mat[7]  =  0.0f;
+
+    out_mat[8]  =  0.0f;
+    out_mat[9]  =  0.0f;
+    out_mat[10] =  1.0f;
+    out_mat[11] =  0.0f;
+
+    out_mat[12] =  Lerp(previous_position_x[index], position_x[index], alpha);
+    out_mat[13] =  Lerp(previous_position_y[index], position_y[index], alpha);
+    out_mat[14] =  0.0f;
+    out_mat[15] =  1.0f;
+}
+
+} // namespace Core
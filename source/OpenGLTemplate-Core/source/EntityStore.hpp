@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: EntityStore.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MeshRegistry.hpp"
+
+namespace Core {
+
+struct Color {
+
+    float r = 1.0f;
+    float g = 1.0f;
+    float b = 1.0f;
+    float a = 1.0f;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Entity Handle
+// --Stable across destroys of other entities. The generation detects handles
+//   to destroyed entities whose slot has since been reused.
+////////////////////////////////////////////////////////////////////////////////
+struct EntityHandle {
+
+    std::uint32_t slot = UINT32_MAX;
+    std::uint32_t generation = 0;
+
+    bool operator==(const EntityHandle& other) const {
+
+        return slot == other.slot && generation == other.generation;
+    }
+
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+struct EntityDesc {
+
+    float position_x = 0.0f;
+    float position_y = 0.0f;
+    float rotation = 0.0f;      // radians, counterclockwise
+    float scale_x = 1.0f;
+    float scale_y = 1.0f;
+    Color color;
+    MeshId mesh = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Entity Store
+// --Structure of arrays: each component is its own contiguous array, indexed
+//   by a dense index in [0, Size()). Destroy swaps the last entity into the
+//   hole, so dense arrays never contain gaps.
+// --Create, Destroy and handle lookup are O(1).
+// --The transform of the previous simulation step is kept alongside the
+//   current one so rendering can interpolate between the two. A step only
+//   pays for the entities it moves: SaveTransform() records one before it
+//   changes, and the next BeginStep() settles just those.
+////////////////////////////////////////////////////////////////////////////////
+class EntityStore {
+
+public:
+    void Reserve(std::size_t capacity);
+
+    EntityHandle Create(const EntityDesc& desc = {});
+    void Destroy(EntityHandle handle);
+    void Clear();
+
+    bool IsAlive(EntityHandle handle) const;
+    std::size_t Size() const { return dense_to_slot.size(); }
+
+    // dense index of a live handle, valid until the next Destroy()
+    std::uint32_t IndexOf(EntityHandle handle) const { return slots[handle.slot].dense_index; }
+    std::uint32_t IndexOfSlot(std::uint32_t slot) const { return slots[slot].dense_index; }
+    EntityHandle HandleAt(std::uint32_t index) const;
+
+    float* PositionX() { return position_x.data(); }
+    float* PositionY() { return position_y.data(); }
+    float* Rotation() { return rotation.data(); }
+    float* ScaleX() { return scale_x.data(); }
+    float* ScaleY() { return scale_y.data(); }
+    Color* Colors() { return colors.data(); }
+    MeshId* Meshes() { return meshes.data(); }
+
+    const float* PositionX() const { return position_x.data(); }
+    const float* PositionY() const { return position_y.data(); }
+    const float* Rotation() const { return rotation.data(); }
+    const float* ScaleX() const { return scale_x.data(); }
+    const float* ScaleY() const { return scale_y.data(); }
+    const Color* Colors() const { return colors.data(); }
+    const MeshId* Meshes() const { return meshes.data(); }
+
+    // call at the start of each fixed simulation step; entities saved during
+    // the last step get previous == current again, everything else already has it
+    void BeginStep();
+
+    // call before a step changes an entity's transform; only the first call
+    // per step saves, so several changes in one step still interpolate
+    void SaveTransform(std::uint32_t index);
+
+    // makes the previous transform of one entity equal its current one, so a
+    // teleport or reset is not interpolated
+    void SnapTransform(std::uint32_t index);
+
+    // previous + alpha * (current - previous) for dense indices [begin, end),
+    // written to out arrays indexed from begin
+    void InterpolateTransforms(float alpha, std::size_t begin, std::size_t end,
+                               float* out_position_x, float* out_position_y,
+                               float* out_rotation,
+                               float* out_scale_x, float* out_scale_y) const;
+
+    // column-major 4x4 model matrix (translate * rotate * scale), alpha
+    // interpolates from the previous step
+    void ModelMatrix(std::uint32_t index, float* out_mat, float alpha = 1.0f) const;
+
+private:
+    struct Slot {
+
+        std::uint32_t dense_index = 0;
+        std::uint32_t generation = 0;
+        bool transform_saved = false;
+    };
+
+    std::vector<float> position_x;
+    std::vector<float> position_y;
+    std::vector<float> rotation;
+    std::vector<float> scale_x;
+    std::vector<float> scale_y;
+    std::vector<Color> colors;
+    std::vector<MeshId> meshes;
+
+    std::vector<float> previous_position_x;
+    std::vector<float> previous_position_y;
+    std::vector<float> previous_rotation;
+    std::vector<float> previous_scale_x;
+    std::vector<float> previous_scale_y;
+
+    // entities whose previous transform was saved this step
+    std::vector<EntityHandle> saved_transforms;
+
+    std::vector<std::uint32_t> dense_to_slot;
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> free_slots;
+};
+
+} // namespace Core
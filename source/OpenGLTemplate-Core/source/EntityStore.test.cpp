@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: EntityStore.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "EntityStore.hpp"
+#include "UnitTest.hpp"
+
+#include <vector>
+
+using namespace Core;
+
+static EntityDesc DescAt(float x) {
+
+    EntityDesc desc;
+    desc.position_x = x;
+    return desc;
+}
+
+TEST_CASE(CreatedEntitiesAreDenseAndAlive) {
+
+    EntityStore store;
+
+    EntityHandle a = store.Create(DescAt(1.0f));
+    EntityHandle b = store.Create(DescAt(2.0f));
+
+    CHECK(store.Size() == 2);
+    CHECK(store.IsAlive(a));
+    CHECK(store.IsAlive(b));
+    CHECK(store.PositionX()[store.IndexOf(a)] == 1.0f);
+    CHECK(store.PositionX()[store.IndexOf(b)] == 2.0f);
+    CHECK(store.HandleAt(store.IndexOf(b)) == b);
+}
+
+TEST_CASE(DestroyKeepsOtherHandlesValid) {
+
+    EntityStore store;
+
+    EntityHandle a = store.Create(DescAt(1.0f));
+    EntityHandle b = store.Create(DescAt(2.0f));
+    EntityHandle c = store.Create(DescAt(3.0f));
+
+    store.Destroy(a);
+
+    CHECK(store.Size() == 2);
+    CHECK(!store.IsAlive(a));
+    CHECK(store.IsAlive(b));
+    CHECK(store.IsAlive(c));
+
+    // the last entity moved into the hole, but its handle still resolves
+    CHECK(store.IndexOf(c) == 0);
+    CHECK(store.PositionX()[store.IndexOf(b)] == 2.0f);
+    CHECK(store.PositionX()[store.IndexOf(c)] == 3.0f);
+}
+
+TEST_CASE(StaleHandlesAreRejectedAfterSlotReuse) {
+
+    EntityStore store;
+
+    EntityHandle old_handle = store.Create(DescAt(1.0f));
+    store.Destroy(old_handle);
+
+    EntityHandle new_handle = store.Create(DescAt(5.0f));
+
+    CHECK(new_handle.slot == old_handle.slot);
+    CHECK(new_handle != old_handle);
+    CHECK(!store.IsAlive(old_handle));
+    CHECK(store.IsAlive(new_handle));
+
+    // destroying through a stale handle is a no-op
+    store.Destroy(old_handle);
+    CHECK(store.Size() == 1);
+}
+
+TEST_CASE(ManyCreatesAndDestroysStayConsistent) {
+
+    EntityStore store;
+    std::vector<EntityHandle> handles;
+
+    for (int i = 0; i < 1000; ++i) {
+
+        handles.push_back(store.Create(DescAt(static_cast<float>(i))));
+    }
+
+    for (int i = 0; i < 1000; i += 2) {
+
+        store.Destroy(handles[i]);
+    }
+
+    CHECK(store.Size() == 500);
+
+    for (int i = 1; i < 1000; i += 2) {
+
+        CHECK(store.IsAlive(handles[i]));
+        CHECK(store.PositionX()[store.IndexOf(handles[i])] == static_cast<float>(i));
+    }
+
+    store.Clear();
+    CHECK(store.Size() == 0);
+    CHECK(!store.IsAlive(handles[1]));
+}
+
+TEST_CASE(ModelMatrixComposesTranslateRotateScale) {
+
+    EntityStore store;
+
+    EntityDesc desc;
+    desc.position_x = 10.0f;
+    desc.position_y = -5.0f;
+    desc.rotation = 1.5707963f;     // 90 degrees
+    desc.scale_x = 2.0f;
+    desc.scale_y = 2.0f;
+
+    EntityHandle handle = store.Create(desc);
+
+    float mat[16];
+    store.ModelMatrix(store.IndexOf(handle), mat);
+
+    // local +x maps to world +y scaled by 2, then translated
+    CHECK_NEAR(mat[0], 0.0f, 1e-5f);
+    CHECK_NEAR(mat[1], 2.0f, 1e-5f);
+    CHECK_NEAR(mat[4], -2.0f, 1e-5f);
+    CHECK_NEAR(mat[5], 0.0f, 1e-5f);
+    CHECK(mat[12] == 10.0f);
+    CHECK(mat[13] == -5.0f);
+    CHECK(mat[15] == 1.0f);
+}
+
+TEST_CASE(InterpolatesBetweenSavedAndCurrentTransforms) {
+
+    EntityStore store;
+
+    EntityHandle a = store.Create(DescAt(0.0f));
+    EntityHandle b = store.Create(DescAt(100.0f));
+
+    // new entities start with previous == current
+    float x[2];
+    float y[2];
+    float rotation[2];
+    float scale_x[2];
+    float scale_y[2];
+
+    store.InterpolateTransforms(0.5f, 0, 2, x, y, rotation, scale_x, scale_y);
+    CHECK(x[0] == 0.0f);
+    CHECK(x[1] == 100.0f);
+
+    store.BeginStep();
+    store.SaveTransform(store.IndexOf(a));
+    store.SaveTransform(store.IndexOf(b));
+    store.PositionX()[store.IndexOf(a)] = 10.0f;
+    store.Rotation()[store.IndexOf(b)] = 1.0f;
+    store.ScaleY()[store.IndexOf(b)] = 3.0f;
+
+    store.InterpolateTransforms(0.25f, 0, 2, x, y, rotation, scale_x, scale_y);
+    CHECK_NEAR(x[0], 2.5f, 1e-6f);
+    CHECK_NEAR(rotation[1], 0.25f, 1e-6f);
+    CHECK_NEAR(scale_y[1], 1.5f, 1e-6f);
+
+    float mat[16];
+    store.ModelMatrix(store.IndexOf(a), mat, 0.5f);
+    CHECK_NEAR(mat[12], 5.0f, 1e-6f);
+
+    // destroying keeps previous state attached to the moved entity
+    store.Destroy(a);
+    store.InterpolateTransforms(0.0f, 0, 1, x, y, rotation, scale_x, scale_y);
+    CHECK(x[0] == 100.0f);
+    CHECK(rotation[0] == 0.0f);
+}
+
+TEST_CASE(SnappedTransformsAreNotInterpolated) {
+
+    EntityStore store;
+
+    EntityHandle a = store.Create(DescAt(0.0f));
+    EntityHandle b = store.Create(DescAt(100.0f));
+
+    store.BeginStep();
+    store.SaveTransform(store.IndexOf(a));
+    store.SaveTransform(store.IndexOf(b));
+    store.PositionX()[store.IndexOf(a)] = 10.0f;
+    store.Rotation()[store.IndexOf(a)] = 6.0f;
+    store.PositionX()[store.IndexOf(b)] = 110.0f;
+
+    store.SnapTransform(store.IndexOf(a));
+
+    float x[2];
+    float y[2];
+    float rotation[2];
+    float scale_x[2];
+    float scale_y[2];
+
+    // only the snapped entity lands on its current transform
+    store.InterpolateTransforms(0.5f, 0, 2, x, y, rotation, scale_x, scale_y);
+    CHECK(x[store.IndexOf(a)] == 10.0f);
+    CHECK(rotation[store.IndexOf(a)] == 6.0f);
+    CHECK_NEAR(x[store.IndexOf(b)], 105.0f, 1e-6f);
+}
+
+TEST_CASE(SavedTransformsSettleOnTheNextStep) {
+
+    EntityStore store;
+
+    EntityHandle a = store.Create(DescAt(0.0f));
+    EntityHandle b = store.Create(DescAt(100.0f));
+    EntityHandle c = store.Create(DescAt(200.0f));
+
+    // step 1: a moves twice, only the first save counts; c moves and dies
+    store.BeginStep();
+    store.SaveTransform(store.IndexOf(a));
+    store.PositionX()[store.IndexOf(a)] = 5.0f;
+    store.SaveTransform(store.IndexOf(a));
+    store.PositionX()[store.IndexOf(a)] = 10.0f;
+    store.SaveTransform(store.IndexOf(c));
+    store.Destroy(c);
+
+    float x[2];
+    float y[2];
+    float rotation[2];
+    float scale_x[2];
+    float scale_y[2];
+
+    store.InterpolateTransforms(0.5f, 0, 2, x, y, rotation, scale_x, scale_y);
+    CHECK_NEAR(x[store.IndexOf(a)], 5.0f, 1e-6f);
+
+    // step 2: nothing moves, so a rests at its current position
+    store.BeginStep();
+    store.InterpolateTransforms(0.5f, 0, 2, x, y, rotation, scale_x, scale_y);
+    CHECK(x[store.IndexOf(a)] == 10.0f);
+    CHECK(x[store.IndexOf(b)] == 100.0f);
+}
+
+int main() { return Core::Test::RunAll(); }
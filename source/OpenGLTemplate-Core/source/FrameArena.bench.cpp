@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FrameArena.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "FrameArena.hpp"
+#include "Benchmark.hpp"
+#include "PoolAllocator.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+#define ALLOCATION_COUNT    100000      // transient allocations per frame
+#define MAX_ALLOCATION      256         // bytes
+#define FRAME_COUNT         10
+#define RECORD_COUNT        4096        // live records in the pool test
+
+struct Record {
+
+    float transform[6];
+    float color[4];
+    std::uint32_t mesh;
+    std::uint32_t flags;
+};
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : ALLOCATION_COUNT;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> size_dist(8, MAX_ALLOCATION);
+
+    std::vector<std::size_t> sizes(count);
+    std::size_t frame_bytes = 0;
+
+    for (std::size_t& size : sizes) {
+
+        size = size_dist(rng);
+        frame_bytes += size + alignof(std::max_align_t);
+    }
+
+    std::printf("%zu allocations of 8-%d bytes per frame, %d frames\n", count, MAX_ALLOCATION, FRAME_COUNT);
+
+    // transient per-frame data: freed all at once at the end of the frame
+    std::vector<void*> pointers(count);
+
+    Bench::Run("new / delete", count * FRAME_COUNT, [&]() {
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+
+            for (std::size_t i = 0; i < count; ++i) {
+
+                pointers[i] = ::operator new(sizes[i]);
+            }
+
+            Bench::DoNotOptimize(pointers.back());
+
+            for (void* pointer : pointers) {
+
+                ::operator delete(pointer);
+            }
+        }
+    });
+
+    FrameArena arena(frame_bytes);
+
+    Bench::Run("frame arena", count * FRAME_COUNT, [&]() {
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+
+            arena.BeginFrame();
+
+            for (std::size_t i = 0; i < count; ++i) {
+
+                pointers[i] = arena.Allocate(sizes[i]);
+            }
+
+            Bench::DoNotOptimize(pointers.back());
+        }
+    });
+
+    std::printf("  %zu bytes high water, %zu overflows\n", arena.HighWater(), arena.Overflows());
+
+    // fixed-size records created and destroyed in a shuffled order
+    std::vector<std::uint32_t> order(RECORD_COUNT);
+
+    for (std::uint32_t i = 0; i < RECORD_COUNT; ++i) {
+
+        order[i] = i;
+    }
+
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<Record*> records(RECORD_COUNT);
+    const std::size_t rounds = std::max<std::size_t>(count / RECORD_COUNT, 1);
+
+    Bench::Run("records, new / delete", rounds * RECORD_COUNT, [&]() {
+
+        for (std::size_t round = 0; round < rounds; ++round) {
+
+            for (Record*& record : records) {
+
+                record = new Record();
+            }
+
+            for (std::uint32_t i : order) {
+
+                delete records[i];
+            }
+        }
+    });
+
+    ObjectPool<Record> pool(RECORD_COUNT);
+
+    Bench::Run("records, object pool", rounds * RECORD_COUNT, [&]() {
+
+        for (std::size_t round = 0; round < rounds; ++round) {
+
+            for (Record*& record : records) {
+
+                record = pool.Create();
+            }
+
+            for (std::uint32_t i : order) {
+
+                pool.Destroy(records[i]);
+            }
+        }
+    });
+
+    return 0;
+}
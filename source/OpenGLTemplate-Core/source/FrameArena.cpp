@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FrameArena.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "FrameArena.hpp"
+
+#include <algorithm>
+
+namespace Core {
+
+LinearArena::LinearArena(std::size_t capacity)
+    : buffer(capacity ? new std::uint8_t[capacity] : nullptr), capacity(capacity) {
+
+}
+
+void* LinearArena::Allocate(std::size_t size, std::size_t alignment) {
+
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+
+        overflows += 1;
+        return nullptr;
+    }
+
+    // align the address, not the offset: the buffer is only max_align_t aligned
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer.get());
+    const std::uintptr_t address = (base + used + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    const std::size_t offset = static_cast<std::size_t>(address - base);
+
+    if (!buffer || offset > capacity || size > capacity - offset) {
+
+        overflows += 1;
+        return nullptr;
+    }
+
+    used = offset + size;
+    high_water = std::max(high_water, used);
+
+    return buffer.get() + offset;
+}
+
+void LinearArena::Rewind(std::size_t mark) {
+
+    used = std::min(mark, used);
+}
+
+FrameArena::FrameArena(std::size_t bytes_per_frame) {
+
+    for (LinearArena& arena : arenas) {
+
+        arena = LinearArena(bytes_per_frame);
+    }
+}
+
+void FrameArena::BeginFrame() {
+
+    current = (current + 1) % FRAME_ARENA_BUFFERS;
+    arenas[current].Reset();
+    frames += 1;
+}
+
+std::size_t FrameArena::HighWater() const {
+
+    std::size_t high_water = 0;
+
+    for (const LinearArena& arena : arenas) {
+
+        high_water = std::max(high_water, arena.HighWater());
+    }
+
+    return high_water;
+}
+
+std::size_t FrameArena::Overflows() const {
+
+    std::size_t overflows = 0;
+
+    for (const LinearArena& arena : arenas) {
+
+        overflows += arena.Overflows();
+    }
+
+    return overflows;
+}
+
+} // namespace Core
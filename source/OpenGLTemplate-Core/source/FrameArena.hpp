@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FrameArena.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#define FRAME_ARENA_BUFFERS     2   // frames an allocation stays valid for
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Linear Arena
+// --Bump allocator over one buffer allocated up front: Allocate() only
+//   aligns and advances an offset, and nothing is freed on its own. Reset()
+//   drops everything at once, Rewind() everything after a Mark().
+// --Never grows: an allocation that does not fit returns nullptr, leaves
+//   the arena as it was and is counted in Overflows(). HighWater() tells
+//   how much a frame actually needed, to size the arena from.
+// --Holds plain data only; nothing allocated here is ever destroyed.
+////////////////////////////////////////////////////////////////////////////////
+class LinearArena {
+
+public:
+    explicit LinearArena(std::size_t capacity = 0);
+
+    // alignment is a power of two
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    // uninitialized storage for count objects
+    template<typename T>
+    T* AllocateArray(std::size_t count) {
+
+        static_assert(std::is_trivially_destructible_v<T>, "arena memory is never destroyed");
+
+        if (count > capacity / sizeof(T)) {
+
+            overflows += 1;
+            return nullptr;
+        }
+
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    std::size_t Mark() const { return used; }
+    void Rewind(std::size_t mark);
+    void Reset() { used = 0; }
+
+    std::size_t Used() const { return used; }
+    std::size_t Capacity() const { return capacity; }
+    std::size_t HighWater() const { return high_water; }
+    std::size_t Overflows() const { return overflows; }
+
+private:
+    std::unique_ptr<std::uint8_t[]> buffer;
+    std::size_t capacity = 0;
+    std::size_t used = 0;
+
+    std::size_t high_water = 0;
+    std::size_t overflows = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Frame Arena
+// --Per-frame scratch memory: FRAME_ARENA_BUFFERS linear arenas used in
+//   turn. BeginFrame() moves to the next one and resets it, so what a frame
+//   allocated stays valid through the following frame, e.g. while a render
+//   thread draws frame N from memory frame N + 1 is not allowed to reuse.
+// --Steady-state frames touch the heap zero times; only construction does.
+// --Call BeginFrame() and Allocate() from one thread at a time.
+////////////////////////////////////////////////////////////////////////////////
+class FrameArena {
+
+public:
+    explicit FrameArena(std::size_t bytes_per_frame);
+
+    void BeginFrame();
+
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+
+        return arenas[current].Allocate(size, alignment);
+    }
+
+    template<typename T>
+    T* AllocateArray(std::size_t count) { return arenas[current].template AllocateArray<T>(count); }
+
+    LinearArena& Current() { return arenas[current]; }
+    const LinearArena& Current() const { return arenas[current]; }
+
+    std::uint64_t FrameCount() const { return frames; }
+
+    // over every buffer
+    std::size_t HighWater() const;
+    std::size_t Overflows() const;
+
+private:
+    LinearArena arenas[FRAME_ARENA_BUFFERS];
+    std::size_t current = 0;
+    std::uint64_t frames = 0;
+};
+
+} // namespace Core
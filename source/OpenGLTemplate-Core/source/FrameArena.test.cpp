@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FrameArena.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "FrameArena.hpp"
+#include "AllocationCounter.hpp"
+#include "UnitTest.hpp"
+
+#include <cstring>
+
+using namespace Core;
+
+static bool IsAligned(const void* pointer, std::size_t alignment) {
+
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+TEST_CASE(AllocationsAreAlignedAndDisjoint) {
+
+    LinearArena arena(1024);
+
+    char* byte = static_cast<char*>(arena.Allocate(1, 1));
+    double* value = static_cast<double*>(arena.Allocate(sizeof(double), alignof(double)));
+    void* line = arena.Allocate(16, 64);
+    std::uint16_t* indices = arena.AllocateArray<std::uint16_t>(3);
+
+    CHECK(byte && value && line && indices);
+    CHECK(IsAligned(value, alignof(double)));
+    CHECK(IsAligned(line, 64));
+    CHECK(IsAligned(indices, alignof(std::uint16_t)));
+
+    CHECK(reinterpret_cast<char*>(value) >= byte + 1);
+    CHECK(static_cast<char*>(line) >= reinterpret_cast<char*>(value + 1));
+    CHECK(reinterpret_cast<char*>(indices) >= static_cast<char*>(line) + 16);
+
+    CHECK(arena.Used() >= 1 + sizeof(double) + 16 + 3 * sizeof(std::uint16_t));
+    CHECK(arena.Allocate(8, 3) == nullptr);     // not a power of two
+}
+
+TEST_CASE(ResetAndRewindReuseTheBuffer) {
+
+    LinearArena arena(256);
+
+    void* first = arena.Allocate(64);
+    const std::size_t mark = arena.Mark();
+
+    void* second = arena.Allocate(64);
+    arena.Rewind(mark);
+
+    CHECK(arena.Used() == mark);
+    CHECK(arena.Allocate(64) == second);
+
+    arena.Reset();
+
+    CHECK(arena.Used() == 0);
+    CHECK(arena.Allocate(64) == first);
+    CHECK(arena.HighWater() >= 128);
+}
+
+TEST_CASE(OverflowReturnsNullAndKeepsTheArena) {
+
+    LinearArena arena(100);
+
+    void* fits = arena.Allocate(60);
+    const std::size_t used = arena.Used();
+
+    CHECK(fits != nullptr);
+    CHECK(arena.Allocate(60) == nullptr);
+    CHECK(arena.AllocateArray<std::uint64_t>(~std::size_t(0) / 4) == nullptr);
+    CHECK(arena.Used() == used);
+    CHECK(arena.Overflows() == 2);
+
+    // what is left still serves allocations that fit
+    CHECK(arena.Allocate(16, 1) != nullptr);
+
+    LinearArena empty;
+    CHECK(empty.Allocate(1) == nullptr);
+}
+
+TEST_CASE(FrameMemoryLivesThroughTheNextFrame) {
+
+    FrameArena frames(256);
+
+    frames.BeginFrame();
+    char* frame_one = static_cast<char*>(frames.Allocate(32));
+    std::memset(frame_one, 1, 32);
+
+    frames.BeginFrame();
+    char* frame_two = static_cast<char*>(frames.Allocate(32));
+    std::memset(frame_two, 2, 32);
+
+    // frame one is not reused while frame two is being built
+    CHECK(frame_one != frame_two);
+    CHECK(frame_one[31] == 1);
+
+    frames.BeginFrame();
+    char* frame_three = static_cast<char*>(frames.Allocate(32));
+
+    CHECK(frame_three == frame_one);
+    CHECK(frame_two[31] == 2);
+    CHECK(frames.FrameCount() == 3);
+    CHECK(frames.Current().Used() == 32);
+}
+
+TEST_CASE(SteadyStateFramesDoNotAllocate) {
+
+    FrameArena frames(4096);
+
+    for (int frame = 0; frame < 2; ++frame) {
+
+        frames.BeginFrame();
+    }
+
+    AllocationScope scope;
+
+    for (int frame = 0; frame < 100; ++frame) {
+
+        frames.BeginFrame();
+
+        float* vertices = frames.AllocateArray<float>(512);
+        vertices[511] = static_cast<float>(frame);
+    }
+
+    CHECK(scope.Delta().allocations == 0);
+    CHECK(frames.Overflows() == 0);
+    CHECK(frames.HighWater() == 512 * sizeof(float));
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FrameDamage.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "FrameDamage.hpp"
+
+#include <cstring>
+
+namespace Core {
+
+const char* DamageFlagName(DamageFlag flag) {
+
+    switch (flag) {
+
+        case(DamageFlag::Camera): return "camera";
+        case(DamageFlag::Entities): return "entities";
+        case(DamageFlag::Window): return "window";
+        case(DamageFlag::Content): return "content";
+        case(DamageFlag::Motion): return "motion";
+    }
+
+    return "unknown";
+}
+
+void FrameDamage::Mark(DamageFlag flag) {
+
+    flags |= static_cast<std::uint32_t>(flag);
+    step_damaged = true;
+}
+
+void FrameDamage::EndStep() {
+
+    // the first clean step after a change still moved what is interpolated
+    if (in_motion && !step_damaged) {
+
+        flags |= static_cast<std::uint32_t>(DamageFlag::Motion);
+    }
+
+    in_motion = step_damaged;
+    step_damaged = false;
+}
+
+void FrameDamage::EndFrame() {
+
+    flags = 0;
+}
+
+bool ViewProjectionCache::Update(const Affine2D& proj, const Affine2D& view) {
+
+    // bitwise: a spurious miss (-0 against 0) only costs one redraw
+    if (valid && std::memcmp(&proj, &proj_mat, sizeof(Affine2D)) == 0 &&
+        std::memcmp(&view, &view_mat, sizeof(Affine2D)) == 0) {
+
+        return false;
+    }
+
+    proj_mat = proj;
+    view_mat = view;
+    view_proj_mat = proj * view;
+    valid = true;
+    recomputes += 1;
+
+    return true;
+}
+
+} // namespace Core
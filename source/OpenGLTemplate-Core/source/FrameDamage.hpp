@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FrameDamage.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+
+#include "Affine2D.hpp"
+
+namespace Core {
+
+enum class DamageFlag : std::uint32_t {
+
+    Camera   = 1 << 0,  // view or projection moved
+    Entities = 1 << 1,  // an entity's transform, color or mesh changed
+    Window   = 1 << 2,  // resized or exposed
+    Content  = 1 << 3,  // anything else drawn differently, e.g. new LOD meshes
+    Motion   = 1 << 4,  // interpolation still settling after a change
+};
+
+constexpr std::uint32_t DAMAGE_ALL = 0x1F;
+
+const char* DamageFlagName(DamageFlag flag);
+
+////////////////////////////////////////////////////////////////////////////////
+// Frame Damage
+// --Tracks whether anything visible changed since the last rendered frame,
+//   so a frame can be skipped when rendering it would repeat the last one.
+// --Rendering interpolates between the last two simulation steps, so a
+//   change made in a step keeps moving on screen until the following step
+//   has run too: every frame until then needs a redraw, and the frame after
+//   it (Motion) shows where things came to rest.
+// --Starts fully damaged, so the first frame always renders.
+////////////////////////////////////////////////////////////////////////////////
+class FrameDamage {
+
+public:
+    void Mark(DamageFlag flag);
+
+    // after each simulation step
+    void EndStep();
+
+    // after a frame was rendered; clears the damage it showed
+    void EndFrame();
+
+    bool NeedsRedraw() const { return flags != 0 || in_motion; }
+    bool Has(DamageFlag flag) const { return (flags & static_cast<std::uint32_t>(flag)) != 0; }
+    std::uint32_t Flags() const { return flags; }
+
+private:
+    std::uint32_t flags = DAMAGE_ALL;
+    bool step_damaged = false;      // marked since the last EndStep()
+    bool in_motion = false;         // the last step was damaged
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// View Projection Cache
+// --Keeps proj * view and only multiplies again when either one changed, so
+//   a still camera costs two comparisons per frame.
+////////////////////////////////////////////////////////////////////////////////
+class ViewProjectionCache {
+
+public:
+    // true if either transform differs from the last Update()
+    bool Update(const Affine2D& proj, const Affine2D& view);
+
+    const Affine2D& Projection() const { return proj_mat; }
+    const Affine2D& View() const { return view_mat; }
+    const Affine2D& ViewProjection() const { return view_proj_mat; }
+
+    // products computed so far
+    std::uint64_t Recomputes() const { return recomputes; }
+
+private:
+    Affine2D proj_mat;
+    Affine2D view_mat;
+    Affine2D view_proj_mat;
+
+    bool valid = false;
+    std::uint64_t recomputes = 0;
+};
+
+} // namespace Core
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FrameDamage.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "FrameDamage.hpp"
+#include "UnitTest.hpp"
+
+#include <string>
+
+using namespace Core;
+
+// one frame of the main loop: steps, then render if needed
+static bool RunFrame(FrameDamage& damage, int steps, bool change_each_step = false) {
+
+    for (int step = 0; step < steps; ++step) {
+
+        if (change_each_step) {
+
+            damage.Mark(DamageFlag::Entities);
+        }
+
+        damage.EndStep();
+    }
+
+    if (!damage.NeedsRedraw()) {
+
+        return false;
+    }
+
+    damage.EndFrame();
+    return true;
+}
+
+TEST_CASE(FirstFrameRendersThenIdles) {
+
+    FrameDamage damage;
+
+    CHECK(damage.NeedsRedraw());
+    CHECK(damage.Has(DamageFlag::Window) && damage.Has(DamageFlag::Camera));
+
+    CHECK(RunFrame(damage, 1));
+
+    for (int frame = 0; frame < 10; ++frame) {
+
+        CHECK(!RunFrame(damage, frame % 2));
+    }
+}
+
+TEST_CASE(ChangesRedrawUntilInterpolationSettles) {
+
+    FrameDamage damage;
+    RunFrame(damage, 1);
+
+    // a key held for three steps, two frames per step
+    CHECK(RunFrame(damage, 1, true));
+    CHECK(RunFrame(damage, 0));
+    CHECK(RunFrame(damage, 1, true));
+    CHECK(RunFrame(damage, 0));
+    CHECK(RunFrame(damage, 1, true));
+    CHECK(RunFrame(damage, 0));
+
+    // released: the next step settles the interpolation and is shown once
+    CHECK(RunFrame(damage, 1));
+    CHECK(!RunFrame(damage, 0));
+    CHECK(!RunFrame(damage, 1));
+}
+
+TEST_CASE(ChangesBetweenStepsRedraw) {
+
+    FrameDamage damage;
+    RunFrame(damage, 1);
+
+    // e.g. a resize or a one-shot key handled before the frame's steps
+    damage.Mark(DamageFlag::Window);
+
+    CHECK(damage.Has(DamageFlag::Window));
+    CHECK(!damage.Has(DamageFlag::Camera));
+    CHECK(RunFrame(damage, 0));
+
+    // it is treated like a change in the next step
+    CHECK(RunFrame(damage, 1));
+    CHECK(RunFrame(damage, 1));
+    CHECK(damage.Flags() == 0);
+    CHECK(!RunFrame(damage, 1));
+}
+
+TEST_CASE(SeveralStepsInOneFrameSettleTogether) {
+
+    FrameDamage damage;
+    RunFrame(damage, 1);
+
+    damage.Mark(DamageFlag::Entities);
+    damage.EndStep();
+    damage.EndStep();
+
+    CHECK(damage.Has(DamageFlag::Motion));
+    CHECK(RunFrame(damage, 0));
+    CHECK(!RunFrame(damage, 0));
+}
+
+TEST_CASE(ViewProjectionIsOnlyRecomputedOnChange) {
+
+    ViewProjectionCache cache;
+
+    const Affine2D proj = Affine2D::Ortho(-960.0f, 960.0f, -540.0f, 540.0f);
+    Affine2D view = Affine2D::Translation(10.0f, 20.0f);
+
+    CHECK(cache.Update(proj, view));
+    CHECK(!cache.Update(proj, view));
+    CHECK(!cache.Update(proj, view));
+    CHECK(cache.Recomputes() == 1);
+
+    view = Affine2D::Rotation(0.5f) * view;
+
+    CHECK(cache.Update(proj, view));
+    CHECK(cache.Recomputes() == 2);
+
+    const Affine2D expected = proj * view;
+
+    CHECK(cache.ViewProjection().a == expected.a && cache.ViewProjection().tx == expected.tx);
+    CHECK(cache.View().b == view.b);
+
+    // a resize changes the projection alone
+    CHECK(cache.Update(Affine2D::Ortho(-640.0f, 640.0f, -360.0f, 360.0f), view));
+    CHECK(cache.Recomputes() == 3);
+}
+
+TEST_CASE(FlagsHaveNames) {
+
+    CHECK(std::string(DamageFlagName(DamageFlag::Camera)) == "camera");
+    CHECK(std::string(DamageFlagName(DamageFlag::Motion)) == "motion");
+}
+
+int main() { return Core::Test::RunAll(); }
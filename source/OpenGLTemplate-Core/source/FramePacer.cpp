@@ -0,0 +1,297 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FramePacer.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "FramePacer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace Core {
+
+const char* PacingModeName(PacingMode mode) {
+
+    switch (mode) {
+
+        case(PacingMode::VSync): return "vsync";
+        case(PacingMode::Uncapped): return "uncapped";
+        case(PacingMode::Capped): return "capped";
+        case(PacingMode::LowLatency): return "low-latency";
+    }
+
+    return "?";
+}
+
+bool ParsePacingMode(const std::string& name, PacingMode& mode) {
+
+    for (PacingMode candidate : {PacingMode::VSync, PacingMode::Uncapped,
+                                 PacingMode::Capped, PacingMode::LowLatency}) {
+
+        if (name == PacingModeName(candidate)) {
+
+            mode = candidate;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+double SteadyFrameClock::NowSeconds() {
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SteadyFrameClock::SleepFor(double seconds) {
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+}
+
+void SteadyFrameClock::Spin() {
+
+    std::this_thread::yield();
+}
+
+FrameClock& DefaultFrameClock() {
+
+    static SteadyFrameClock clock;
+    return clock;
+}
+
+FramePacer::FramePacer(FrameClock& clock)
+    : clock(clock) {
+
+}
+
+void FramePacer::SetMode(PacingMode new_mode, double rate_hz) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    mode = new_mode;
+
+    if (rate_hz > 0.0) {
+
+        period = 1.0 / rate_hz;
+    }
+
+    scheduled = false;
+}
+
+double FramePacer::OversleepSeconds() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return oversleep;
+}
+
+double FramePacer::PredictedWorkSeconds() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return *std::max_element(std::begin(work_history), std::end(work_history));
+}
+
+FrameTiming FramePacer::BeginFrame() {
+
+    FrameTiming frame;
+    double start = 0.0;     // when the frame may start, 0 at once
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const double now = clock.NowSeconds();
+
+        switch (mode) {
+
+            case(PacingMode::Capped):
+                if (!scheduled || now >= deadline) {
+
+                    deadline = now;
+                }
+
+                start = deadline;
+                frame.present_deadline = deadline + period;
+                deadline += period;
+                scheduled = true;
+                break;
+            case(PacingMode::LowLatency): {
+
+                const double predicted = *std::max_element(std::begin(work_history), std::end(work_history));
+                const double lead = predicted + PACER_LATENCY_MARGIN;
+                double target = scheduled ? deadline + period : now + lead;
+
+                // skip whole periods rather than start too late to make one
+                while (target - lead < now) {
+
+                    target += period;
+                }
+
+                start = target - lead;
+                frame.present_deadline = target;
+                deadline = target;
+                scheduled = true;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    if (start > 0.0) {
+
+        WaitUntil(start);
+    }
+
+    frame.input_time = clock.NowSeconds();
+    return frame;
+}
+
+FrameTiming FramePacer::Unpaced() {
+
+    FrameTiming frame;
+    frame.input_time = clock.NowSeconds();
+
+    return frame;
+}
+
+void FramePacer::BeforePresent(const FrameTiming& frame) {
+
+    bool wait = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const double now = clock.NowSeconds();
+
+        work_history[work_cursor] = now - frame.input_time;
+        work_cursor = (work_cursor + 1) % PACER_WORK_HISTORY;
+
+        if (frame.present_deadline <= 0.0) {
+
+            return;
+        }
+
+        if (now > frame.present_deadline) {
+
+            missed += 1;
+        }
+        else {
+
+            wait = mode == PacingMode::LowLatency;
+        }
+    }
+
+    if (wait) {
+
+        WaitUntil(frame.present_deadline);
+    }
+}
+
+void FramePacer::EndFrame(const FrameTiming& frame) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const double now = clock.NowSeconds();
+    const double latency = now - frame.input_time;
+
+    latency_sum += latency;
+    latency_max = std::max(latency_max, latency);
+
+    if (last_present >= 0.0) {
+
+        const double interval = now - last_present;
+
+        interval_sum += interval;
+        interval_square_sum += interval * interval;
+        intervals += 1;
+    }
+
+    last_present = now;
+    frames += 1;
+}
+
+void FramePacer::SkipFrame() {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    last_present = -1.0;
+    scheduled = false;
+}
+
+void FramePacer::WaitUntil(double until) {
+
+    while (true) {
+
+        double estimate;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            estimate = oversleep;
+        }
+
+        const double remaining = until - clock.NowSeconds();
+        const double sleep = std::min(remaining - PACER_SPIN_SECONDS - estimate, PACER_SLEEP_SLICE);
+
+        if (sleep < PACER_MIN_SLEEP) {
+
+            break;
+        }
+
+        const double before = clock.NowSeconds();
+        clock.SleepFor(sleep);
+        const double overshoot = clock.NowSeconds() - before - sleep;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        oversleep = std::max(overshoot, oversleep * PACER_OVERSLEEP_DECAY);
+    }
+
+    while (clock.NowSeconds() < until) {
+
+        clock.Spin();
+    }
+}
+
+FramePacingStats FramePacer::Stats() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    FramePacingStats stats;
+    stats.frames = frames;
+    stats.missed = missed;
+
+    if (frames > 0) {
+
+        stats.latency_ms = 1e3 * latency_sum / frames;
+        stats.max_latency_ms = 1e3 * latency_max;
+    }
+
+    if (intervals > 0) {
+
+        const double mean = interval_sum / intervals;
+        const double variance = interval_square_sum / intervals - mean * mean;
+
+        stats.interval_ms = 1e3 * mean;
+        stats.jitter_ms = 1e3 * std::sqrt(std::max(variance, 0.0));
+    }
+
+    return stats;
+}
+
+void FramePacer::ResetStats() {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    frames = 0;
+    intervals = 0;
+    missed = 0;
+    latency_sum = 0.0;
+    latency_max = 0.0;
+    interval_sum = 0.0;
+    interval_square_sum = 0.0;
+}
+
+} // namespace Core
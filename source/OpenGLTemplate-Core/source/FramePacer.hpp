@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FramePacer.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#define PACER_SPIN_SECONDS      0.0002  // always spun, never slept, before a deadline
+#define PACER_SLEEP_SLICE       0.001   // longest single sleep while waiting
+#define PACER_MIN_SLEEP         0.0001  // shorter sleeps are spun instead
+#define PACER_OVERSLEEP_GUESS   0.001   // assumed sleep overshoot until one is measured
+#define PACER_OVERSLEEP_DECAY   0.95    // per sleep, so one late wake-up is remembered
+#define PACER_LATENCY_MARGIN    0.0005  // low-latency slack between work and deadline
+#define PACER_WORK_HISTORY      16      // frames of work time low-latency plans with
+
+namespace Core {
+
+enum class PacingMode {
+
+    VSync,          // swap interval 1, the swap blocks
+    Uncapped,       // swap interval 0, no waiting
+    Capped,         // swap interval 0, frames start at most rate_hz per second
+    LowLatency,     // swap interval 0, frames start as late as their work allows
+};
+
+const char* PacingModeName(PacingMode mode);
+
+// "vsync", "uncapped", "capped" or "low-latency"; false leaves mode unchanged
+bool ParsePacingMode(const std::string& name, PacingMode& mode);
+
+////////////////////////////////////////////////////////////////////////////////
+// Frame Clock
+// --Time source the pacer reads and waits on. SteadyFrameClock is the real
+//   one; tests pass a mock that advances when slept or spun on.
+////////////////////////////////////////////////////////////////////////////////
+class FrameClock {
+
+public:
+    virtual ~FrameClock() = default;
+
+    virtual double NowSeconds() = 0;
+    virtual void SleepFor(double seconds) = 0;
+    virtual void Spin() = 0;
+};
+
+class SteadyFrameClock : public FrameClock {
+
+public:
+    double NowSeconds() override;
+    void SleepFor(double seconds) override;
+    void Spin() override;
+};
+
+FrameClock& DefaultFrameClock();
+
+struct FramePacingStats {
+
+    std::uint64_t frames = 0;
+    double latency_ms = 0.0;        // mean from input sampling to present
+    double max_latency_ms = 0.0;
+    double interval_ms = 0.0;       // mean from present to present
+    double jitter_ms = 0.0;         // standard deviation of present intervals
+    std::uint64_t missed = 0;       // capped and low-latency frames late for their deadline
+};
+
+// carries one frame from BeginFrame() to BeforePresent() and EndFrame()
+struct FrameTiming {
+
+    double input_time = 0.0;        // when BeginFrame() returned
+    double present_deadline = 0.0;  // 0 without one
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Frame Pacer
+// --Call BeginFrame() right before sampling input, BeforePresent() right
+//   before swapping and EndFrame() once the swap returns; each may wait.
+// --Capped frames start on a fixed cadence of 1 / rate_hz. A late frame
+//   restarts the cadence instead of rushing the next ones to catch up.
+// --LowLatency keeps the same cadence for presents, but delays the start of
+//   each frame to the deadline minus the longest recent work time, so input
+//   is sampled as late as possible. BeforePresent() holds the frame until
+//   its deadline.
+// --Waits sleep in short slices and spin the last stretch; how much to spin
+//   follows the largest recent sleep overshoot, so wake-ups stay within a
+//   spin of the deadline on coarse OS timers.
+// --BeginFrame() may run on one thread and BeforePresent() and EndFrame() on
+//   another, e.g. a render thread presenting a frame behind; FrameTiming
+//   carries each frame across and the shared state is behind a mutex.
+////////////////////////////////////////////////////////////////////////////////
+class FramePacer {
+
+public:
+    explicit FramePacer(FrameClock& clock = DefaultFrameClock());
+
+    // rate_hz applies to Capped and LowLatency; 0 keeps the current rate
+    void SetMode(PacingMode mode, double rate_hz = 0.0);
+
+    PacingMode Mode() const { return mode; }
+    double RateHz() const { return 1.0 / period; }
+
+    // for glfwSwapInterval
+    int SwapInterval() const { return mode == PacingMode::VSync ? 1 : 0; }
+
+    FrameTiming BeginFrame();
+    void BeforePresent(const FrameTiming& frame);
+    void EndFrame(const FrameTiming& frame);
+
+    // a frame begun but not presented, e.g. skipped because nothing changed;
+    // the gap it leaves is not counted as a present interval
+    void SkipFrame();
+
+    // a frame outside the cadence, e.g. one redrawn during a window resize
+    FrameTiming Unpaced();
+
+    // returns once clock.NowSeconds() >= until
+    void WaitUntil(double until);
+
+    double OversleepSeconds() const;
+
+    // longest work (BeginFrame to BeforePresent) of the recent frames
+    double PredictedWorkSeconds() const;
+
+    FramePacingStats Stats() const;
+    void ResetStats();
+
+private:
+    FrameClock& clock;
+    mutable std::mutex mutex;
+
+    PacingMode mode = PacingMode::VSync;
+    double period = 1.0 / 60.0;
+    double oversleep = PACER_OVERSLEEP_GUESS;
+
+    bool scheduled = false;         // deadline below belongs to the current cadence
+    double deadline = 0.0;          // capped: next start, low latency: next present
+
+    double work_history[PACER_WORK_HISTORY] {};
+    std::size_t work_cursor = 0;
+
+    double last_present = -1.0;
+
+    std::uint64_t frames = 0;
+    std::uint64_t intervals = 0;
+    std::uint64_t missed = 0;
+    double latency_sum = 0.0;
+    double latency_max = 0.0;
+    double interval_sum = 0.0;
+    double interval_square_sum = 0.0;
+};
+
+} // namespace Core
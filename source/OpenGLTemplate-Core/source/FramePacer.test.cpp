@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: FramePacer.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "FramePacer.hpp"
+#include "UnitTest.hpp"
+
+#include <vector>
+
+using namespace Core;
+
+// advances only when slept or spun on; sleeps overshoot like a coarse OS timer
+class MockClock : public FrameClock {
+
+public:
+    double NowSeconds() override { return now; }
+    void SleepFor(double seconds) override { now += seconds + sleep_overshoot; sleeps += 1; }
+    void Spin() override { now += spin_step; spins += 1; }
+
+    void Work(double seconds) { now += seconds; }
+
+    double now = 100.0;
+    double sleep_overshoot = 0.0;
+    double spin_step = 0.00001;
+
+    int sleeps = 0;
+    int spins = 0;
+};
+
+// one frame of `work` seconds, returns when BeginFrame let it start
+static double RunFrame(FramePacer& pacer, MockClock& clock, double work) {
+
+    const FrameTiming frame = pacer.BeginFrame();
+
+    clock.Work(work);
+    pacer.BeforePresent(frame);
+    pacer.EndFrame(frame);
+
+    return frame.input_time;
+}
+
+TEST_CASE(ModesParseByName) {
+
+    PacingMode mode = PacingMode::VSync;
+
+    CHECK(ParsePacingMode("low-latency", mode));
+    CHECK(mode == PacingMode::LowLatency);
+    CHECK(ParsePacingMode("capped", mode));
+    CHECK(mode == PacingMode::Capped);
+    CHECK(!ParsePacingMode("fast", mode));
+    CHECK(mode == PacingMode::Capped);
+}
+
+TEST_CASE(VSyncAndUncappedNeverWait) {
+
+    MockClock clock;
+    FramePacer pacer(clock);
+
+    CHECK(pacer.SwapInterval() == 1);
+
+    RunFrame(pacer, clock, 0.001);
+    pacer.SetMode(PacingMode::Uncapped);
+    RunFrame(pacer, clock, 0.001);
+
+    CHECK(pacer.SwapInterval() == 0);
+    CHECK(clock.sleeps == 0);
+    CHECK(clock.spins == 0);
+    CHECK_NEAR(clock.now, 100.002, 1e-9);
+}
+
+TEST_CASE(WaitsWakeWithinASpinOfTheDeadline) {
+
+    MockClock clock;
+    clock.sleep_overshoot = 0.003;
+
+    FramePacer pacer(clock);
+
+    // the first waits learn the overshoot; later ones must not be late
+    for (int wait = 0; wait < 20; ++wait) {
+
+        const double deadline = clock.now + 0.016;
+        pacer.WaitUntil(deadline);
+
+        if (wait > 0) {
+
+            CHECK(clock.now >= deadline);
+            CHECK(clock.now - deadline <= clock.spin_step);
+        }
+    }
+
+    CHECK_NEAR(pacer.OversleepSeconds(), 0.003, 1e-9);
+    CHECK(clock.sleeps > 0);
+}
+
+TEST_CASE(CappedFramesStartOnAFixedCadence) {
+
+    MockClock clock;
+    clock.sleep_overshoot = 0.0005;
+
+    FramePacer pacer(clock);
+    pacer.SetMode(PacingMode::Capped, 100.0);
+
+    std::vector<double> starts;
+
+    for (int frame = 0; frame < 50; ++frame) {
+
+        starts.push_back(RunFrame(pacer, clock, frame % 2 ? 0.002 : 0.006));
+    }
+
+    for (std::size_t frame = 1; frame < starts.size(); ++frame) {
+
+        CHECK_NEAR(starts[frame] - starts[frame - 1], 0.010, 0.0001);
+    }
+
+    const FramePacingStats stats = pacer.Stats();
+
+    CHECK(stats.frames == 50);
+    CHECK(stats.missed == 0);
+    CHECK_NEAR(stats.interval_ms, 10.0, 0.1);
+}
+
+TEST_CASE(LateCappedFramesRestartTheCadence) {
+
+    MockClock clock;
+    FramePacer pacer(clock);
+    pacer.SetMode(PacingMode::Capped, 100.0);
+
+    RunFrame(pacer, clock, 0.002);
+    const double late_start = RunFrame(pacer, clock, 0.025);
+    const double next_start = RunFrame(pacer, clock, 0.002);
+
+    // no catch-up burst: the next frame starts as soon as the late one ends
+    CHECK_NEAR(next_start - late_start, 0.025, 1e-9);
+    CHECK(pacer.Stats().missed == 1);
+}
+
+TEST_CASE(LowLatencySamplesInputLateAndKeepsTheRate) {
+
+    MockClock clock;
+    FramePacer pacer(clock);
+    pacer.SetMode(PacingMode::LowLatency, 100.0);
+
+    for (int frame = 0; frame < 20; ++frame) {
+
+        RunFrame(pacer, clock, 0.002);
+    }
+
+    pacer.ResetStats();
+
+    for (int frame = 0; frame < 50; ++frame) {
+
+        RunFrame(pacer, clock, 0.002);
+    }
+
+    const FramePacingStats stats = pacer.Stats();
+
+    // input to present is the work plus the margin, not a whole period
+    CHECK_NEAR(stats.latency_ms, 1e3 * (0.002 + PACER_LATENCY_MARGIN), 0.05);
+    CHECK_NEAR(stats.interval_ms, 10.0, 0.05);
+    CHECK(stats.jitter_ms < 0.05);
+    CHECK(stats.missed == 0);
+}
+
+TEST_CASE(LowLatencyPlansForTheLongestRecentWork) {
+
+    MockClock clock;
+    FramePacer pacer(clock);
+    pacer.SetMode(PacingMode::LowLatency, 100.0);
+
+    for (int frame = 0; frame < 10; ++frame) {
+
+        RunFrame(pacer, clock, frame == 5 ? 0.004 : 0.001);
+    }
+
+    CHECK_NEAR(pacer.PredictedWorkSeconds(), 0.004, 1e-9);
+
+    pacer.ResetStats();
+    RunFrame(pacer, clock, 0.004);
+
+    CHECK(pacer.Stats().missed == 0);
+}
+
+TEST_CASE(UnpacedFramesSkipTheCadence) {
+
+    MockClock clock;
+    FramePacer pacer(clock);
+    pacer.SetMode(PacingMode::LowLatency, 100.0);
+
+    RunFrame(pacer, clock, 0.002);
+
+    const FrameTiming frame = pacer.Unpaced();
+
+    CHECK(frame.input_time == clock.now);
+    CHECK(frame.present_deadline == 0.0);
+
+    clock.Work(0.050);
+    pacer.BeforePresent(frame);
+    pacer.EndFrame(frame);
+
+    CHECK(pacer.Stats().frames == 2);
+    CHECK(pacer.Stats().missed == 1);   // only the first frame, it had no work history
+}
+
+TEST_CASE(SkippedFramesLeaveNoInterval) {
+
+    MockClock clock;
+    FramePacer pacer(clock);
+    pacer.SetMode(PacingMode::Capped, 100.0);
+
+    RunFrame(pacer, clock, 0.002);
+    RunFrame(pacer, clock, 0.002);
+
+    // idle for a second, then a change is drawn right away
+    pacer.BeginFrame();
+    pacer.SkipFrame();
+    clock.Work(1.0);
+
+    const double start = clock.now;
+
+    CHECK_NEAR(RunFrame(pacer, clock, 0.002), start, 0.0001);
+
+    const FramePacingStats stats = pacer.Stats();
+
+    CHECK(stats.frames == 3);
+    CHECK_NEAR(stats.interval_ms, 10.0, 0.1);
+}
+
+int main() { return Core::Test::RunAll(); }
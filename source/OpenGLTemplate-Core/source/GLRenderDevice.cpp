@@ -0,0 +1,430 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: GLRenderDevice.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "GLRenderDevice.hpp"
+
+#include <glad/glad.h>
+
+#include "IndexedMesh.hpp"
+#include "Logger.hpp"
+
+#define FENCE_WAIT_TIMEOUT_NS   100000000   // 100 ms per glClientWaitSync
+#define SHADER_COMPILER_THREADS 0xFFFFFFFF  // as many as the driver likes
+
+namespace Core {
+
+static GLenum ToGL(BufferUsage usage) {
+
+    switch (usage) {
+
+        case(BufferUsage::Static): return GL_STATIC_DRAW;
+        case(BufferUsage::Dynamic): return GL_DYNAMIC_DRAW;
+        case(BufferUsage::Stream): return GL_STREAM_DRAW;
+    }
+
+    return GL_STATIC_DRAW;
+}
+
+static GLenum ToGL(AttributeFormat format) {
+
+    switch (format) {
+
+        case(AttributeFormat::Float): return GL_FLOAT;
+        case(AttributeFormat::Short): return GL_SHORT;
+    }
+
+    return GL_FLOAT;
+}
+
+static GLenum ToGL(PrimitiveType primitive) {
+
+    switch (primitive) {
+
+        case(PrimitiveType::LineStrip): return GL_LINE_STRIP;
+        case(PrimitiveType::Lines): return GL_LINES;
+        case(PrimitiveType::Triangles): return GL_TRIANGLES;
+    }
+
+    return GL_LINE_STRIP;
+}
+
+GLRenderDevice::GLRenderDevice() {
+
+    glEnable(GL_PRIMITIVE_RESTART);
+    glPrimitiveRestartIndex(PRIMITIVE_RESTART_INDEX);
+
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+
+        const GLubyte* value = glGetString(name);
+
+        driver_description += value ? reinterpret_cast<const char*>(value) : "";
+        driver_description += '|';
+    }
+
+    // the KHR extension is the ARB one promoted, drivers may expose either
+#ifdef GL_KHR_parallel_shader_compile
+    if (GLAD_GL_KHR_parallel_shader_compile) {
+
+        glMaxShaderCompilerThreadsKHR(SHADER_COMPILER_THREADS);
+        return;
+    }
+#endif
+
+    if (GLAD_GL_ARB_parallel_shader_compile) {
+
+        glMaxShaderCompilerThreadsARB(SHADER_COMPILER_THREADS);
+    }
+}
+
+GLRenderDevice::~GLRenderDevice() {
+
+    for (auto& fence : fences) {
+
+        glDeleteSync(static_cast<GLsync>(fence.second));
+    }
+
+    for (auto& program : programs) {
+
+        if (program) {
+
+            program->Destroy();
+        }
+    }
+}
+
+const ShaderProgram* GLRenderDevice::Program(ProgramId program) {
+
+    if (program == 0 || program > programs.size()) {
+
+        return nullptr;
+    }
+
+    FinishProgram(program);
+
+    return programs[program - 1].get();
+}
+
+void GLRenderDevice::FinishPrograms() {
+
+    while (!pending_programs.empty()) {
+
+        FinishProgram(pending_programs.begin()->first);
+    }
+}
+
+void GLRenderDevice::FinishProgram(ProgramId program) {
+
+    auto pending = pending_programs.find(program);
+
+    if (pending == pending_programs.end()) {
+
+        return;
+    }
+
+    const PendingProgram entry = pending->second;
+    pending_programs.erase(pending);
+
+    ShaderProgram& shader = *programs[program - 1];
+
+    if (!shader.Finish()) {
+
+        shader.Destroy();
+        programs[program - 1].reset();
+        return;
+    }
+
+    ShaderBinary binary;
+
+    if (entry.store && shader.GetBinary(binary)) {
+
+        shader_cache->Store(entry.key, binary);
+    }
+}
+
+ProgramId GLRenderDevice::CreateProgramImpl(const char* vertex_source, const char* fragment_source) {
+
+    auto program = std::make_unique<ShaderProgram>();
+
+    const bool use_cache = shader_cache && ShaderProgram::BinariesSupported();
+    const ShaderCacheKey key = use_cache ? HashShaderSources(vertex_source, fragment_source, driver_description) : 0;
+
+    ShaderBinary binary;
+
+    if (use_cache && shader_cache->Load(key, binary)) {
+
+        if (program->CreateFromBinary(binary)) {
+
+            programs.push_back(std::move(program));
+            return static_cast<ProgramId>(programs.size());
+        }
+
+        LOG_WARN("Shader Cache:\tdriver rejected %016llx, compiling from source",
+                 static_cast<unsigned long long>(key));
+
+        shader_cache->Invalidate(key);
+    }
+
+    program->Begin(vertex_source, fragment_source, use_cache);
+    programs.push_back(std::move(program));
+
+    const ProgramId id = static_cast<ProgramId>(programs.size());
+    pending_programs[id] = PendingProgram{key, use_cache};
+
+    return id;
+}
+
+void GLRenderDevice::DestroyProgramImpl(ProgramId program) {
+
+    if (program == 0 || program > programs.size() || !programs[program - 1]) {
+
+        return;
+    }
+
+    if (active_program == programs[program - 1].get()) {
+
+        active_program = nullptr;
+    }
+
+    pending_programs.erase(program);
+
+    programs[program - 1]->Destroy();
+    programs[program - 1].reset();
+}
+
+bool GLRenderDevice::BindUniformBlockImpl(ProgramId program, NameHash block_name, unsigned int binding) {
+
+    const ShaderProgram* shader = Program(program);
+    return shader && shader->BindUniformBlock(block_name, binding);
+}
+
+BufferId GLRenderDevice::CreateBufferImpl(BufferTarget, std::size_t size, const void* data, BufferUsage usage) {
+
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, data, ToGL(usage));
+
+    buffer_usages[buffer] = usage;
+    return buffer;
+}
+
+void GLRenderDevice::DestroyBufferImpl(BufferId buffer) {
+
+    GLuint name = buffer;
+    glDeleteBuffers(1, &name);
+
+    buffer_usages.erase(buffer);
+    mapped_buffers.erase(buffer);
+}
+
+void GLRenderDevice::ReallocateBufferImpl(BufferId buffer, std::size_t size) {
+
+    // immutable storage cannot be respecified
+    if (mapped_buffers.count(buffer)) {
+
+        return;
+    }
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, ToGL(buffer_usages[buffer]));
+}
+
+void GLRenderDevice::UploadBufferImpl(BufferId buffer, std::size_t offset, std::size_t size, const void* data) {
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data);
+}
+
+void GLRenderDevice::BindUniformBufferImpl(BufferId buffer, unsigned int binding) {
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+}
+
+BufferId GLRenderDevice::CreateMappedBufferImpl(BufferTarget, std::size_t size, void** mapping) {
+
+    // the glad flags stay zero until a context has been loaded
+    if (!GLAD_GL_VERSION_4_4 && !GLAD_GL_ARB_buffer_storage) {
+
+        return 0;
+    }
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+
+    *mapping = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
+
+    if (!*mapping) {
+
+        glDeleteBuffers(1, &buffer);
+        return 0;
+    }
+
+    buffer_usages[buffer] = BufferUsage::Stream;
+    mapped_buffers.insert(buffer);
+    return buffer;
+}
+
+FenceId GLRenderDevice::InsertFenceImpl() {
+
+    const FenceId fence = next_fence++;
+    fences[fence] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    return fence;
+}
+
+bool GLRenderDevice::IsFenceSignaledImpl(FenceId fence) {
+
+    auto found = fences.find(fence);
+
+    if (found == fences.end()) {
+
+        return true;
+    }
+
+    const GLenum status = glClientWaitSync(static_cast<GLsync>(found->second), 0, 0);
+
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+void GLRenderDevice::WaitFenceImpl(FenceId fence) {
+
+    auto found = fences.find(fence);
+
+    if (found == fences.end()) {
+
+        return;
+    }
+
+    // the first wait flushes, so the fence is sure to reach the GPU
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+
+    while (glClientWaitSync(static_cast<GLsync>(found->second), flags, FENCE_WAIT_TIMEOUT_NS)
+           == GL_TIMEOUT_EXPIRED) {
+
+        flags = 0;
+    }
+}
+
+void GLRenderDevice::DeleteFenceImpl(FenceId fence) {
+
+    auto found = fences.find(fence);
+
+    if (found != fences.end()) {
+
+        glDeleteSync(static_cast<GLsync>(found->second));
+        fences.erase(found);
+    }
+}
+
+VertexArrayId GLRenderDevice::CreateVertexArrayImpl(BufferId index_buffer) {
+
+    GLuint vertex_array = 0;
+    glGenVertexArrays(1, &vertex_array);
+
+    glBindVertexArray(vertex_array);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+
+    // restore what the base class believes is bound
+    glBindVertexArray(CurrentVertexArray());
+
+    return vertex_array;
+}
+
+void GLRenderDevice::DestroyVertexArrayImpl(VertexArrayId vertex_array) {
+
+    GLuint name = vertex_array;
+    glDeleteVertexArrays(1, &name);
+}
+
+void GLRenderDevice::SetVertexAttributeImpl(const VertexAttribute& attribute) {
+
+    glBindBuffer(GL_ARRAY_BUFFER, attribute.buffer);
+
+    glVertexAttribPointer(attribute.location, attribute.components, ToGL(attribute.format),
+                          attribute.normalized ? GL_TRUE : GL_FALSE,
+                          static_cast<GLsizei>(attribute.stride),
+                          reinterpret_cast<const void*>(attribute.offset));
+
+    glVertexAttribDivisor(attribute.location, attribute.divisor);
+    glEnableVertexAttribArray(attribute.location);
+}
+
+void GLRenderDevice::SetViewportImpl(int x, int y, int width, int height) {
+
+    glViewport(x, y, width, height);
+}
+
+void GLRenderDevice::ClearImpl(const float* color_vec) {
+
+    glClearColor(color_vec[0], color_vec[1], color_vec[2], color_vec[3]);
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void GLRenderDevice::UseProgramImpl(ProgramId program) {
+
+    active_program = Program(program);
+
+    if (active_program) {
+
+        active_program->Use();
+    }
+    else {
+
+        glUseProgram(0);
+    }
+}
+
+void GLRenderDevice::BindVertexArrayImpl(VertexArrayId vertex_array) {
+
+    glBindVertexArray(vertex_array);
+}
+
+void GLRenderDevice::SetUniformImpl(NameHash name, UniformType type, const float* value) {
+
+    if (!active_program) {
+
+        return;
+    }
+
+    switch (type) {
+
+        case(UniformType::Float):
+            active_program->SetFloat(name, value[0]);
+            break;
+        case(UniformType::Vec4):
+            active_program->SetVec4(name, value);
+            break;
+        case(UniformType::Mat4):
+            active_program->SetMat4(name, value);
+            break;
+    }
+}
+
+void GLRenderDevice::DrawImpl(const DrawCall& draw) {
+
+    const void* first_index = reinterpret_cast<const void*>(draw.first_index * sizeof(std::uint16_t));
+
+    if (draw.instance_count == 1) {
+
+        glDrawElementsBaseVertex(ToGL(draw.primitive), draw.index_count, GL_UNSIGNED_SHORT,
+                                 first_index, draw.base_vertex);
+    }
+    else {
+
+        glDrawElementsInstancedBaseVertex(ToGL(draw.primitive), draw.index_count, GL_UNSIGNED_SHORT,
+                                          first_index, draw.instance_count, draw.base_vertex);
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: GLRenderDevice.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "RenderDevice.hpp"
+#include "ShaderCache.hpp"
+#include "ShaderProgram.hpp"
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// GL Render Device
+// --OpenGL 3.3 core backend. Construct it with the context current, after
+//   GLAD has loaded; it enables primitive restart with
+//   PRIMITIVE_RESTART_INDEX.
+// --Buffer and vertex array ids are the GL names. Buffer data goes through
+//   GL_COPY_WRITE_BUFFER so uploads never disturb a vertex array's bindings.
+// --Mapped buffers need GL 4.4 or ARB_buffer_storage; fences are sync objects.
+// --CreateProgram() returns before the program is linked. Each program is
+//   finished on its first use (or by FinishPrograms()), so with
+//   KHR_parallel_shader_compile the driver compiles while the caller does
+//   other init work.
+// --With a ShaderCache set, programs are loaded from cached binaries and
+//   linked ones are stored; a binary the driver rejects is invalidated and
+//   the program is compiled from source instead.
+////////////////////////////////////////////////////////////////////////////////
+class GLRenderDevice : public RenderDevice {
+
+public:
+    GLRenderDevice();
+    ~GLRenderDevice() override;
+
+    const char* Name() const override { return "OpenGL 3.3"; }
+
+    // finishes the program if it is still compiling; nullptr for unknown ids
+    // and programs that failed to link
+    const ShaderProgram* Program(ProgramId program);
+
+    // set before creating programs; the cache must outlive them
+    void SetShaderCache(ShaderCache* cache) { shader_cache = cache; }
+
+    // vendor, renderer and version strings, part of every shader cache key
+    const std::string& DriverDescription() const { return driver_description; }
+
+    std::size_t PendingPrograms() const { return pending_programs.size(); }
+    void FinishPrograms();
+
+protected:
+    ProgramId CreateProgramImpl(const char* vertex_source, const char* fragment_source) override;
+    void DestroyProgramImpl(ProgramId program) override;
+    bool BindUniformBlockImpl(ProgramId program, NameHash block_name, unsigned int binding) override;
+
+    BufferId CreateBufferImpl(BufferTarget target, std::size_t size, const void* data, BufferUsage usage) override;
+    void DestroyBufferImpl(BufferId buffer) override;
+    void ReallocateBufferImpl(BufferId buffer, std::size_t size) override;
+    void UploadBufferImpl(BufferId buffer, std::size_t offset, std::size_t size, const void* data) override;
+    void BindUniformBufferImpl(BufferId buffer, unsigned int binding) override;
+    BufferId CreateMappedBufferImpl(BufferTarget target, std::size_t size, void** mapping) override;
+
+    FenceId InsertFenceImpl() override;
+    bool IsFenceSignaledImpl(FenceId fence) override;
+    void WaitFenceImpl(FenceId fence) override;
+    void DeleteFenceImpl(FenceId fence) override;
+
+    VertexArrayId CreateVertexArrayImpl(BufferId index_buffer) override;
+    void DestroyVertexArrayImpl(VertexArrayId vertex_array) override;
+    void SetVertexAttributeImpl(const VertexAttribute& attribute) override;
+
+    void SetViewportImpl(int x, int y, int width, int height) override;
+    void ClearImpl(const float* color_vec) override;
+
+    void UseProgramImpl(ProgramId program) override;
+    void BindVertexArrayImpl(VertexArrayId vertex_array) override;
+    void SetUniformImpl(NameHash name, UniformType type, const float* value) override;
+    void DrawImpl(const DrawCall& draw) override;
+
+private:
+    struct PendingProgram {
+
+        ShaderCacheKey key = 0;
+        bool store = false;         // write the linked binary to the cache
+    };
+
+    void FinishProgram(ProgramId program);
+
+    // ProgramId - 1 indexes programs; destroyed slots are null
+    std::vector<std::unique_ptr<ShaderProgram>> programs;
+    const ShaderProgram* active_program = nullptr;
+
+    std::unordered_map<ProgramId, PendingProgram> pending_programs;
+    ShaderCache* shader_cache = nullptr;
+    std::string driver_description;
+
+    std::unordered_map<BufferId, BufferUsage> buffer_usages;
+    std::unordered_set<BufferId> mapped_buffers;
+
+    // GLsync handles by FenceId, kept opaque so this header needs no GL types
+    std::unordered_map<FenceId, void*> fences;
+    FenceId next_fence = 1;
+};
+
+} // namespace Core
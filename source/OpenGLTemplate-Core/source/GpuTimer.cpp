@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: GpuTimer.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "GpuTimer.hpp"
+
+#include <glad/glad.h>
+
+namespace Core {
+
+bool GpuTimer::Init(Profiler& target, const char* timer_name) {
+
+    // the glad flags stay zero until a context has been loaded
+    if (!GLAD_GL_VERSION_3_3 && !GLAD_GL_ARB_timer_query) {
+
+        return false;
+    }
+
+    int counter_bits = 0;
+    glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &counter_bits);
+
+    if (counter_bits == 0) {
+
+        return false;
+    }
+
+    glGenQueries(GPU_TIMER_QUERY_COUNT, queries);
+
+    profiler = &target;
+    name = timer_name;
+    issued = 0;
+    collected = 0;
+
+    return true;
+}
+
+void GpuTimer::Destroy() {
+
+    if (!Available()) {
+
+        return;
+    }
+
+    if (active) {
+
+        glEndQuery(GL_TIME_ELAPSED);
+        active = false;
+    }
+
+    glDeleteQueries(GPU_TIMER_QUERY_COUNT, queries);
+    profiler = nullptr;
+}
+
+void GpuTimer::BeginFrame() {
+
+    if (!Available() || active) {
+
+        return;
+    }
+
+    Collect();
+
+    // every query object is still in flight, skip rather than wait
+    if (issued - collected >= GPU_TIMER_QUERY_COUNT) {
+
+        skipped_frames += 1;
+        return;
+    }
+
+    const std::size_t slot = issued % GPU_TIMER_QUERY_COUNT;
+
+    begin_ns[slot] = profiler->NowNanoseconds();
+    glBeginQuery(GL_TIME_ELAPSED, queries[slot]);
+
+    active = true;
+}
+
+void GpuTimer::EndFrame() {
+
+    if (!active) {
+
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+
+    issued += 1;
+    active = false;
+}
+
+void GpuTimer::Collect() {
+
+    if (!Available()) {
+
+        return;
+    }
+
+    // queries complete in order, stop at the first one still pending
+    while (collected < issued) {
+
+        const std::size_t slot = collected % GPU_TIMER_QUERY_COUNT;
+
+        int available = 0;
+        glGetQueryObjectiv(queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (!available) {
+
+            break;
+        }
+
+        GLuint64 elapsed_ns = 0;
+        glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &elapsed_ns);
+
+        profiler->RecordGpuTime(name, begin_ns[slot], elapsed_ns * 1e-6);
+        collected += 1;
+    }
+}
+
+} // namespace Core
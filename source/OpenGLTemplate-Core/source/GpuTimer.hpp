@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: GpuTimer.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+
+#include "Profiler.hpp"
+
+#define GPU_TIMER_QUERY_COUNT   4       // frames in flight before a query is reused
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// GPU Timer
+// --GL_TIME_ELAPSED query around each frame's GL work, one query object per
+//   frame in flight. Results are polled with GL_QUERY_RESULT_AVAILABLE a few
+//   frames later and forwarded to the profiler; nothing ever waits on the GPU.
+// --If every query is still pending when a frame begins, that frame is not
+//   timed rather than stalling on the oldest result.
+// --Init() returns false without a context or timer query support (GL 3.3
+//   or ARB_timer_query); every other call is then a no-op.
+////////////////////////////////////////////////////////////////////////////////
+class GpuTimer {
+
+public:
+    bool Init(Profiler& profiler, const char* name = "GPU Frame");
+    void Destroy();
+
+    bool Available() const { return profiler != nullptr; }
+
+    void BeginFrame();
+    void EndFrame();
+
+    // forwards every finished query to the profiler without blocking
+    void Collect();
+
+    std::uint64_t SkippedFrames() const { return skipped_frames; }
+
+private:
+    Profiler* profiler = nullptr;
+    const char* name = nullptr;
+
+    unsigned int queries[GPU_TIMER_QUERY_COUNT] {};
+    std::int64_t begin_ns[GPU_TIMER_QUERY_COUNT] {};
+
+    // queries issued and queries read back, oldest pending is collected % count
+    std::uint64_t issued = 0;
+    std::uint64_t collected = 0;
+
+    bool active = false;
+    std::uint64_t skipped_frames = 0;
+};
+
+} // namespace Core
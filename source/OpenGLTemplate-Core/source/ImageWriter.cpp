@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ImageWriter.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ImageWriter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+namespace Core {
+
+static void AppendBigEndian(std::vector<std::uint8_t>& out, std::uint32_t value) {
+
+    out.push_back(static_cast<std::uint8_t>(value >> 24));
+    out.push_back(static_cast<std::uint8_t>(value >> 16));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+std::uint32_t Crc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc) {
+
+    static const std::array<std::uint32_t, 256> table = [] {
+
+        std::array<std::uint32_t, 256> entries {};
+
+        for (std::uint32_t n = 0; n < 256; ++n) {
+
+            std::uint32_t c = n;
+
+            for (int bit = 0; bit < 8; ++bit) {
+
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+
+            entries[n] = c;
+        }
+
+        return entries;
+    }();
+
+    crc = ~crc;
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+std::uint32_t Adler32(const std::uint8_t* data, std::size_t size, std::uint32_t adler) {
+
+    std::uint32_t a = adler & 0xFFFF;
+    std::uint32_t b = adler >> 16;
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+        a = (a + data[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+
+    return (b << 16) | a;
+}
+
+std::vector<std::uint8_t> EncodePpm(const std::uint32_t* rgba, int width, int height) {
+
+    char header[64];
+    const int header_size = std::snprintf(header, sizeof(header), "P6\n%d %d\n255\n", width, height);
+
+    std::vector<std::uint8_t> out(header, header + header_size);
+    out.reserve(out.size() + static_cast<std::size_t>(width) * height * 3);
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(width) * height; ++i) {
+
+        out.push_back(static_cast<std::uint8_t>(rgba[i]));
+        out.push_back(static_cast<std::uint8_t>(rgba[i] >> 8));
+        out.push_back(static_cast<std::uint8_t>(rgba[i] >> 16));
+    }
+
+    return out;
+}
+
+static void AppendChunk(std::vector<std::uint8_t>& out, const char* type,
+                        const std::vector<std::uint8_t>& data) {
+
+    AppendBigEndian(out, static_cast<std::uint32_t>(data.size()));
+
+    const std::size_t type_offset = out.size();
+
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+
+    // the crc covers the chunk type and data, not the length
+    AppendBigEndian(out, Crc32(out.data() + type_offset, out.size() - type_offset));
+}
+
+std::vector<std::uint8_t> EncodePng(const std::uint32_t* rgba, int width, int height) {
+
+    static const std::uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    std::vector<std::uint8_t> out(signature, signature + 8);
+
+    std::vector<std::uint8_t> header;
+    AppendBigEndian(header, static_cast<std::uint32_t>(width));
+    AppendBigEndian(header, static_cast<std::uint32_t>(height));
+    header.insert(header.end(), {8, 6, 0, 0, 0});     // 8-bit RGBA, no interlace
+
+    AppendChunk(out, "IHDR", header);
+
+    // every scanline starts with filter type 0 (none)
+    const std::size_t row_bytes = static_cast<std::size_t>(width) * 4 + 1;
+    std::vector<std::uint8_t> raw(row_bytes * height);
+
+    for (int y = 0; y < height; ++y) {
+
+        std::uint8_t* row = raw.data() + row_bytes * y;
+        row[0] = 0;
+
+        for (int x = 0; x < width; ++x) {
+
+            const std::uint32_t pixel = rgba[static_cast<std::size_t>(y) * width + x];
+
+            row[1 + x * 4 + 0] = static_cast<std::uint8_t>(pixel);
+            row[1 + x * 4 + 1] = static_cast<std::uint8_t>(pixel >> 8);
+            row[1 + x * 4 + 2] = static_cast<std::uint8_t>(pixel >> 16);
+            row[1 + x * 4 + 3] = static_cast<std::uint8_t>(pixel >> 24);
+        }
+    }
+
+    // zlib stream of stored deflate blocks, at most 65535 bytes each
+    std::vector<std::uint8_t> zlib = {0x78, 0x01};
+
+    std::size_t offset = 0;
+
+    do {
+
+        const std::size_t block = std::min<std::size_t>(raw.size() - offset, 65535);
+        const bool last = offset + block == raw.size();
+
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(static_cast<std::uint8_t>(block));
+        zlib.push_back(static_cast<std::uint8_t>(block >> 8));
+        zlib.push_back(static_cast<std::uint8_t>(~block));
+        zlib.push_back(static_cast<std::uint8_t>(~block >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + block);
+
+        offset += block;
+
+    } while (offset < raw.size());
+
+    AppendBigEndian(zlib, Adler32(raw.data(), raw.size()));
+
+    AppendChunk(out, "IDAT", zlib);
+    AppendChunk(out, "IEND", {});
+
+    return out;
+}
+
+bool WriteImage(const std::string& path, const std::uint32_t* rgba, int width, int height) {
+
+    const bool ppm = path.size() >= 4 && path.compare(path.size() - 4, 4, ".ppm") == 0;
+
+    const std::vector<std::uint8_t> data = ppm ? EncodePpm(rgba, width, height)
+                                               : EncodePng(rgba, width, height);
+
+    std::ofstream file(path, std::ios::binary);
+
+    if (!file) {
+
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(file);
+}
+
+} // namespace Core
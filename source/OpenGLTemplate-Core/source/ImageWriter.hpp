@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ImageWriter.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Image Writer
+// --Encodes top-down RGBA8 pixels (red in the lowest byte, see PackColor) as
+//   binary PPM (alpha dropped) or PNG.
+// --PNG data is written as stored (uncompressed) deflate blocks, so there is
+//   no zlib dependency; files are larger but every viewer reads them.
+////////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> EncodePpm(const std::uint32_t* rgba, int width, int height);
+std::vector<std::uint8_t> EncodePng(const std::uint32_t* rgba, int width, int height);
+
+// PPM if path ends in ".ppm", PNG otherwise; returns false if it cannot write
+bool WriteImage(const std::string& path, const std::uint32_t* rgba, int width, int height);
+
+std::uint32_t Crc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc = 0);
+std::uint32_t Adler32(const std::uint8_t* data, std::size_t size, std::uint32_t adler = 1);
+
+} // namespace Core
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ImageWriter.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ImageWriter.hpp"
+#include "UnitTest.hpp"
+
+#include <cstring>
+
+using namespace Core;
+
+static std::uint32_t ReadBigEndian(const std::uint8_t* data) {
+
+    return static_cast<std::uint32_t>(data[0]) << 24 | static_cast<std::uint32_t>(data[1]) << 16 |
+           static_cast<std::uint32_t>(data[2]) << 8 | data[3];
+}
+
+TEST_CASE(ChecksumsMatchKnownValues) {
+
+    const std::uint8_t iend[] = {'I', 'E', 'N', 'D'};
+    const char* wikipedia = "Wikipedia";
+
+    CHECK(Crc32(iend, 4) == 0xAE426082);
+    CHECK(Adler32(reinterpret_cast<const std::uint8_t*>(wikipedia), std::strlen(wikipedia)) == 0x11E60398);
+}
+
+TEST_CASE(PpmDropsAlpha) {
+
+    const std::uint32_t pixels[2] = {0xFF0000FF, 0x80FF8000};
+
+    const std::vector<std::uint8_t> ppm = EncodePpm(pixels, 2, 1);
+    const char* header = "P6\n2 1\n255\n";
+    const std::size_t header_size = std::strlen(header);
+
+    CHECK(ppm.size() == header_size + 6);
+    CHECK(std::memcmp(ppm.data(), header, header_size) == 0);
+    CHECK(ppm[header_size + 0] == 0xFF);
+    CHECK(ppm[header_size + 1] == 0x00);
+    CHECK(ppm[header_size + 3] == 0x00);
+    CHECK(ppm[header_size + 4] == 0x80);
+    CHECK(ppm[header_size + 5] == 0xFF);
+}
+
+TEST_CASE(PngStoresScanlinesUncompressed) {
+
+    const int width = 3;
+    const int height = 2;
+    const std::uint32_t pixels[width * height] = {
+        0xFF0000FF, 0xFF00FF00, 0xFFFF0000,
+        0x00000000, 0x80808080, 0xFFFFFFFF,
+    };
+
+    const std::vector<std::uint8_t> png = EncodePng(pixels, width, height);
+
+    const std::uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    CHECK(std::memcmp(png.data(), signature, 8) == 0);
+
+    // IHDR: length, type, width, height, 8-bit RGBA
+    CHECK(ReadBigEndian(png.data() + 8) == 13);
+    CHECK(std::memcmp(png.data() + 12, "IHDR", 4) == 0);
+    CHECK(ReadBigEndian(png.data() + 16) == width);
+    CHECK(ReadBigEndian(png.data() + 20) == height);
+    CHECK(png[24] == 8);
+    CHECK(png[25] == 6);
+    CHECK(ReadBigEndian(png.data() + 29) == Crc32(png.data() + 12, 17));
+
+    // IDAT: zlib header, one final stored block of both filtered scanlines
+    const std::uint8_t* idat = png.data() + 33;
+    const std::uint32_t raw_size = (width * 4 + 1) * height;
+
+    CHECK(std::memcmp(idat + 4, "IDAT", 4) == 0);
+    CHECK(idat[8] == 0x78);
+    CHECK(idat[10] == 1);
+    CHECK((idat[11] | idat[12] << 8) == static_cast<int>(raw_size));
+
+    const std::uint8_t* raw = idat + 15;
+
+    CHECK(raw[0] == 0);
+    CHECK(raw[1] == 0xFF && raw[2] == 0x00 && raw[4] == 0xFF);
+    CHECK(raw[width * 4 + 1] == 0);
+    CHECK(raw[width * 4 + 2 + 4] == 0x80);
+    CHECK(ReadBigEndian(raw + raw_size) == Adler32(raw, raw_size));
+
+    CHECK(std::memcmp(png.data() + png.size() - 8, "IEND", 4) == 0);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: IndexedMesh.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "IndexedMesh.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace Core {
+
+std::int16_t QuantizePosition(float value) {
+
+    float normalized = std::clamp(value / POSITION_EXTENT, -1.0f, 1.0f);
+    return static_cast<std::int16_t>(std::lround(normalized * 32767.0f));
+}
+
+float DequantizePosition(std::int16_t value) {
+
+    // matches GL's signed normalized conversion: max(c / 32767, -1)
+    return std::max(value / 32767.0f, -1.0f) * POSITION_EXTENT;
+}
+
+IndexedMesh BuildIndexedMesh(const float* line_vertices, std::size_t float_count) {
+
+    IndexedMesh mesh;
+    std::unordered_map<std::uint32_t, std::uint16_t> vertex_lookup;
+
+    auto pack = [](const float* vertex) {
+
+        return PackedVertex{QuantizePosition(vertex[0]), QuantizePosition(vertex[1])};
+    };
+
+    auto index_of = [&](PackedVertex packed) {
+
+        std::uint32_t key = (static_cast<std::uint32_t>(static_cast<std::uint16_t>(packed.x)) << 16) |
+                             static_cast<std::uint16_t>(packed.y);
+
+        auto [it, inserted] = vertex_lookup.try_emplace(
+            key, static_cast<std::uint16_t>(mesh.vertices.size()));
+
+        if (inserted) {
+
+            mesh.vertices.push_back(packed);
+        }
+
+        return it->second;
+    };
+
+    const std::size_t segment_count = float_count / 6;
+    bool strip_open = false;
+
+    for (std::size_t segment = 0; segment < segment_count; ++segment) {
+
+        PackedVertex a = pack(line_vertices + segment * 6);
+        PackedVertex b = pack(line_vertices + segment * 6 + 3);
+
+        if (a.x == b.x && a.y == b.y) {
+
+            continue;
+        }
+
+        std::uint16_t start = index_of(a);
+        std::uint16_t end   = index_of(b);
+
+        // continue the current strip when this segment starts where it ended
+        if (!strip_open || mesh.indices.back() != start) {
+
+            if (strip_open) {
+
+                mesh.indices.push_back(PRIMITIVE_RESTART_INDEX);
+            }
+
+            mesh.indices.push_back(start);
+            strip_open = true;
+        }
+
+        mesh.indices.push_back(end);
+    }
+
+    return mesh;
+}
+
+} // namespace Core
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: IndexedMesh.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define POSITION_EXTENT             2048.0f   // model units mapped to int16 range
+#define PRIMITIVE_RESTART_INDEX     0xFFFF
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Packed Vertex Format
+// --2D position as normalized int16 (GL_SHORT, normalized). The vertex shader
+//   multiplies by u_Position_extent to recover model units.
+// --4 bytes per vertex instead of 3 floats (12 bytes).
+////////////////////////////////////////////////////////////////////////////////
+struct PackedVertex {
+
+    std::int16_t x;
+    std::int16_t y;
+};
+
+static_assert(sizeof(PackedVertex) == 4, "PackedVertex must be tightly packed");
+
+////////////////////////////////////////////////////////////////////////////////
+// Indexed Mesh
+// --Deduplicated vertices plus GL_LINE_STRIP indices, strips separated by
+//   PRIMITIVE_RESTART_INDEX.
+////////////////////////////////////////////////////////////////////////////////
+struct IndexedMesh {
+
+    std::vector<PackedVertex> vertices;
+    std::vector<std::uint16_t> indices;
+
+    std::size_t ByteSize() const {
+
+        return vertices.size() * sizeof(PackedVertex) + indices.size() * sizeof(std::uint16_t);
+    }
+};
+
+std::int16_t QuantizePosition(float value);
+float DequantizePosition(std::int16_t value);
+
+// converts a GL_LINES list (3 floats per vertex) into an indexed line strip mesh;
+// zero-length segments are dropped since they rasterize to nothing
+IndexedMesh BuildIndexedMesh(const float* line_vertices, std::size_t float_count);
+
+} // namespace Core
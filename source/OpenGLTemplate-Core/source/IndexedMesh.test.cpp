@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: IndexedMesh.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "IndexedMesh.hpp"
+#include "Models.hpp"
+#include "UnitTest.hpp"
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <vector>
+
+using namespace Core;
+
+using Segment = std::array<std::int16_t, 4>;    // x0, y0, x1, y1
+
+// orientation independent so A->B and B->A compare equal
+static Segment Canonical(std::int16_t x0, std::int16_t y0, std::int16_t x1, std::int16_t y1) {
+
+    if (std::tie(x0, y0) > std::tie(x1, y1)) {
+
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    return Segment{x0, y0, x1, y1};
+}
+
+static std::vector<Segment> SegmentsFromLineList(const float* vertices, std::size_t float_count) {
+
+    std::vector<Segment> segments;
+
+    for (std::size_t i = 0; i + 6 <= float_count; i += 6) {
+
+        auto x0 = QuantizePosition(vertices[i + 0]);
+        auto y0 = QuantizePosition(vertices[i + 1]);
+        auto x1 = QuantizePosition(vertices[i + 3]);
+        auto y1 = QuantizePosition(vertices[i + 4]);
+
+        if (x0 != x1 || y0 != y1) {
+
+            segments.push_back(Canonical(x0, y0, x1, y1));
+        }
+    }
+
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+static std::vector<Segment> SegmentsFromIndexedMesh(const IndexedMesh& mesh) {
+
+    std::vector<Segment> segments;
+
+    for (std::size_t i = 1; i < mesh.indices.size(); ++i) {
+
+        std::uint16_t a = mesh.indices[i - 1];
+        std::uint16_t b = mesh.indices[i];
+
+        if (a == PRIMITIVE_RESTART_INDEX || b == PRIMITIVE_RESTART_INDEX) {
+
+            continue;
+        }
+
+        const PackedVertex& va = mesh.vertices[a];
+        const PackedVertex& vb = mesh.vertices[b];
+        segments.push_back(Canonical(va.x, va.y, vb.x, vb.y));
+    }
+
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+template<std::size_t N>
+static void CheckSameLineSet(const std::array<float, N>& vertices) {
+
+    IndexedMesh mesh = BuildIndexedMesh(vertices.data(), vertices.size());
+
+    CHECK(SegmentsFromIndexedMesh(mesh) == SegmentsFromLineList(vertices.data(), vertices.size()));
+}
+
+TEST_CASE(IndexedModelsMatchLineLists) {
+
+
+    CheckSameLineSet(x_axis_vertices);
+    CheckSameLineSet(y_axis_vertices);
+    CheckSameLineSet(square_vertices);
+    CheckSameLineSet(triangle_vertices);
+    CheckSameLineSet(hexagon_vertices);
+    CheckSameLineSet(circle_vertices);
+}
+
+TEST_CASE(SharedCornersAreDeduplicated) {
+
+    IndexedMesh square = BuildIndexedMesh(square_vertices.data(), square_vertices.size());
+    IndexedMesh hexagon = BuildIndexedMesh(hexagon_vertices.data(), hexagon_vertices.size());
+
+    CHECK(square.vertices.size() == 4);
+    CHECK(square.indices.size() == 5);      // one closed strip
+    CHECK(hexagon.vertices.size() == 6);
+    CHECK(hexagon.indices.size() == 7);
+}
+
+TEST_CASE(DisjointSegmentsUsePrimitiveRestart) {
+
+    std::array<float, 12> lines {
+        0.0f, 0.0f, 0.0f,   10.0f, 0.0f, 0.0f,
+        0.0f, 5.0f, 0.0f,   10.0f, 5.0f, 0.0f,
+    };
+
+    IndexedMesh mesh = BuildIndexedMesh(lines.data(), lines.size());
+
+    CHECK(mesh.vertices.size() == 4);
+    CHECK(mesh.indices.size() == 5);
+    CHECK(mesh.indices[2] == PRIMITIVE_RESTART_INDEX);
+}
+
+TEST_CASE(QuantizationRoundTripsWithinHalfStep) {
+
+    const float half_step = POSITION_EXTENT / 32767.0f / 2.0f;
+
+    for (float value : {0.0f, 50.0f, -50.0f, 43.3f, 1000.0f, -700.0f, POSITION_EXTENT}) {
+
+        CHECK_NEAR(DequantizePosition(QuantizePosition(value)), value, half_step);
+    }
+}
+
+TEST_CASE(VertexMemoryShrinksAtLeastThreeTimes) {
+
+
+    IndexedMesh square = BuildIndexedMesh(square_vertices.data(), square_vertices.size());
+    IndexedMesh circle = BuildIndexedMesh(circle_vertices.data(), circle_vertices.size());
+
+    CHECK(square.ByteSize() * 3 <= square_vertices.size() * sizeof(float));
+    CHECK(circle.ByteSize() * 3 <= circle_vertices.size() * sizeof(float));
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: InputMap.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "InputMap.hpp"
+
+namespace Core {
+
+void InputState::OnKey(int key, bool pressed) {
+
+    if (!IsValid(key)) {
+
+        return;
+    }
+
+    if (!live[key] && !tapped[key]) {
+
+        touched.push_back(key);
+    }
+
+    live[key] = pressed;
+
+    if (pressed) {
+
+        tapped[key] = true;
+    }
+}
+
+void InputState::Snapshot() {
+
+    previous = current;
+    current = live | tapped;
+    tapped.reset();
+
+    // still relevant: keys that were active (may have been released) and
+    // keys that received events; a bitset dedups keys found in both lists
+    std::bitset<INPUT_KEY_COUNT> seen;
+    next_active.clear();
+
+    for (const std::vector<int>* keys : {&active, &touched}) {
+
+        for (int key : *keys) {
+
+            if (!seen[key] && (current[key] || previous[key])) {
+
+                seen[key] = true;
+                next_active.push_back(key);
+            }
+        }
+    }
+
+    active.swap(next_active);
+    touched.clear();
+}
+
+void ActionMap::Bind(int key, ActionId action, ActionTrigger trigger) {
+
+    if (InputState::IsValid(key)) {
+
+        bindings[key] = Binding{action, trigger};
+    }
+}
+
+void ActionMap::Unbind(int key) {
+
+    if (InputState::IsValid(key)) {
+
+        bindings[key] = Binding{};
+    }
+}
+
+bool ActionMap::Rebind(ActionId action, int new_key) {
+
+    if (action == 0 || !InputState::IsValid(new_key)) {
+
+        return false;
+    }
+
+    bool found = false;
+    ActionTrigger trigger = ActionTrigger::Held;
+
+    for (Binding& binding : bindings) {
+
+        if (binding.action == action) {
+
+            trigger = binding.trigger;
+            binding = Binding{};
+            found = true;
+        }
+    }
+
+    if (found) {
+
+        bindings[new_key] = Binding{action, trigger};
+    }
+
+    return found;
+}
+
+ActionId ActionMap::ActionFor(int key) const {
+
+    return InputState::IsValid(key) ? bindings[key].action : 0;
+}
+
+int ActionMap::KeyFor(ActionId action) const {
+
+    for (int key = 0; key < INPUT_KEY_COUNT; ++key) {
+
+        if (action != 0 && bindings[key].action == action) {
+
+            return key;
+        }
+    }
+
+    return -1;
+}
+
+} // namespace Core
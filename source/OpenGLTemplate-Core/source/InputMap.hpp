@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: InputMap.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+#define INPUT_KEY_COUNT     512     // key codes below this are tracked (GLFW_KEY_LAST is 348)
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Input State
+// --Fed by window key callbacks with OnKey(), then frozen once per frame by
+//   Snapshot() so every query in a frame sees the same state.
+// --A press and release between two snapshots still reads as down for one
+//   frame, so short taps are never lost.
+// --Only keys that are down or changed are visited each frame, so the cost
+//   is zero when nothing is pressed.
+////////////////////////////////////////////////////////////////////////////////
+class InputState {
+
+public:
+    void OnKey(int key, bool pressed);
+    void Snapshot();
+
+    bool IsDown(int key) const { return IsValid(key) && current[key]; }
+    bool WasPressed(int key) const { return IsValid(key) && current[key] && !previous[key]; }
+    bool WasReleased(int key) const { return IsValid(key) && !current[key] && previous[key]; }
+
+    // keys that are down or changed state in the last snapshot
+    const std::vector<int>& ActiveKeys() const { return active; }
+
+    static bool IsValid(int key) { return key >= 0 && key < INPUT_KEY_COUNT; }
+
+private:
+    std::bitset<INPUT_KEY_COUNT> live;          // as reported by callbacks
+    std::bitset<INPUT_KEY_COUNT> tapped;        // pressed since the last snapshot
+    std::bitset<INPUT_KEY_COUNT> current;
+    std::bitset<INPUT_KEY_COUNT> previous;
+
+    std::vector<int> touched;                   // keys with events since the last snapshot
+    std::vector<int> active;
+    std::vector<int> next_active;
+};
+
+using ActionId = std::uint16_t;     // an application action enum, 0 is "none"
+
+enum class ActionTrigger {
+
+    Held = 0,       // fires on every dispatch while the key is down
+    Pressed,        // fires once when the key goes down
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Action Map
+// --Rebindable table from key code to action. Each key drives at most one
+//   action; an action may be bound to several keys.
+// --Dispatch() only looks at InputState::ActiveKeys().
+////////////////////////////////////////////////////////////////////////////////
+class ActionMap {
+
+public:
+    void Bind(int key, ActionId action, ActionTrigger trigger = ActionTrigger::Held);
+    void Unbind(int key);
+
+    // moves every binding of action to new_key, keeping its trigger
+    bool Rebind(ActionId action, int new_key);
+
+    ActionId ActionFor(int key) const;
+    int KeyFor(ActionId action) const;      // first bound key, -1 if unbound
+
+    // calls handler(action) for every bound active key of the given trigger
+    template<typename Handler>
+    void Dispatch(const InputState& input, ActionTrigger trigger, Handler&& handler) const {
+
+        for (int key : input.ActiveKeys()) {
+
+            const Binding& binding = bindings[key];
+
+            if (binding.action == 0 || binding.trigger != trigger) {
+
+                continue;
+            }
+
+            const bool fires = trigger == ActionTrigger::Held ? input.IsDown(key)
+                                                              : input.WasPressed(key);
+
+            if (fires) {
+
+                handler(binding.action);
+            }
+        }
+    }
+
+private:
+    struct Binding {
+
+        ActionId action = 0;
+        ActionTrigger trigger = ActionTrigger::Held;
+    };
+
+    std::array<Binding, INPUT_KEY_COUNT> bindings{};
+};
+
+} // namespace Core
@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: InputMap.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "InputMap.hpp"
+#include "UnitTest.hpp"
+
+#include <vector>
+
+using namespace Core;
+
+// key codes as GLFW defines them, without needing a window
+#define KEY_SPACE   32
+#define KEY_A       65
+#define KEY_W       87
+#define KEY_UP      265
+
+enum class TestAction : ActionId {
+
+    None = 0,
+    MoveUp,
+    Jump,
+};
+
+static std::vector<TestAction> Dispatched(const ActionMap& map, const InputState& input,
+                                          ActionTrigger trigger) {
+
+    std::vector<TestAction> actions;
+
+    map.Dispatch(input, trigger, [&](ActionId action) {
+
+        actions.push_back(static_cast<TestAction>(action));
+    });
+
+    return actions;
+}
+
+TEST_CASE(SnapshotTracksPressHoldAndRelease) {
+
+    InputState input;
+
+    input.OnKey(KEY_W, true);
+    input.Snapshot();
+
+    CHECK(input.IsDown(KEY_W));
+    CHECK(input.WasPressed(KEY_W));
+
+    input.Snapshot();
+
+    CHECK(input.IsDown(KEY_W));
+    CHECK(!input.WasPressed(KEY_W));
+
+    input.OnKey(KEY_W, false);
+    input.Snapshot();
+
+    CHECK(!input.IsDown(KEY_W));
+    CHECK(input.WasReleased(KEY_W));
+}
+
+TEST_CASE(TapsShorterThanAFrameAreSeen) {
+
+    InputState input;
+
+    input.OnKey(KEY_SPACE, true);
+    input.OnKey(KEY_SPACE, false);
+    input.Snapshot();
+
+    CHECK(input.WasPressed(KEY_SPACE));
+
+    input.Snapshot();
+
+    CHECK(input.WasReleased(KEY_SPACE));
+}
+
+TEST_CASE(ActiveKeysOnlyCoverDownOrChangedKeys) {
+
+    InputState input;
+
+    input.Snapshot();
+    CHECK(input.ActiveKeys().empty());
+
+    input.OnKey(KEY_W, true);
+    input.OnKey(KEY_A, true);
+    input.OnKey(KEY_A, false);
+    input.OnKey(KEY_A, true);
+    input.Snapshot();
+    CHECK(input.ActiveKeys().size() == 2);
+
+    input.OnKey(KEY_W, false);
+    input.OnKey(KEY_A, false);
+    input.Snapshot();
+    CHECK(input.ActiveKeys().size() == 2);     // both just released
+
+    input.Snapshot();
+    CHECK(input.ActiveKeys().empty());
+}
+
+TEST_CASE(InvalidKeysAreIgnored) {
+
+    InputState input;
+
+    input.OnKey(-1, true);
+    input.OnKey(INPUT_KEY_COUNT, true);
+    input.Snapshot();
+
+    CHECK(input.ActiveKeys().empty());
+    CHECK(!input.IsDown(-1));
+}
+
+TEST_CASE(DispatchSeparatesHeldAndPressedActions) {
+
+    ActionMap map;
+    map.Bind(KEY_UP, static_cast<ActionId>(TestAction::MoveUp), ActionTrigger::Held);
+    map.Bind(KEY_SPACE, static_cast<ActionId>(TestAction::Jump), ActionTrigger::Pressed);
+
+    InputState input;
+    input.OnKey(KEY_UP, true);
+    input.OnKey(KEY_SPACE, true);
+    input.OnKey(KEY_A, true);       // unbound
+    input.Snapshot();
+
+    CHECK(Dispatched(map, input, ActionTrigger::Held) == std::vector<TestAction>{TestAction::MoveUp});
+    CHECK(Dispatched(map, input, ActionTrigger::Pressed) == std::vector<TestAction>{TestAction::Jump});
+
+    // held keys keep firing, pressed keys fire once
+    input.Snapshot();
+
+    CHECK(Dispatched(map, input, ActionTrigger::Held).size() == 1);
+    CHECK(Dispatched(map, input, ActionTrigger::Pressed).empty());
+}
+
+TEST_CASE(RebindMovesActionToNewKey) {
+
+    ActionMap map;
+    map.Bind(KEY_UP, static_cast<ActionId>(TestAction::MoveUp));
+
+    CHECK(map.KeyFor(static_cast<ActionId>(TestAction::MoveUp)) == KEY_UP);
+    CHECK(map.Rebind(static_cast<ActionId>(TestAction::MoveUp), KEY_W));
+    CHECK(map.KeyFor(static_cast<ActionId>(TestAction::MoveUp)) == KEY_W);
+    CHECK(map.ActionFor(KEY_UP) == 0);
+    CHECK(!map.Rebind(static_cast<ActionId>(TestAction::Jump), KEY_A));
+
+    InputState input;
+    input.OnKey(KEY_UP, true);
+    input.Snapshot();
+
+    CHECK(Dispatched(map, input, ActionTrigger::Held).empty());
+
+    input.OnKey(KEY_W, true);
+    input.Snapshot();
+
+    CHECK(Dispatched(map, input, ActionTrigger::Held).size() == 1);
+
+    map.Unbind(KEY_W);
+    CHECK(Dispatched(map, input, ActionTrigger::Held).empty());
+}
+
+int main() { return Core::Test::RunAll(); }
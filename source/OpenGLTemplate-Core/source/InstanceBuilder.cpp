@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: InstanceBuilder.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "InstanceBuilder.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+#include "Profiler.hpp"
+#include "TransformKernels.hpp"
+
+namespace Core {
+
+bool InstanceBuilder::IsVisible(const Affine2D& clip_transform, float bounding_radius) {
+
+    // half extents of the transformed bounding circle, an ellipse
+    const float extent_x = bounding_radius * std::sqrt(clip_transform.a * clip_transform.a +
+                                                       clip_transform.c * clip_transform.c);
+    const float extent_y = bounding_radius * std::sqrt(clip_transform.b * clip_transform.b +
+                                                       clip_transform.d * clip_transform.d);
+
+    return std::fabs(clip_transform.tx) - extent_x <= 1.0f &&
+           std::fabs(clip_transform.ty) - extent_y <= 1.0f;
+}
+
+void InstanceBuilder::Build(JobSystem& jobs, const EntityStore& store, const MeshRegistry& meshes,
+                            const Affine2D& view_proj, BatchRenderer& batch, float alpha,
+                            const std::vector<std::uint32_t>* subset) {
+
+    const std::size_t count = subset ? subset->size() : store.Size();
+    const std::uint32_t* entities = subset ? subset->data() : nullptr;
+    const std::size_t mesh_count = meshes.MeshCount();
+    const std::size_t chunk_count = (count + INSTANCE_BUILD_GRAIN - 1) / INSTANCE_BUILD_GRAIN;
+
+    const bool interpolate = alpha < 1.0f;
+    const bool gather = interpolate || subset;
+
+    interpolated.resize(gather ? count * 5 : 0);
+    transforms.resize(count);
+    visible.resize(count);
+    drawn_meshes.resize(count);
+    chunk_counts.assign(chunk_count * mesh_count, 0);
+    chunk_cursors.resize(chunk_count * mesh_count);
+
+    // scheduled by std::ref at the end; Build() waits for the jobs before
+    // these go out of scope
+    auto transform_and_cull = [&](std::size_t begin, std::size_t end) {
+
+        PROFILE_SCOPE("Transform and Cull");
+
+        if (gather) {
+
+            float* position_x = interpolated.data() + begin;
+            float* position_y = position_x + count;
+            float* rotation = position_y + count;
+            float* scale_x = rotation + count;
+            float* scale_y = scale_x + count;
+
+            if (!entities) {
+
+                store.InterpolateTransforms(alpha, begin, end,
+                                            position_x, position_y, rotation, scale_x, scale_y);
+            }
+            else if (interpolate) {
+
+                for (std::size_t i = begin; i < end; ++i) {
+
+                    const std::size_t offset = i - begin;
+
+                    store.InterpolateTransforms(alpha, entities[i], entities[i] + 1,
+                                                position_x + offset, position_y + offset,
+                                                rotation + offset, scale_x + offset, scale_y + offset);
+                }
+            }
+            else {
+
+                for (std::size_t i = begin; i < end; ++i) {
+
+                    const std::size_t offset = i - begin;
+                    const std::uint32_t entity = entities[i];
+
+                    position_x[offset] = store.PositionX()[entity];
+                    position_y[offset] = store.PositionY()[entity];
+                    rotation[offset] = store.Rotation()[entity];
+                    scale_x[offset] = store.ScaleX()[entity];
+                    scale_y[offset] = store.ScaleY()[entity];
+                }
+            }
+
+            TransformBatch(view_proj, position_x, position_y, rotation, scale_x, scale_y,
+                           end - begin, transforms.data() + begin);
+        }
+        else {
+
+            TransformBatch(view_proj,
+                           store.PositionX() + begin, store.PositionY() + begin,
+                           store.Rotation() + begin,
+                           store.ScaleX() + begin, store.ScaleY() + begin,
+                           end - begin, transforms.data() + begin);
+        }
+
+        const MeshId* mesh_ids = store.Meshes();
+        std::uint32_t* counts = chunk_counts.data() + (begin / INSTANCE_BUILD_GRAIN) * mesh_count;
+
+        for (std::size_t i = begin; i < end; ++i) {
+
+            const MeshId entity_mesh = mesh_ids[entities ? entities[i] : i];
+            const float bounding_radius = meshes.Range(entity_mesh).bounding_radius;
+            const bool is_visible = IsVisible(transforms[i], bounding_radius);
+
+            const MeshId mesh = lod && is_visible
+                ? lod->Select(entity_mesh, transforms[i], bounding_radius) : entity_mesh;
+
+            visible[i] = is_visible;
+            drawn_meshes[i] = mesh;
+            counts[mesh] += is_visible;
+        }
+    };
+
+    auto allocate_instances = [&]() {
+
+        PROFILE_SCOPE("Allocate Instances");
+
+        visible_count = 0;
+
+        for (MeshId mesh = 0; mesh < mesh_count; ++mesh) {
+
+            std::size_t mesh_total = 0;
+
+            for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+
+                mesh_total += chunk_counts[chunk * mesh_count + mesh];
+            }
+
+            InstanceData* cursor = batch.Allocate(mesh, mesh_total);
+
+            for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+
+                chunk_cursors[chunk * mesh_count + mesh] = cursor;
+                cursor += chunk_counts[chunk * mesh_count + mesh];
+            }
+
+            visible_count += mesh_total;
+        }
+    };
+
+    auto write_instances = [&](std::size_t begin, std::size_t end) {
+
+        PROFILE_SCOPE("Write Instances");
+
+        const MeshId* mesh_ids = drawn_meshes.data();
+        const Color* colors = store.Colors();
+        InstanceData** cursors = chunk_cursors.data() + (begin / INSTANCE_BUILD_GRAIN) * mesh_count;
+
+        for (std::size_t i = begin; i < end; ++i) {
+
+            if (!visible[i]) {
+
+                continue;
+            }
+
+            InstanceData* instance = cursors[mesh_ids[i]]++;
+
+            instance->transform = transforms[i];
+            std::memcpy(instance->color_vec, &colors[entities ? entities[i] : i].r,
+                        sizeof(instance->color_vec));
+        }
+    };
+
+    JobHandle counted = jobs.ParallelFor(count, INSTANCE_BUILD_GRAIN, std::ref(transform_and_cull));
+    JobHandle allocated = jobs.Schedule(std::ref(allocate_instances), {counted});
+    JobHandle filled = jobs.ParallelFor(count, INSTANCE_BUILD_GRAIN, std::ref(write_instances), {allocated});
+
+    jobs.Wait(filled);
+
+    // entities left out of the subset count as culled too
+    culled_count = store.Size() - visible_count;
+}
+
+} // namespace Core
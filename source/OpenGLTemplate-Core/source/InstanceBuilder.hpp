@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: InstanceBuilder.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Affine2D.hpp"
+#include "BatchRenderer.hpp"
+#include "EntityStore.hpp"
+#include "JobSystem.hpp"
+#include "MeshLod.hpp"
+#include "MeshRegistry.hpp"
+
+#define INSTANCE_BUILD_GRAIN    4096    // entities per job
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Instance Builder
+// --Fills a BatchRenderer from an EntityStore on every worker thread:
+//     1. per chunk: interpolate transforms between the last two simulation
+//        steps, compose clip-space transforms, cull against the view and
+//        count visible instances per mesh, after swapping curves for their
+//        level of detail when a MeshLod is set
+//     2. one job: prefix-sum the counts and allocate every mesh's instances
+//     3. per chunk: write each visible instance into its reserved slot
+// --Instances keep entity order within a mesh, exactly like serial Submit().
+// --Makes no GL calls; call between BatchRenderer::Begin() and Flush().
+////////////////////////////////////////////////////////////////////////////////
+class InstanceBuilder {
+
+public:
+    // alpha is SimulationClock::Alpha(), 1 renders the current step as is;
+    // subset limits the build to those dense indices (ascending, e.g. from a
+    // SpatialIndex query), so its cost follows the subset and not the store
+    void Build(JobSystem& jobs, const EntityStore& store, const MeshRegistry& meshes,
+               const Affine2D& view_proj, BatchRenderer& batch, float alpha = 1.0f,
+               const std::vector<std::uint32_t>* subset = nullptr);
+
+    // curves are drawn with lod->Select(); nullptr draws every mesh as is
+    void SetLod(const MeshLod* mesh_lod) { lod = mesh_lod; }
+
+    std::size_t VisibleCount() const { return visible_count; }
+    std::size_t CulledCount() const { return culled_count; }
+
+    // true if a mesh with this bounding radius, transformed to clip space,
+    // may overlap the [-1, 1] view square
+    static bool IsVisible(const Affine2D& clip_transform, float bounding_radius);
+
+private:
+    std::vector<float> interpolated;            // five arrays of Size() floats
+    std::vector<Affine2D> transforms;
+    std::vector<std::uint8_t> visible;
+    std::vector<MeshId> drawn_meshes;           // mesh of each entity after LOD
+
+    const MeshLod* lod = nullptr;
+
+    std::vector<std::uint32_t> chunk_counts;    // [chunk * mesh_count + mesh]
+    std::vector<InstanceData*> chunk_cursors;   // same layout
+
+    std::size_t visible_count = 0;
+    std::size_t culled_count = 0;
+};
+
+} // namespace Core
@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: InstanceBuilder.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "InstanceBuilder.hpp"
+#include "Models.hpp"
+#include "TransformKernels.hpp"
+#include "UnitTest.hpp"
+
+#include <array>
+#include <cmath>
+#include <random>
+
+using namespace Core;
+
+static const std::array<float, 24> square {
+    -1.0f, -1.0f, 0.0f,   1.0f, -1.0f, 0.0f,
+     1.0f, -1.0f, 0.0f,   1.0f,  1.0f, 0.0f,
+     1.0f,  1.0f, 0.0f,  -1.0f,  1.0f, 0.0f,
+    -1.0f,  1.0f, 0.0f,  -1.0f, -1.0f, 0.0f,
+};
+
+static const std::array<float, 6> line {
+    -2.0f, 0.0f, 0.0f,   2.0f, 0.0f, 0.0f,
+};
+
+static void FillStore(EntityStore& store, std::size_t count, MeshId mesh_count) {
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position_dist(-1500.0f, 1500.0f);
+    std::uniform_real_distribution<float> angle_dist(0.0f, 6.28f);
+    std::uniform_int_distribution<MeshId> mesh_dist(0, mesh_count - 1);
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        EntityDesc desc;
+        desc.position_x = position_dist(rng);
+        desc.position_y = position_dist(rng);
+        desc.rotation = angle_dist(rng);
+        desc.scale_x = desc.scale_y = 10.0f;
+        desc.color = Color{static_cast<float>(i), 0.0f, 0.0f, 1.0f};
+        desc.mesh = mesh_dist(rng);
+
+        store.Create(desc);
+    }
+}
+
+TEST_CASE(VisibilityUsesTransformedBoundingCircle) {
+
+    const Affine2D ortho = Affine2D::Ortho(-100.0f, 100.0f, -100.0f, 100.0f);
+
+    CHECK(InstanceBuilder::IsVisible(ortho * Affine2D::Translation(0.0f, 0.0f), 1.0f));
+    CHECK(InstanceBuilder::IsVisible(ortho * Affine2D::Translation(105.0f, 0.0f), 10.0f));
+    CHECK(!InstanceBuilder::IsVisible(ortho * Affine2D::Translation(105.0f, 0.0f), 4.0f));
+    CHECK(!InstanceBuilder::IsVisible(ortho * Affine2D::Translation(0.0f, -150.0f), 10.0f));
+
+    // scaling the model grows its bounds
+    CHECK(InstanceBuilder::IsVisible(ortho * Affine2D::Translation(0.0f, -150.0f)
+                                           * Affine2D::Scale(1.0f, 6.0f), 10.0f));
+}
+
+TEST_CASE(ParallelBuildMatchesSerialSubmitOrder) {
+
+    MeshRegistry meshes;
+    meshes.Register(BuildIndexedMesh(square.data(), square.size()));
+    meshes.Register(BuildIndexedMesh(line.data(), line.size()));
+
+    EntityStore store;
+    FillStore(store, 20000, 2);
+
+    const Affine2D view_proj = Affine2D::Ortho(-640.0f, 640.0f, -360.0f, 360.0f)
+                             * Affine2D::Rotation(0.4f);
+
+    // serial reference: every visible entity submitted in store order
+    BatchRenderer serial;
+    serial.Reset(meshes.MeshCount());
+
+    std::size_t serial_visible = 0;
+
+    for (std::uint32_t i = 0; i < store.Size(); ++i) {
+
+        Affine2D transform;
+        TransformBatch(view_proj, store.PositionX() + i, store.PositionY() + i, store.Rotation() + i,
+                       store.ScaleX() + i, store.ScaleY() + i, 1, &transform);
+
+        if (InstanceBuilder::IsVisible(transform, meshes.Range(store.Meshes()[i]).bounding_radius)) {
+
+            serial.Submit(store.Meshes()[i], transform, &store.Colors()[i].r);
+            serial_visible += 1;
+        }
+    }
+
+    JobSystem jobs(3);
+    InstanceBuilder builder;
+    BatchRenderer parallel;
+
+    for (int frame = 0; frame < 3; ++frame) {
+
+        parallel.Reset(meshes.MeshCount());
+        builder.Build(jobs, store, meshes, view_proj, parallel);
+        jobs.WaitAll();
+
+        CHECK(builder.VisibleCount() == serial_visible);
+        CHECK(builder.VisibleCount() + builder.CulledCount() == store.Size());
+        CHECK(builder.CulledCount() > 0);
+
+        for (MeshId mesh = 0; mesh < meshes.MeshCount(); ++mesh) {
+
+            const auto& expected = serial.Instances(mesh);
+            const auto& actual = parallel.Instances(mesh);
+
+            CHECK(expected.size() == actual.size());
+
+            int mismatches = 0;
+
+            for (std::size_t i = 0; i < expected.size() && i < actual.size(); ++i) {
+
+                mismatches += expected[i].color_vec[0] != actual[i].color_vec[0];
+                mismatches += std::fabs(expected[i].transform.tx - actual[i].transform.tx) > 1e-5f;
+            }
+
+            CHECK(mismatches == 0);
+        }
+    }
+}
+
+TEST_CASE(InterpolatedBuildUsesBlendedTransforms) {
+
+    MeshRegistry meshes;
+    meshes.Register(BuildIndexedMesh(square.data(), square.size()));
+
+    EntityStore store;
+    store.Create(EntityDesc{});
+    store.BeginStep();
+    store.SaveTransform(0);
+    store.PositionX()[0] = 0.8f;
+
+    JobSystem jobs(1);
+    InstanceBuilder builder;
+    BatchRenderer batch;
+
+    batch.Reset(meshes.MeshCount());
+    builder.Build(jobs, store, meshes, Affine2D::Identity(), batch, 0.25f);
+    jobs.WaitAll();
+
+    CHECK(batch.Instances(0).size() == 1);
+    CHECK_NEAR(batch.Instances(0)[0].transform.tx, 0.2f, 1e-6f);
+
+    batch.Reset(meshes.MeshCount());
+    builder.Build(jobs, store, meshes, Affine2D::Identity(), batch);
+    jobs.WaitAll();
+
+    CHECK_NEAR(batch.Instances(0)[0].transform.tx, 0.8f, 1e-6f);
+}
+
+TEST_CASE(SubsetBuildMatchesTheFullBuild) {
+
+    MeshRegistry meshes;
+    meshes.Register(BuildIndexedMesh(square.data(), square.size()));
+    meshes.Register(BuildIndexedMesh(line.data(), line.size()));
+
+    EntityStore store;
+    FillStore(store, 6000, 2);
+    store.BeginStep();
+    store.SaveTransform(0);
+    store.PositionX()[0] += 1.0f;
+
+    const Affine2D view_proj = Affine2D::Ortho(-640.0f, 640.0f, -360.0f, 360.0f);
+
+    // every visible entity plus some that are not
+    std::vector<std::uint32_t> subset;
+
+    for (std::uint32_t i = 0; i < store.Size(); ++i) {
+
+        if (std::fabs(store.PositionX()[i]) < 800.0f) {
+
+            subset.push_back(i);
+        }
+    }
+
+    JobSystem jobs(2);
+    InstanceBuilder builder;
+    BatchRenderer full;
+    BatchRenderer partial;
+
+    for (float alpha : {1.0f, 0.5f}) {
+
+        full.Reset(meshes.MeshCount());
+        builder.Build(jobs, store, meshes, view_proj, full, alpha);
+        jobs.WaitAll();
+
+        const std::size_t full_culled = builder.CulledCount();
+
+        partial.Reset(meshes.MeshCount());
+        builder.Build(jobs, store, meshes, view_proj, partial, alpha, &subset);
+        jobs.WaitAll();
+
+        CHECK(builder.CulledCount() == full_culled);
+
+        for (MeshId mesh = 0; mesh < meshes.MeshCount(); ++mesh) {
+
+            const auto& expected = full.Instances(mesh);
+            const auto& actual = partial.Instances(mesh);
+
+            CHECK(expected.size() == actual.size());
+
+            int mismatches = 0;
+
+            for (std::size_t i = 0; i < expected.size() && i < actual.size(); ++i) {
+
+                mismatches += expected[i].color_vec[0] != actual[i].color_vec[0];
+                mismatches += expected[i].transform.tx != actual[i].transform.tx;
+            }
+
+            CHECK(mismatches == 0);
+        }
+    }
+}
+
+TEST_CASE(CurvesAreDrawnWithTheirLevelOfDetail) {
+
+    MeshRegistry meshes;
+    const MeshId circle = meshes.Register(BuildCircleMesh(LodBucketSegments(2)));
+
+    MeshLod lod;
+    lod.AddCurve(circle, BuildCircleMesh);
+    lod.SetViewport(1000, 1000);
+
+    EntityStore store;
+
+    EntityDesc small;
+    small.position_x = -500.0f;
+    small.scale_x = small.scale_y = 0.02f;
+    small.mesh = circle;
+    store.Create(small);
+
+    EntityDesc large = small;
+    large.position_x = 0.0f;
+    large.scale_x = large.scale_y = 10.0f;
+    store.Create(large);
+
+    const Affine2D view_proj = Affine2D::Ortho(-500.0f, 500.0f, -500.0f, 500.0f);
+
+    JobSystem jobs(1);
+    InstanceBuilder builder;
+    builder.SetLod(&lod);
+
+    BatchRenderer batch;
+
+    // first frame: nothing resolved yet, both fall back to the base mesh
+    batch.Reset(meshes.MeshCount());
+    builder.Build(jobs, store, meshes, view_proj, batch);
+    jobs.WaitAll();
+
+    CHECK(batch.Instances(circle).size() == 2);
+    CHECK(lod.Resolve(meshes) == 2);
+
+    batch.Reset(meshes.MeshCount());
+    builder.Build(jobs, store, meshes, view_proj, batch);
+    jobs.WaitAll();
+
+    // radii of 1 and 500 pixels
+    const MeshId coarse = lod.BucketMesh(circle, 0);
+    const MeshId fine = lod.BucketMesh(circle, LodBucket(LodSegmentsForRadius(500.0f)));
+
+    CHECK(coarse != MeshLod::NO_MESH && fine != MeshLod::NO_MESH);
+
+    CHECK(batch.Instances(circle).empty());
+    CHECK(batch.Instances(coarse).size() == 1);
+    CHECK(batch.Instances(fine).size() == 1);
+    CHECK(meshes.Range(coarse).index_count < meshes.Range(fine).index_count);
+}
+
+TEST_CASE(EmptyStoreBuildsNothing) {
+
+    MeshRegistry meshes;
+    meshes.Register(BuildIndexedMesh(square.data(), square.size()));
+
+    EntityStore store;
+    JobSystem jobs(0);
+    InstanceBuilder builder;
+    BatchRenderer batch;
+
+    batch.Reset(meshes.MeshCount());
+    builder.Build(jobs, store, meshes, Affine2D::Identity(), batch);
+    jobs.WaitAll();
+
+    CHECK(builder.VisibleCount() == 0);
+    CHECK(batch.Instances(0).empty());
+}
+
+int main() { return Core::Test::RunAll(); }
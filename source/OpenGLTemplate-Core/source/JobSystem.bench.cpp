@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: JobSystem.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "InstanceBuilder.hpp"
+#include "JobSystem.hpp"
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+
+#define ENTITY_COUNT    1000000
+
+static const std::array<float, 24> square {
+    -50.0f, -50.0f, 0.0f,   50.0f, -50.0f, 0.0f,
+     50.0f, -50.0f, 0.0f,   50.0f,  50.0f, 0.0f,
+     50.0f,  50.0f, 0.0f,  -50.0f,  50.0f, 0.0f,
+    -50.0f,  50.0f, 0.0f,  -50.0f, -50.0f, 0.0f,
+};
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : ENTITY_COUNT;
+    const unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position_dist(-2000.0f, 2000.0f);
+    std::uniform_real_distribution<float> angle_dist(0.0f, 6.28f);
+
+    MeshRegistry meshes;
+    meshes.Register(BuildIndexedMesh(square.data(), square.size()));
+
+    EntityStore store;
+    store.Reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        EntityDesc desc;
+        desc.position_x = position_dist(rng);
+        desc.position_y = position_dist(rng);
+        desc.rotation = angle_dist(rng);
+        store.Create(desc);
+    }
+
+    const Affine2D view_proj = Affine2D::Ortho(-960.0f, 960.0f, -540.0f, 540.0f);
+
+    std::vector<float> results(count);
+    double single_thread_update = 0.0;
+    double single_thread_build = 0.0;
+
+    // 1, 2, 4, ... threads, always ending with every hardware thread
+    std::vector<unsigned int> thread_counts;
+
+    for (unsigned int threads = 1; threads < max_threads; threads *= 2) {
+
+        thread_counts.push_back(threads);
+    }
+
+    thread_counts.push_back(max_threads);
+
+    for (unsigned int threads : thread_counts) {
+
+        JobSystem jobs(threads - 1);
+
+        // simulation-like update, one sin/cos pair per entity
+        const std::string update_name = "update " + std::to_string(threads) + " threads";
+
+        const double update = Bench::Run(update_name.c_str(), count, [&]() {
+
+            jobs.ParallelFor(count, INSTANCE_BUILD_GRAIN, [&](std::size_t begin, std::size_t end) {
+
+                for (std::size_t i = begin; i < end; ++i) {
+
+                    results[i] = std::sin(store.Rotation()[i]) * std::cos(store.PositionX()[i]);
+                }
+            });
+
+            jobs.WaitAll();
+            Bench::DoNotOptimize(results.data());
+        });
+
+        // transform, cull and fill instance lists
+        InstanceBuilder builder;
+        BatchRenderer batch;
+
+        const std::string build_name = "instance build " + std::to_string(threads) + " threads";
+
+        const double build = Bench::Run(build_name.c_str(), count, [&]() {
+
+            batch.Reset(meshes.MeshCount());
+            builder.Build(jobs, store, meshes, view_proj, batch);
+            jobs.WaitAll();
+        });
+
+        if (threads == 1) {
+
+            single_thread_update = update;
+            single_thread_build = build;
+        }
+
+        std::cout << "    speedup: update " << single_thread_update / update
+                  << "x, instance build " << single_thread_build / build << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,383 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: JobSystem.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "JobSystem.hpp"
+
+#include <algorithm>
+
+#include "Profiler.hpp"
+
+#define WORKER_SPIN_COUNT   64      // failed steal attempts before a worker sleeps
+#define QUEUE_INITIAL_SIZE  64      // jobs a queue holds before its ring doubles
+#define JOB_CONTINUATIONS   4       // dependents a pooled job holds before growing
+
+namespace Core {
+
+// queue owned by the current thread if it is a worker of current_system
+static thread_local const JobSystem* current_system = nullptr;
+static thread_local std::size_t current_queue_index = 0;
+
+JobSystem::JobSystem(unsigned int worker_count) {
+
+    queues.reserve(worker_count + 1);
+
+    for (unsigned int i = 0; i <= worker_count; ++i) {
+
+        queues.push_back(std::make_unique<WorkQueue>());
+        queues.back()->ring.resize(QUEUE_INITIAL_SIZE);
+    }
+
+    workers.reserve(worker_count);
+
+    for (unsigned int i = 0; i < worker_count; ++i) {
+
+        workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+    }
+}
+
+JobSystem::~JobSystem() {
+
+    WaitAll();
+
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        stopping = true;
+    }
+
+    wake.notify_all();
+
+    for (auto& worker : workers) {
+
+        worker.join();
+    }
+}
+
+unsigned int JobSystem::DefaultWorkerCount() {
+
+    const unsigned int hardware_threads = std::thread::hardware_concurrency();
+
+    return hardware_threads > 1 ? hardware_threads - 1 : 0;
+}
+
+JobHandle JobSystem::Schedule(std::function<void()> function,
+                              std::initializer_list<JobHandle> dependencies) {
+
+    Job* job = Allocate();
+    job->function = std::move(function);
+
+    Submit(job, dependencies);
+    return JobHandle{job};
+}
+
+JobHandle JobSystem::ParallelFor(std::size_t count, std::size_t grain_size, RangeFunction function,
+                                 std::initializer_list<JobHandle> dependencies) {
+
+    Job* job = Allocate();
+    job->range = std::move(function);
+    job->count = count;
+    job->grain_size = std::max<std::size_t>(grain_size, 1);
+
+    Submit(job, dependencies);
+    return JobHandle{job};
+}
+
+bool JobSystem::IsDone(JobHandle handle) const {
+
+    return !handle.job || handle.job->finished.load(std::memory_order_acquire);
+}
+
+void JobSystem::Wait(JobHandle handle) {
+
+    while (!IsDone(handle)) {
+
+        if (!RunOne(QueueIndex())) {
+
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::WaitAll() {
+
+    while (active_jobs.load(std::memory_order_acquire) > 0) {
+
+        if (!RunOne(QueueIndex())) {
+
+            std::this_thread::yield();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    pool_used = 0;
+}
+
+Job* JobSystem::Allocate() {
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    if (pool_used == pool.size()) {
+
+        // sized now, so reusing the slot in later frames does not allocate
+        pool.emplace_back().continuations.reserve(JOB_CONTINUATIONS);
+    }
+
+    Job* job = &pool[pool_used++];
+
+    job->function = nullptr;
+    job->range = nullptr;
+    job->count = 0;
+    job->grain_size = 1;
+    job->parent = nullptr;
+    job->begin = 0;
+    job->end = 0;
+    job->unfinished.store(1, std::memory_order_relaxed);
+    job->continuations.clear();
+    job->done = false;
+    job->finished.store(false, std::memory_order_relaxed);
+
+    active_jobs.fetch_add(1);
+    return job;
+}
+
+void JobSystem::Submit(Job* job, std::initializer_list<JobHandle> dependencies) {
+
+    // one extra count so the job cannot start before every dependency is seen
+    job->pending_dependencies.store(static_cast<int>(dependencies.size()) + 1);
+
+    for (const JobHandle& dependency : dependencies) {
+
+        bool already_done = true;
+
+        if (dependency.job) {
+
+            std::lock_guard<std::mutex> lock(dependency.job->continuation_mutex);
+
+            if (!dependency.job->done) {
+
+                dependency.job->continuations.push_back(job);
+                already_done = false;
+            }
+        }
+
+        if (already_done) {
+
+            job->pending_dependencies.fetch_sub(1);
+        }
+    }
+
+    if (job->pending_dependencies.fetch_sub(1) == 1) {
+
+        Push(job);
+    }
+}
+
+void JobSystem::WorkQueue::PushBack(Job* job) {
+
+    if (count == ring.size()) {
+
+        // unwrap into a ring twice the size
+        std::vector<Job*> grown(ring.size() * 2);
+
+        for (std::size_t i = 0; i < count; ++i) {
+
+            grown[i] = ring[(head + i) & (ring.size() - 1)];
+        }
+
+        ring.swap(grown);
+        head = 0;
+    }
+
+    ring[(head + count) & (ring.size() - 1)] = job;
+    count += 1;
+}
+
+Job* JobSystem::WorkQueue::PopBack() {
+
+    count -= 1;
+    return ring[(head + count) & (ring.size() - 1)];
+}
+
+Job* JobSystem::WorkQueue::PopFront() {
+
+    Job* job = ring[head];
+
+    head = (head + 1) & (ring.size() - 1);
+    count -= 1;
+
+    return job;
+}
+
+void JobSystem::Push(Job* job) {
+
+    WorkQueue& queue = *queues[QueueIndex()];
+
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.PushBack(job);
+    }
+
+    queued_jobs.fetch_add(1);
+
+    if (sleeping_workers.load() > 0) {
+
+        // taking the lock orders this wake after a sleeper's predicate check
+        { std::lock_guard<std::mutex> lock(wake_mutex); }
+        wake.notify_one();
+    }
+}
+
+std::size_t JobSystem::QueueIndex() const {
+
+    return current_system == this ? current_queue_index : 0;
+}
+
+Job* JobSystem::PopOrSteal(std::size_t queue_index) {
+
+    {
+        WorkQueue& own = *queues[queue_index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+
+        if (!own.Empty()) {
+
+            Job* job = own.PopBack();
+            queued_jobs.fetch_sub(1);
+            return job;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+
+        WorkQueue& victim = *queues[(queue_index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.Empty()) {
+
+            Job* job = victim.PopFront();
+            queued_jobs.fetch_sub(1);
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+bool JobSystem::RunOne(std::size_t queue_index) {
+
+    Job* job = PopOrSteal(queue_index);
+
+    if (!job) {
+
+        return false;
+    }
+
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Execute(Job* job) {
+
+    if (job->parent) {
+
+        job->parent->range(job->begin, job->end);
+    }
+    else if (job->range) {
+
+        // split into chunks; the parallel-for completes with its last chunk
+        for (std::size_t begin = 0; begin < job->count; begin += job->grain_size) {
+
+            Job* chunk = Allocate();
+            chunk->parent = job;
+            chunk->begin = begin;
+            chunk->end = std::min(begin + job->grain_size, job->count);
+
+            job->unfinished.fetch_add(1);
+            chunk->pending_dependencies.store(0);
+            Push(chunk);
+        }
+    }
+    else if (job->function) {
+
+        job->function();
+    }
+
+    Finish(job);
+}
+
+void JobSystem::Finish(Job* job) {
+
+    if (job->unfinished.fetch_sub(1) != 1) {
+
+        return;
+    }
+
+    // published before continuations run, so they see this job as done
+    job->finished.store(true, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(job->continuation_mutex);
+        job->done = true;
+
+        for (Job* continuation : job->continuations) {
+
+            if (continuation->pending_dependencies.fetch_sub(1) == 1) {
+
+                Push(continuation);
+            }
+        }
+
+        job->continuations.clear();
+    }
+
+    if (job->parent) {
+
+        Finish(job->parent);
+    }
+
+    active_jobs.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::WorkerLoop(std::size_t queue_index) {
+
+    current_system = this;
+    current_queue_index = queue_index;
+
+    // up front, not in the middle of the first frame this worker helps with
+    DefaultProfiler().RegisterThread();
+
+    int failed_attempts = 0;
+
+    while (true) {
+
+        if (RunOne(queue_index)) {
+
+            failed_attempts = 0;
+            continue;
+        }
+
+        if (++failed_attempts < WORKER_SPIN_COUNT) {
+
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wake_mutex);
+
+        sleeping_workers.fetch_add(1);
+        wake.wait(lock, [this]() { return queued_jobs.load() > 0 || stopping.load(); });
+        sleeping_workers.fetch_sub(1);
+
+        if (stopping && queued_jobs.load() == 0) {
+
+            return;
+        }
+
+        failed_attempts = 0;
+    }
+}
+
+} // namespace Core
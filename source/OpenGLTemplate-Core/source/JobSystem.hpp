@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: JobSystem.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Core {
+
+class JobSystem;
+
+////////////////////////////////////////////////////////////////////////////////
+// Job
+// --Either a plain function, a parallel-for (which splits into chunk jobs
+//   when it runs) or one chunk of a parallel-for.
+// --A job completes once it and every chunk it spawned have run. Completion
+//   releases the jobs that depend on it.
+////////////////////////////////////////////////////////////////////////////////
+struct Job {
+
+    using RangeFunction = std::function<void(std::size_t begin, std::size_t end)>;
+
+    std::function<void()> function;
+
+    RangeFunction range;            // parallel-for body, run by its chunks
+    std::size_t count = 0;
+    std::size_t grain_size = 1;
+
+    Job* parent = nullptr;          // parallel-for a chunk belongs to
+    std::size_t begin = 0;
+    std::size_t end = 0;
+
+    std::atomic<int> unfinished{0};             // itself plus spawned chunks
+    std::atomic<int> pending_dependencies{0};
+
+    std::mutex continuation_mutex;
+    std::vector<Job*> continuations;            // jobs waiting on this one
+    bool done = false;                          // guarded by continuation_mutex
+
+    std::atomic<bool> finished{false};
+};
+
+// valid until the next JobSystem::WaitAll()
+struct JobHandle {
+
+    Job* job = nullptr;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Job System
+// --Work-stealing scheduler: every worker owns a queue, pops its own newest
+//   job first and steals the oldest job from other queues when it runs dry.
+//   Threads that are not workers (the main thread) share queue 0.
+// --Wait() and WaitAll() run jobs on the calling thread until the awaited
+//   work is done, so a system with zero workers still completes everything.
+// --WaitAll() is the per-frame join: every job is finished afterwards and
+//   job storage is recycled for the next frame.
+// --Jobs must not call WaitAll(). Only the owning thread calls WaitAll().
+// --std::function copies a callable bigger than two pointers to the heap;
+//   per-frame jobs pass std::ref(callable) when the callable outlives them.
+////////////////////////////////////////////////////////////////////////////////
+class JobSystem {
+
+public:
+    using RangeFunction = Job::RangeFunction;
+
+    explicit JobSystem(unsigned int worker_count = DefaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // hardware threads minus the calling thread, which helps while waiting
+    static unsigned int DefaultWorkerCount();
+
+    unsigned int WorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    JobHandle Schedule(std::function<void()> function,
+                       std::initializer_list<JobHandle> dependencies = {});
+
+    // runs function(begin, end) over [0, count) in chunks of grain_size
+    JobHandle ParallelFor(std::size_t count, std::size_t grain_size, RangeFunction function,
+                          std::initializer_list<JobHandle> dependencies = {});
+
+    bool IsDone(JobHandle handle) const;
+
+    void Wait(JobHandle handle);
+    void WaitAll();
+
+private:
+    // a ring rather than a std::deque: once grown it keeps its storage, so
+    // pushing and popping jobs never allocates in steady state
+    struct WorkQueue {
+
+        std::mutex mutex;
+        std::vector<Job*> ring;     // size is a power of two
+        std::size_t head = 0;       // oldest job
+        std::size_t count = 0;
+
+        bool Empty() const { return count == 0; }
+        void PushBack(Job* job);
+        Job* PopBack();
+        Job* PopFront();
+    };
+
+    Job* Allocate();
+    void Submit(Job* job, std::initializer_list<JobHandle> dependencies);
+    void Push(Job* job);
+
+    std::size_t QueueIndex() const;
+    Job* PopOrSteal(std::size_t queue_index);
+    bool RunOne(std::size_t queue_index);
+
+    void Execute(Job* job);
+    void Finish(Job* job);
+
+    void WorkerLoop(std::size_t queue_index);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;     // 0 is for non-workers
+    std::vector<std::thread> workers;
+
+    std::mutex pool_mutex;
+    std::deque<Job> pool;           // deque keeps jobs at stable addresses
+    std::size_t pool_used = 0;
+
+    std::atomic<int> active_jobs{0};
+    std::atomic<int> queued_jobs{0};
+    std::atomic<int> sleeping_workers{0};
+    std::atomic<bool> stopping{false};
+
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+};
+
+} // namespace Core
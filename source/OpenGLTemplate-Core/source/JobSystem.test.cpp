@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: JobSystem.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "JobSystem.hpp"
+#include "UnitTest.hpp"
+
+#include <atomic>
+#include <vector>
+
+using namespace Core;
+
+TEST_CASE(ParallelForVisitsEveryIndexOnce) {
+
+    JobSystem jobs(3);
+
+    std::vector<std::atomic<int>> visits(10007);
+
+    JobHandle handle = jobs.ParallelFor(visits.size(), 64, [&](std::size_t begin, std::size_t end) {
+
+        for (std::size_t i = begin; i < end; ++i) {
+
+            visits[i].fetch_add(1);
+        }
+    });
+
+    jobs.Wait(handle);
+
+    int wrong = 0;
+
+    for (const auto& count : visits) {
+
+        wrong += count.load() != 1;
+    }
+
+    CHECK(jobs.IsDone(handle));
+    CHECK(wrong == 0);
+
+    jobs.WaitAll();
+}
+
+TEST_CASE(ZeroWorkersRunOnTheWaitingThread) {
+
+    JobSystem jobs(0);
+
+    int sum = 0;
+
+    JobHandle handle = jobs.ParallelFor(100, 7, [&](std::size_t begin, std::size_t end) {
+
+        for (std::size_t i = begin; i < end; ++i) {
+
+            sum += static_cast<int>(i);
+        }
+    });
+
+    CHECK(!jobs.IsDone(handle));
+
+    jobs.WaitAll();
+
+    CHECK(jobs.IsDone(handle));
+    CHECK(sum == 4950);
+}
+
+TEST_CASE(DependenciesRunInOrder) {
+
+    JobSystem jobs(4);
+
+    for (int frame = 0; frame < 200; ++frame) {
+
+        std::atomic<int> step{0};
+        std::atomic<int> order_errors{0};
+
+        JobHandle first = jobs.Schedule([&]() {
+
+            step = 1;
+        });
+
+        // every chunk must see the first job's result
+        JobHandle middle = jobs.ParallelFor(64, 4, [&](std::size_t, std::size_t) {
+
+            if (step.load() != 1) {
+
+                order_errors.fetch_add(1);
+            }
+        }, {first});
+
+        JobHandle last = jobs.Schedule([&]() {
+
+            if (step.load() != 1 || !jobs.IsDone(middle)) {
+
+                order_errors.fetch_add(1);
+            }
+
+            step = 2;
+        }, {first, middle});
+
+        jobs.Wait(last);
+
+        CHECK(step.load() == 2);
+        CHECK(order_errors.load() == 0);
+
+        jobs.WaitAll();
+    }
+}
+
+TEST_CASE(DependingOnFinishedJobsStartsImmediately) {
+
+    JobSystem jobs(2);
+
+    JobHandle first = jobs.Schedule([]() {});
+    jobs.Wait(first);
+
+    bool ran = false;
+
+    JobHandle second = jobs.Schedule([&]() { ran = true; }, {first, JobHandle{}});
+    jobs.Wait(second);
+
+    CHECK(ran);
+
+    jobs.WaitAll();
+}
+
+TEST_CASE(JobsCanScheduleAndWaitOnMoreJobs) {
+
+    JobSystem jobs(2);
+
+    std::atomic<int> leaves{0};
+
+    for (int i = 0; i < 8; ++i) {
+
+        jobs.Schedule([&]() {
+
+            JobHandle child = jobs.ParallelFor(16, 1, [&](std::size_t begin, std::size_t end) {
+
+                leaves.fetch_add(static_cast<int>(end - begin));
+            });
+
+            jobs.Wait(child);
+        });
+    }
+
+    jobs.WaitAll();
+
+    CHECK(leaves.load() == 8 * 16);
+}
+
+TEST_CASE(WaitAllJoinsEveryFrame) {
+
+    JobSystem jobs(3);
+
+    std::atomic<int> total{0};
+
+    for (int frame = 0; frame < 100; ++frame) {
+
+        for (int i = 0; i < 50; ++i) {
+
+            jobs.Schedule([&]() { total.fetch_add(1); });
+        }
+
+        jobs.WaitAll();
+
+        CHECK(total.load() == (frame + 1) * 50);
+    }
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Logger.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "Logger.hpp"
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+
+#define BURST_SIZE      1024    // messages per burst, below the ring capacity
+#define BURST_COUNT     200
+
+// times every call of a burst individually; the clock read is included
+static void MeasureLatency(const char* name, const std::function<void(int)>& log_call,
+                           const std::function<void()>& between_bursts) {
+
+    std::vector<double> samples;
+    samples.reserve(BURST_SIZE * BURST_COUNT);
+
+    for (int burst = 0; burst < BURST_COUNT; ++burst) {
+
+        for (int i = 0; i < BURST_SIZE; ++i) {
+
+            const auto start = Bench::Clock::now();
+            log_call(i);
+            samples.push_back(std::chrono::duration<double, std::nano>(Bench::Clock::now() - start).count());
+        }
+
+        between_bursts();
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    const auto percentile = [&](double p) { return samples[static_cast<std::size_t>(p * (samples.size() - 1))]; };
+
+    std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(0)
+              << "p50 " << std::setw(7) << percentile(0.50) << " ns"
+              << "   p99 " << std::setw(7) << percentile(0.99) << " ns"
+              << "   max " << std::setw(9) << samples.back() << " ns" << std::endl;
+}
+
+int main() {
+
+    const int producer_count = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+
+    // every variant writes the same text to the null device
+    std::FILE* null_file = std::fopen("/dev/null", "w");
+    std::ofstream null_stream("/dev/null");
+
+    Logger logger(LOG_RING_CAPACITY, [null_file](LogLevel level, double seconds, const char* message) {
+
+        std::fprintf(null_file, "%9.3f %-5s %s\n", seconds, LogLevelName(level), message);
+    });
+
+    const auto no_op = []() {};
+
+    MeasureLatency("std::ostream << std::endl", [&](int i) {
+
+        null_stream << "Frame Stats:\t" << i << " entities\t" << 0.25f << " ms cpu" << std::endl;
+    }, no_op);
+
+    MeasureLatency("fprintf + fflush", [&](int i) {
+
+        std::fprintf(null_file, "Frame Stats:\t%d entities\t%.2f ms cpu\n", i, 0.25f);
+        std::fflush(null_file);
+    }, no_op);
+
+    MeasureLatency("async logger", [&](int i) {
+
+        logger.Write(LogLevel::Info, nullptr, "Frame Stats:\t%d entities\t%.2f ms cpu", i, 0.25f);
+    }, [&]() { logger.Flush(); });
+
+    LogRateLimiter limiter;
+
+    MeasureLatency("async logger, rate limited repeat", [&](int i) {
+
+        logger.Write(LogLevel::Info, &limiter, "Frame Stats:\t%d entities\t%.2f ms cpu", i, 0.25f);
+    }, [&]() { logger.Flush(); });
+
+    // throughput with several producers contending for the ring
+    const std::size_t per_producer = BURST_SIZE / producer_count;
+
+    Bench::Run("async logger, contended producers", per_producer * producer_count, [&]() {
+
+        std::vector<std::thread> producers;
+
+        for (int t = 0; t < producer_count; ++t) {
+
+            producers.emplace_back([&logger, per_producer, t]() {
+
+                for (std::size_t i = 0; i < per_producer; ++i) {
+
+                    logger.Write(LogLevel::Info, nullptr, "producer %d message %zu", t, i);
+                }
+            });
+        }
+
+        for (auto& producer : producers) {
+
+            producer.join();
+        }
+    });
+
+    logger.Flush();
+
+    std::cout << "written " << logger.Written() << ", dropped " << logger.Dropped()
+              << ", suppressed " << logger.Suppressed() << std::endl;
+
+    std::fclose(null_file);
+    return 0;
+}
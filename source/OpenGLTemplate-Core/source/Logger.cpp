@@ -0,0 +1,264 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Logger.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "Logger.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+namespace Core {
+
+const char* LogLevelName(LogLevel level) {
+
+    switch (level) {
+
+        case(LogLevel::Trace): return "TRACE";
+        case(LogLevel::Debug): return "DEBUG";
+        case(LogLevel::Info): return "INFO";
+        case(LogLevel::Warn): return "WARN";
+        case(LogLevel::Error): return "ERROR";
+    }
+
+    return "?";
+}
+
+bool LogRateLimiter::Allow(std::int64_t now_ns, std::uint32_t& out_suppressed) {
+
+    out_suppressed = 0;
+
+    std::int64_t start = window_start.load(std::memory_order_relaxed);
+
+    // first caller past the window end opens a new one
+    if (now_ns - start >= window_ns && window_start.compare_exchange_strong(start, now_ns, std::memory_order_relaxed)) {
+
+        window_count.store(0, std::memory_order_relaxed);
+    }
+
+    if (window_count.fetch_add(1, std::memory_order_relaxed) < burst) {
+
+        out_suppressed = suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+Logger::Sink Logger::ConsoleSink() {
+
+    return [](LogLevel level, double seconds, const char* message) {
+
+        std::FILE* stream = level >= LogLevel::Warn ? stderr : stdout;
+        std::fprintf(stream, "%9.3f %-5s %s\n", seconds, LogLevelName(level), message);
+    };
+}
+
+Logger::Logger(std::size_t capacity, Sink sink)
+    : sink(std::move(sink)), start_ns(NowNanoseconds()) {
+
+    std::size_t size = 2;
+
+    while (size < capacity) {
+
+        size *= 2;
+    }
+
+    slots = std::make_unique<Slot[]>(size);
+    mask = size - 1;
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    writer = std::thread(&Logger::WriterLoop, this);
+}
+
+Logger::~Logger() {
+
+    Flush();
+
+    running.store(false);
+
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        wake.notify_one();
+    }
+
+    writer.join();
+}
+
+std::int64_t Logger::NowNanoseconds() const {
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool Logger::Write(LogLevel level, LogRateLimiter* limiter, const char* format, ...) {
+
+    va_list args;
+    va_start(args, format);
+    const bool result = WriteV(level, limiter, format, args);
+    va_end(args);
+
+    return result;
+}
+
+bool Logger::WriteV(LogLevel level, LogRateLimiter* limiter, const char* format, va_list args) {
+
+    const std::int64_t now = NowNanoseconds();
+
+    if (limiter) {
+
+        std::uint32_t limited = 0;
+
+        if (!limiter->Allow(now, limited)) {
+
+            suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (limited > 0) {
+
+            Write(level, nullptr, "(%u similar messages suppressed)", limited);
+        }
+    }
+
+    return Enqueue(level, now, format, args);
+}
+
+bool Logger::Enqueue(LogLevel level, std::int64_t timestamp_ns, const char* format, va_list args) {
+
+    std::size_t position = enqueue_position.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+
+    while (true) {
+
+        slot = &slots[position & mask];
+
+        const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0) {
+
+            // slot is free for this position, try to claim it
+            if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+
+                break;
+            }
+        }
+        else if (difference < 0) {
+
+            // the writer has not consumed this slot from the previous lap
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else {
+
+            position = enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+
+    // format in place, then publish the slot to the writer
+    slot->level = level;
+    slot->timestamp_ns = timestamp_ns;
+    std::vsnprintf(slot->message, LOG_MESSAGE_SIZE, format, args);
+
+    // seq_cst pairs with the writer's flag store: either it sees this slot
+    // before sleeping, or this sees it asleep
+    slot->sequence.store(position + 1);
+
+    if (writer_sleeping.load()) {
+
+        // taking the lock orders this wake after the writer's predicate check
+        { std::lock_guard<std::mutex> lock(wake_mutex); }
+        wake.notify_one();
+    }
+
+    return true;
+}
+
+bool Logger::HasPending() const {
+
+    const std::size_t position = dequeue_position.load(std::memory_order_relaxed);
+    return slots[position & mask].sequence.load() == position + 1;
+}
+
+std::size_t Logger::Drain() {
+
+    std::size_t count = 0;
+    std::size_t position = dequeue_position.load(std::memory_order_relaxed);
+
+    while (true) {
+
+        Slot& slot = slots[position & mask];
+
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+
+            break;
+        }
+
+        sink(slot.level, (slot.timestamp_ns - start_ns) * 1e-9, slot.message);
+
+        // hand the slot back to producers for the next lap
+        slot.sequence.store(position + mask + 1, std::memory_order_release);
+
+        ++position;
+        ++count;
+        written.fetch_add(1, std::memory_order_relaxed);
+        dequeue_position.store(position, std::memory_order_release);
+    }
+
+    if (count > 0) {
+
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+
+    return count;
+}
+
+void Logger::WriterLoop() {
+
+    while (running.load()) {
+
+        if (Drain() == 0) {
+
+            std::unique_lock<std::mutex> lock(wake_mutex);
+
+            writer_sleeping.store(true);
+            wake.wait(lock, [this]() { return HasPending() || !running.load(); });
+            writer_sleeping.store(false);
+        }
+    }
+
+    Drain();
+}
+
+void Logger::Flush() {
+
+    const std::size_t target = enqueue_position.load(std::memory_order_acquire);
+
+    while (dequeue_position.load(std::memory_order_acquire) < target) {
+
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex);
+            wake.notify_one();
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+Logger& DefaultLogger() {
+
+    static Logger logger;
+    return logger;
+}
+
+} // namespace Core
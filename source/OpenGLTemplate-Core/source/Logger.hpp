@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Logger.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#define LOG_RING_CAPACITY           4096    // queued messages, rounded up to a power of two
+#define LOG_MESSAGE_SIZE            240     // bytes per message including the terminator
+#define LOG_RATE_LIMIT_BURST        20      // messages per call site per window
+#define LOG_RATE_LIMIT_WINDOW_MS    1000    // rate limit window length
+
+// levels below LOG_MIN_LEVEL are compiled out: 0 trace, 1 debug, 2 info, 3 warn, 4 error
+#ifndef LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define LOG_MIN_LEVEL               2
+#else
+#define LOG_MIN_LEVEL               1
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CORE_PRINTF_FORMAT(format_index, args_index) __attribute__((format(printf, format_index, args_index)))
+#else
+#define CORE_PRINTF_FORMAT(format_index, args_index)
+#endif
+
+namespace Core {
+
+enum class LogLevel : std::uint8_t {
+
+    Trace,
+    Debug,
+    Info,
+    Warn,
+    Error
+};
+
+const char* LogLevelName(LogLevel level);
+
+constexpr bool IsLogLevelEnabled(LogLevel level) {
+
+    return static_cast<int>(level) >= LOG_MIN_LEVEL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Log Rate Limiter
+// --One per call site (the LOG_* macros declare a static instance). At most
+//   burst messages pass per window; the rest are counted and the count is
+//   reported with the next message that gets through.
+////////////////////////////////////////////////////////////////////////////////
+class LogRateLimiter {
+
+public:
+    LogRateLimiter(std::uint32_t burst = LOG_RATE_LIMIT_BURST,
+                   std::int64_t window_ns = LOG_RATE_LIMIT_WINDOW_MS * 1000000ll)
+        : burst(burst), window_ns(window_ns) {}
+
+    // true if the message may be logged; out_suppressed receives the number
+    // of messages dropped since the last one that passed
+    bool Allow(std::int64_t now_ns, std::uint32_t& out_suppressed);
+
+private:
+    const std::uint32_t burst;
+    const std::int64_t window_ns;
+
+    std::atomic<std::int64_t> window_start { INT64_MIN / 2 };
+    std::atomic<std::uint32_t> window_count { 0 };
+    std::atomic<std::uint32_t> suppressed { 0 };
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Logger
+// --Producers format straight into a slot of a bounded lock-free MPSC ring
+//   (per-slot sequence numbers) and return; they never take a lock, touch
+//   a stream or wait on I/O. A full ring drops the message and counts it.
+// --A background writer thread drains the ring in order and hands each
+//   message to the sink. The default sink writes info and below to stdout,
+//   warnings and errors to stderr, and flushes once per drained batch.
+// --An idle writer sleeps until a producer publishes; producers only take
+//   the wake mutex when the writer is asleep.
+// --Flush() blocks until everything logged so far has reached the sink.
+//   The destructor flushes and joins the writer.
+////////////////////////////////////////////////////////////////////////////////
+class Logger {
+
+public:
+    // called on the writer thread; seconds are measured from logger creation
+    using Sink = std::function<void(LogLevel level, double seconds, const char* message)>;
+
+    // timestamped lines on stdout/stderr; the writer flushes both once per batch
+    static Sink ConsoleSink();
+
+    explicit Logger(std::size_t capacity = LOG_RING_CAPACITY, Sink sink = ConsoleSink());
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // returns false if the message was dropped or rate limited
+    bool Write(LogLevel level, LogRateLimiter* limiter, const char* format, ...) CORE_PRINTF_FORMAT(4, 5);
+    bool WriteV(LogLevel level, LogRateLimiter* limiter, const char* format, va_list args);
+
+    void Flush();
+
+    std::size_t Capacity() const { return mask + 1; }
+
+    std::uint64_t Written() const { return written.load(std::memory_order_relaxed); }
+    std::uint64_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+    std::uint64_t Suppressed() const { return suppressed.load(std::memory_order_relaxed); }
+
+    std::int64_t NowNanoseconds() const;
+
+private:
+    struct Slot {
+
+        std::atomic<std::size_t> sequence;
+        LogLevel level;
+        std::int64_t timestamp_ns;
+        char message[LOG_MESSAGE_SIZE];
+    };
+
+    bool Enqueue(LogLevel level, std::int64_t timestamp_ns, const char* format, va_list args);
+
+    // true if the next slot the writer reads has been published
+    bool HasPending() const;
+
+    // drains everything currently published, returns the number written
+    std::size_t Drain();
+    void WriterLoop();
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask;
+
+    Sink sink;
+    const std::int64_t start_ns;
+
+    alignas(64) std::atomic<std::size_t> enqueue_position { 0 };
+    alignas(64) std::atomic<std::size_t> dequeue_position { 0 };
+
+    std::atomic<std::uint64_t> written { 0 };
+    std::atomic<std::uint64_t> dropped { 0 };
+    std::atomic<std::uint64_t> suppressed { 0 };
+
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    std::atomic<bool> writer_sleeping { false };
+    std::atomic<bool> running { true };
+    std::thread writer;
+};
+
+// process-wide logger used by the LOG_* macros
+Logger& DefaultLogger();
+
+} // namespace Core
+
+////////////////////////////////////////////////////////////////////////////////
+// Log Macros
+// --printf-style: LOG_INFO("Mesh Registered:\t%zu bytes", size).
+// --Levels below LOG_MIN_LEVEL expand to nothing, arguments included.
+////////////////////////////////////////////////////////////////////////////////
+#define CORE_LOG(level, ...)                                                    \
+    do {                                                                        \
+        static Core::LogRateLimiter core_log_limiter;                           \
+        Core::DefaultLogger().Write(level, &core_log_limiter, __VA_ARGS__);     \
+    } while (0)
+
+#if LOG_MIN_LEVEL <= 0
+#define LOG_TRACE(...) CORE_LOG(Core::LogLevel::Trace, __VA_ARGS__)
+#else
+#define LOG_TRACE(...) do {} while (0)
+#endif
+
+#if LOG_MIN_LEVEL <= 1
+#define LOG_DEBUG(...) CORE_LOG(Core::LogLevel::Debug, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+#if LOG_MIN_LEVEL <= 2
+#define LOG_INFO(...) CORE_LOG(Core::LogLevel::Info, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+
+#if LOG_MIN_LEVEL <= 3
+#define LOG_WARN(...) CORE_LOG(Core::LogLevel::Warn, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+
+#define LOG_ERROR(...) CORE_LOG(Core::LogLevel::Error, __VA_ARGS__)
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Logger.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "Logger.hpp"
+#include "UnitTest.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+
+// collects sink output for inspection after Flush()
+struct CapturedLog {
+
+    std::mutex mutex;
+    std::vector<LogLevel> levels;
+    std::vector<std::string> messages;
+
+    Logger::Sink Sink() {
+
+        return [this](LogLevel level, double, const char* message) {
+
+            std::lock_guard<std::mutex> lock(mutex);
+            levels.push_back(level);
+            messages.push_back(message);
+        };
+    }
+};
+
+static_assert(IsLogLevelEnabled(LogLevel::Error), "errors are never compiled out");
+static_assert(!IsLogLevelEnabled(LogLevel::Trace) || LOG_MIN_LEVEL <= 0, "trace follows LOG_MIN_LEVEL");
+
+TEST_CASE(MessagesArriveInOrderWithLevels) {
+
+    CapturedLog captured;
+    Logger logger(64, captured.Sink());
+
+    logger.Write(LogLevel::Info, nullptr, "first %d", 1);
+    logger.Write(LogLevel::Warn, nullptr, "second %s", "two");
+    logger.Write(LogLevel::Error, nullptr, "third %.1f", 3.0);
+    logger.Flush();
+
+    CHECK(captured.messages.size() == 3);
+    CHECK(captured.messages[0] == "first 1");
+    CHECK(captured.messages[1] == "second two");
+    CHECK(captured.messages[2] == "third 3.0");
+    CHECK(captured.levels[1] == LogLevel::Warn);
+    CHECK(logger.Written() == 3);
+    CHECK(logger.Dropped() == 0);
+}
+
+TEST_CASE(LongMessagesAreTruncated) {
+
+    CapturedLog captured;
+    Logger logger(8, captured.Sink());
+
+    const std::string long_text(LOG_MESSAGE_SIZE * 2, 'x');
+
+    logger.Write(LogLevel::Info, nullptr, "%s", long_text.c_str());
+    logger.Flush();
+
+    CHECK(captured.messages.size() == 1);
+    CHECK(captured.messages[0].size() == LOG_MESSAGE_SIZE - 1);
+}
+
+TEST_CASE(FullRingDropsInsteadOfBlocking) {
+
+    // hold the writer inside the sink so the ring cannot drain
+    std::mutex gate;
+    std::unique_lock<std::mutex> gate_lock(gate);
+    int delivered = 0;
+
+    Logger logger(8, [&](LogLevel, double, const char*) {
+
+        std::lock_guard<std::mutex> lock(gate);
+        ++delivered;
+    });
+
+    int accepted = 0;
+
+    for (int i = 0; i < 32; ++i) {
+
+        accepted += logger.Write(LogLevel::Info, nullptr, "message %d", i);
+    }
+
+    gate_lock.unlock();
+    logger.Flush();
+
+    CHECK(logger.Capacity() == 8);
+    CHECK(accepted == 8);
+    CHECK(logger.Dropped() == static_cast<std::uint64_t>(32 - accepted));
+    CHECK(delivered == accepted);
+}
+
+TEST_CASE(ConcurrentProducersKeepPerThreadOrder) {
+
+    CapturedLog captured;
+    Logger logger(1 << 14, captured.Sink());
+
+    const int thread_count = 4;
+    const int per_thread = 2000;
+
+    std::vector<std::thread> producers;
+
+    for (int t = 0; t < thread_count; ++t) {
+
+        producers.emplace_back([&logger, t]() {
+
+            for (int i = 0; i < per_thread; ++i) {
+
+                logger.Write(LogLevel::Info, nullptr, "%d %d", t, i);
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+
+        producer.join();
+    }
+
+    logger.Flush();
+
+    CHECK(captured.messages.size() == static_cast<std::size_t>(thread_count * per_thread));
+
+    std::vector<int> next(thread_count, 0);
+    int out_of_order = 0;
+
+    for (const auto& message : captured.messages) {
+
+        int t = 0;
+        int i = 0;
+        std::sscanf(message.c_str(), "%d %d", &t, &i);
+
+        out_of_order += i != next[t];
+        next[t] = i + 1;
+    }
+
+    CHECK(out_of_order == 0);
+}
+
+TEST_CASE(IdleWriterWakesForNewMessages) {
+
+    CapturedLog captured;
+    Logger logger(8, captured.Sink());
+
+    // let the writer find the ring empty and go to sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    logger.Write(LogLevel::Info, nullptr, "wake");
+
+    // no Flush(): the producer itself has to wake the writer
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+    while (logger.Written() == 0 && std::chrono::steady_clock::now() < deadline) {
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    CHECK(logger.Written() == 1);
+}
+
+TEST_CASE(RateLimiterAllowsBurstPerWindow) {
+
+    LogRateLimiter limiter(3, 1000);
+    std::uint32_t suppressed = 0;
+    int allowed = 0;
+
+    for (int i = 0; i < 10; ++i) {
+
+        allowed += limiter.Allow(5000 + i, suppressed);
+    }
+
+    CHECK(allowed == 3);
+
+    // the first message of the next window reports what was dropped
+    CHECK(limiter.Allow(6000, suppressed));
+    CHECK(suppressed == 7);
+
+    CHECK(limiter.Allow(6001, suppressed));
+    CHECK(suppressed == 0);
+}
+
+TEST_CASE(RateLimitedCallSiteReportsSuppressedCount) {
+
+    CapturedLog captured;
+    Logger logger(64, captured.Sink());
+    LogRateLimiter limiter(2, 1000000000000ll);
+
+    for (int i = 0; i < 5; ++i) {
+
+        logger.Write(LogLevel::Warn, &limiter, "repeated");
+    }
+
+    logger.Flush();
+
+    CHECK(captured.messages.size() == 2);
+    CHECK(logger.Suppressed() == 3);
+}
+
+int main() { return Core::Test::RunAll(); }
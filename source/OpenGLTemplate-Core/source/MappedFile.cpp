@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MappedFile.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Core {
+
+MappedFile::~MappedFile() {
+
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+
+    if (this != &other) {
+
+        Close();
+
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+
+#ifdef _WIN32
+        std::swap(file_handle, other.file_handle);
+        std::swap(mapping_handle, other.mapping_handle);
+#endif
+    }
+
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path) {
+
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE) {
+
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    if (!view) {
+
+        if (mapping) {
+
+            CloseHandle(mapping);
+        }
+
+        CloseHandle(file);
+        return false;
+    }
+
+    file_handle = file;
+    mapping_handle = mapping;
+    data = static_cast<const std::uint8_t*>(view);
+    size = static_cast<std::size_t>(file_size.QuadPart);
+
+    return true;
+}
+
+void MappedFile::Close() {
+
+    if (data) {
+
+        UnmapViewOfFile(data);
+        CloseHandle(mapping_handle);
+        CloseHandle(file_handle);
+    }
+
+    data = nullptr;
+    size = 0;
+    file_handle = nullptr;
+    mapping_handle = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+
+    Close();
+
+    const int file = open(path.c_str(), O_RDONLY);
+
+    if (file < 0) {
+
+        return false;
+    }
+
+    struct stat file_stat;
+
+    if (fstat(file, &file_stat) != 0 || file_stat.st_size <= 0) {
+
+        close(file);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+    // the mapping keeps its own reference to the file
+    close(file);
+
+    if (view == MAP_FAILED) {
+
+        return false;
+    }
+
+    data = static_cast<const std::uint8_t*>(view);
+    size = static_cast<std::size_t>(file_stat.st_size);
+
+    return true;
+}
+
+void MappedFile::Close() {
+
+    if (data) {
+
+        munmap(const_cast<std::uint8_t*>(data), size);
+    }
+
+    data = nullptr;
+    size = 0;
+}
+
+#endif
+
+} // namespace Core
@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MappedFile.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Mapped File
+// --Read-only memory mapping of a whole file (mmap, or MapViewOfFile on
+//   Windows). Pages are read in by the OS on first touch, nothing is copied.
+// --Move-only; the mapping is released on Close() or destruction.
+////////////////////////////////////////////////////////////////////////////////
+class MappedFile {
+
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // false if the file cannot be opened or mapped, or is empty
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return data != nullptr; }
+    const std::uint8_t* Data() const { return data; }
+    std::size_t Size() const { return size; }
+
+private:
+    const std::uint8_t* data = nullptr;
+    std::size_t size = 0;
+
+#ifdef _WIN32
+    void* file_handle = nullptr;
+    void* mapping_handle = nullptr;
+#endif
+};
+
+} // namespace Core
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshLod.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshLod.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core {
+
+static constexpr float PI = 3.14159265358979323846f;
+
+int LodSegmentsForRadius(float radius_pixels, float max_error) {
+
+    if (radius_pixels <= max_error) {
+
+        return LOD_MIN_SEGMENTS;
+    }
+
+    const float half_angle = std::acos(1.0f - max_error / radius_pixels);
+    const int segments = static_cast<int>(std::ceil(PI / half_angle));
+
+    return std::max(segments, LOD_MIN_SEGMENTS);
+}
+
+int LodBucket(int segment_count) {
+
+    int bucket = 0;
+
+    while (bucket + 1 < LOD_BUCKET_COUNT && LodBucketSegments(bucket) < segment_count) {
+
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+int LodBucketSegments(int bucket) {
+
+    return LOD_MIN_SEGMENTS << bucket;
+}
+
+float ProjectedRadius(const Affine2D& clip_transform, float bounding_radius,
+                      float viewport_width, float viewport_height) {
+
+    // half extents of the transformed bounding circle, as in IsVisible()
+    const float extent_x = bounding_radius * std::sqrt(clip_transform.a * clip_transform.a +
+                                                       clip_transform.c * clip_transform.c);
+    const float extent_y = bounding_radius * std::sqrt(clip_transform.b * clip_transform.b +
+                                                       clip_transform.d * clip_transform.d);
+
+    return std::max(extent_x * 0.5f * viewport_width, extent_y * 0.5f * viewport_height);
+}
+
+void MeshLod::AddCurve(MeshId base_mesh, CurveGenerator generate) {
+
+    if (base_mesh >= curve_of_mesh.size()) {
+
+        curve_of_mesh.resize(base_mesh + 1, -1);
+    }
+
+    Curve& curve = curves.emplace_back();
+    curve.base_mesh = base_mesh;
+    curve.generate = generate;
+    curve.buckets.fill(NO_MESH);
+
+    curve_of_mesh[base_mesh] = static_cast<int>(curves.size() - 1);
+}
+
+void MeshLod::SetViewport(int width, int height) {
+
+    viewport_width = static_cast<float>(width);
+    viewport_height = static_cast<float>(height);
+}
+
+bool MeshLod::IsCurve(MeshId mesh) const {
+
+    return mesh < curve_of_mesh.size() && curve_of_mesh[mesh] >= 0;
+}
+
+MeshId MeshLod::Select(MeshId mesh, float radius_pixels) const {
+
+    if (!IsCurve(mesh)) {
+
+        return mesh;
+    }
+
+    const Curve& curve = curves[curve_of_mesh[mesh]];
+    const int wanted = LodBucket(LodSegmentsForRadius(radius_pixels));
+
+    if (curve.buckets[wanted] != NO_MESH) {
+
+        return curve.buckets[wanted];
+    }
+
+    const std::uint32_t bit = 1u << wanted;
+
+    if (!(curve.requested.load(std::memory_order_relaxed) & bit)) {
+
+        curve.requested.fetch_or(bit, std::memory_order_relaxed);
+    }
+
+    // finer first so a missing bucket never shows facets
+    for (int bucket = wanted + 1; bucket < LOD_BUCKET_COUNT; ++bucket) {
+
+        if (curve.buckets[bucket] != NO_MESH) {
+
+            return curve.buckets[bucket];
+        }
+    }
+
+    for (int bucket = wanted - 1; bucket >= 0; --bucket) {
+
+        if (curve.buckets[bucket] != NO_MESH) {
+
+            return curve.buckets[bucket];
+        }
+    }
+
+    return curve.base_mesh;
+}
+
+MeshId MeshLod::Select(MeshId mesh, const Affine2D& clip_transform, float bounding_radius) const {
+
+    if (!IsCurve(mesh)) {
+
+        return mesh;
+    }
+
+    return Select(mesh, ProjectedRadius(clip_transform, bounding_radius,
+                                        viewport_width, viewport_height));
+}
+
+bool MeshLod::HasRequests() const {
+
+    for (const Curve& curve : curves) {
+
+        if (curve.requested.load(std::memory_order_relaxed) != 0) {
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::size_t MeshLod::Resolve(MeshRegistry& meshes) {
+
+    std::size_t registered = 0;
+
+    for (Curve& curve : curves) {
+
+        const std::uint32_t requested = curve.requested.exchange(0, std::memory_order_relaxed);
+
+        for (int bucket = 0; bucket < LOD_BUCKET_COUNT; ++bucket) {
+
+            if (!(requested & (1u << bucket)) || curve.buckets[bucket] != NO_MESH) {
+
+                continue;
+            }
+
+            curve.buckets[bucket] = meshes.Register(curve.generate(LodBucketSegments(bucket)));
+            registered += 1;
+        }
+    }
+
+    resident_count += registered;
+    return registered;
+}
+
+MeshId MeshLod::BucketMesh(MeshId base_mesh, int bucket) const {
+
+    return IsCurve(base_mesh) ? curves[curve_of_mesh[base_mesh]].buckets[bucket] : NO_MESH;
+}
+
+} // namespace Core
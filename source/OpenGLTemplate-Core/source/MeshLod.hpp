@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshLod.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "Affine2D.hpp"
+#include "IndexedMesh.hpp"
+#include "MeshRegistry.hpp"
+
+#define LOD_PIXEL_ERROR     0.25f   // allowed gap between a chord and its arc, pixels
+#define LOD_MIN_SEGMENTS    8       // segments of the coarsest bucket
+#define LOD_BUCKET_COUNT    7       // buckets double in segments: 8, 16, ... 512
+
+namespace Core {
+
+// tessellation of a curve with the given segment count, in model units
+using CurveGenerator = IndexedMesh (*)(int segment_count);
+
+// fewest segments whose sagitta r * (1 - cos(pi / n)) stays within max_error
+int LodSegmentsForRadius(float radius_pixels, float max_error = LOD_PIXEL_ERROR);
+
+// smallest bucket with at least segment_count segments, clamped to the finest
+int LodBucket(int segment_count);
+int LodBucketSegments(int bucket);
+
+// radius in pixels of a bounding circle under a clip-space transform
+float ProjectedRadius(const Affine2D& clip_transform, float bounding_radius,
+                      float viewport_width, float viewport_height);
+
+////////////////////////////////////////////////////////////////////////////////
+// Mesh Level of Detail
+// --Curved meshes (circles) are drawn with a tessellation chosen from their
+//   radius on screen instead of one fixed segment count, so small instances
+//   cost a handful of vertices and large ones stay smooth.
+// --Tessellations are built lazily, one per bucket, and registered in the
+//   shared MeshRegistry. Select() is safe from any thread: a bucket that is
+//   not built yet is requested and the nearest finer one (or the curve's
+//   base mesh) is drawn meanwhile. Resolve() builds the requests between
+//   frames; upload the registry again when it returns non-zero.
+////////////////////////////////////////////////////////////////////////////////
+class MeshLod {
+
+public:
+    static constexpr MeshId NO_MESH = UINT32_MAX;
+
+    // base_mesh is drawn until its first bucket is resolved
+    void AddCurve(MeshId base_mesh, CurveGenerator generate);
+
+    void SetViewport(int width, int height);
+
+    bool IsCurve(MeshId mesh) const;
+
+    // mesh to draw instead of mesh, which is returned as is if not a curve
+    MeshId Select(MeshId mesh, float radius_pixels) const;
+    MeshId Select(MeshId mesh, const Affine2D& clip_transform, float bounding_radius) const;
+
+    // true if Select() requested a bucket since the last Resolve()
+    bool HasRequests() const;
+
+    // builds every requested bucket; returns how many meshes were registered
+    std::size_t Resolve(MeshRegistry& meshes);
+
+    // built tessellation of a bucket, NO_MESH until resolved
+    MeshId BucketMesh(MeshId base_mesh, int bucket) const;
+    std::size_t ResidentCount() const { return resident_count; }
+
+private:
+    struct Curve {
+
+        MeshId base_mesh = 0;
+        CurveGenerator generate = nullptr;
+
+        std::array<MeshId, LOD_BUCKET_COUNT> buckets;
+        mutable std::atomic<std::uint32_t> requested{0};    // one bit per bucket
+    };
+
+    std::deque<Curve> curves;               // deque, atomics cannot move
+    std::vector<int> curve_of_mesh;         // indexed by MeshId, -1 if not a curve
+
+    float viewport_width = 0.0f;
+    float viewport_height = 0.0f;
+
+    std::size_t resident_count = 0;
+};
+
+} // namespace Core
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshLod.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshLod.hpp"
+#include "Models.hpp"
+#include "UnitTest.hpp"
+
+#include <cmath>
+
+using namespace Core;
+
+static constexpr float PI = 3.14159265358979323846f;
+
+TEST_CASE(SegmentCountKeepsTheSagittaWithinTheError) {
+
+    CHECK(LodSegmentsForRadius(0.0f) == LOD_MIN_SEGMENTS);
+    CHECK(LodSegmentsForRadius(2.0f) == LOD_MIN_SEGMENTS);
+
+    int previous = 0;
+
+    for (float radius = 1.0f; radius < 4000.0f; radius *= 1.5f) {
+
+        const int segments = LodSegmentsForRadius(radius);
+
+        CHECK(segments >= previous);
+        CHECK(radius * (1.0f - std::cos(PI / segments)) <= LOD_PIXEL_ERROR + 1e-4f);
+
+        previous = segments;
+    }
+}
+
+TEST_CASE(BucketsRoundUpAndClampToTheFinest) {
+
+    CHECK(LodBucketSegments(0) == LOD_MIN_SEGMENTS);
+    CHECK(LodBucketSegments(3) == LOD_MIN_SEGMENTS * 8);
+
+    CHECK(LodBucket(1) == 0);
+    CHECK(LodBucket(LOD_MIN_SEGMENTS) == 0);
+    CHECK(LodBucket(LOD_MIN_SEGMENTS + 1) == 1);
+    CHECK(LodBucket(1 << 20) == LOD_BUCKET_COUNT - 1);
+}
+
+TEST_CASE(ProjectedRadiusScalesWithTransformAndViewport) {
+
+    const Affine2D ortho = Affine2D::Ortho(-100.0f, 100.0f, -50.0f, 50.0f);
+
+    // 200 x 100 units on 400 x 200 pixels: 2 pixels per unit on both axes
+    CHECK_NEAR(ProjectedRadius(ortho, 10.0f, 400.0f, 200.0f), 20.0f, 1e-4f);
+    CHECK_NEAR(ProjectedRadius(ortho * Affine2D::Scale(3.0f, 1.0f), 10.0f, 400.0f, 200.0f), 60.0f, 1e-4f);
+    CHECK_NEAR(ProjectedRadius(ortho * Affine2D::Rotation(0.7f), 10.0f, 400.0f, 200.0f), 20.0f, 1e-3f);
+}
+
+TEST_CASE(CircleMeshIsAClosedStripOnTheModelRadius) {
+
+    const IndexedMesh mesh = BuildCircleMesh(16);
+
+    CHECK(mesh.vertices.size() == 16);
+    CHECK(mesh.indices.size() == 17);
+    CHECK(mesh.indices.front() == mesh.indices.back());
+
+    for (const PackedVertex& vertex : mesh.vertices) {
+
+        const float radius = std::hypot(DequantizePosition(vertex.x), DequantizePosition(vertex.y));
+        CHECK_NEAR(radius, MODEL_LENGTH / 2.0f, 0.1f);
+    }
+}
+
+TEST_CASE(MissingBucketsAreRequestedAndResolvedOnce) {
+
+    MeshRegistry meshes;
+    const MeshId square = meshes.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    const MeshId circle = meshes.Register(BuildCircleMesh(LodBucketSegments(2)));
+
+    MeshLod lod;
+    lod.AddCurve(circle, BuildCircleMesh);
+
+    const float small_radius = 3.0f;
+    const float large_radius = 1000.0f;
+    const int small_bucket = LodBucket(LodSegmentsForRadius(small_radius));
+    const int large_bucket = LodBucket(LodSegmentsForRadius(large_radius));
+
+    CHECK(!lod.IsCurve(square));
+    CHECK(lod.Select(square, large_radius) == square);
+
+    // nothing built yet: the base mesh is drawn and both buckets requested
+    CHECK(lod.Select(circle, small_radius) == circle);
+    CHECK(lod.Select(circle, large_radius) == circle);
+    CHECK(lod.Select(circle, small_radius) == circle);
+    CHECK(lod.HasRequests());
+
+    CHECK(lod.Resolve(meshes) == 2);
+    CHECK(!lod.HasRequests());
+    CHECK(lod.Resolve(meshes) == 0);
+    CHECK(lod.ResidentCount() == 2);
+    CHECK(meshes.MeshCount() == 4);
+
+    const MeshId small_mesh = lod.BucketMesh(circle, small_bucket);
+    const MeshId large_mesh = lod.BucketMesh(circle, large_bucket);
+
+    CHECK(lod.Select(circle, small_radius) == small_mesh);
+    CHECK(lod.Select(circle, large_radius) == large_mesh);
+    CHECK(meshes.Range(small_mesh).index_count == LodBucketSegments(small_bucket) + 1);
+
+    // LOD meshes are not curves themselves
+    CHECK(lod.Select(small_mesh, large_radius) == small_mesh);
+
+    // an unbuilt middle bucket draws the next finer one meanwhile
+    const float middle_radius = 40.0f;
+    const int middle_bucket = LodBucket(LodSegmentsForRadius(middle_radius));
+
+    CHECK(middle_bucket > small_bucket && middle_bucket < large_bucket);
+    CHECK(lod.Select(circle, middle_radius) == large_mesh);
+    CHECK(lod.Resolve(meshes) == 1);
+    CHECK(lod.Select(circle, middle_radius) == lod.BucketMesh(circle, middle_bucket));
+}
+
+int main() { return Core::Test::RunAll(); }
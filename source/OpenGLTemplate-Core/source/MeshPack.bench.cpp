@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshPack.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshPack.hpp"
+#include "Benchmark.hpp"
+#include "MeshRegistry.hpp"
+#include "MeshSource.hpp"
+#include "RecordingRenderDevice.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Core;
+
+#define MESH_COUNT      4000
+#define PACK_PATH       "MeshPack.bench.bmesh"
+
+// a mix of polygons and curved paths, like hand-authored model sources
+static std::string GenerateSource(std::size_t count) {
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> sides(3, 64);
+    std::uniform_real_distribution<float> size(10.0f, 200.0f);
+
+    std::string text;
+    char line[256];
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        text += "mesh shape_" + std::to_string(i) + "\n";
+
+        if (i % 2 == 0) {
+
+            std::snprintf(line, sizeof(line), "polygon %d %.2f\n", sides(rng), size(rng));
+        }
+        else {
+
+            const float s = size(rng);
+            std::snprintf(line, sizeof(line), "path M %.2f 0 Q 0 %.2f %.2f 0 C 0 %.2f %.2f 0 0 %.2f Z\n",
+                          -s, s, s, -s, -s, -s);
+        }
+
+        text += line;
+    }
+
+    return text;
+}
+
+static void RegisterSources(const std::vector<MeshSource>& sources, MeshRegistry& registry) {
+
+    for (const MeshSource& source : sources) {
+
+        registry.Register(BuildIndexedMesh(source.line_vertices.data(), source.line_vertices.size()));
+    }
+}
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : MESH_COUNT;
+    const std::string text = GenerateSource(count);
+
+    // the asset compiler's work, done once at build time
+    std::vector<MeshSource> sources;
+    std::string error;
+
+    if (!ParseMeshSource(text, sources, error)) {
+
+        std::printf("bad source: %s\n", error.c_str());
+        return 1;
+    }
+
+    MeshRegistry compiled;
+    std::vector<std::string> names;
+    RegisterSources(sources, compiled);
+
+    for (const MeshSource& source : sources) {
+
+        names.push_back(source.name);
+    }
+
+    if (!WriteMeshPack(PACK_PATH, compiled, names)) {
+
+        std::printf("cannot write %s\n", PACK_PATH);
+        return 1;
+    }
+
+    std::printf("%zu meshes, %zu vertices, %zu indices, %zu KB text\n", count, compiled.VertexCount(),
+                compiled.IndexCount(), text.size() / 1024);
+
+    const double parse = Bench::Run("parse + build + register + upload", count, [&]() {
+
+        std::vector<MeshSource> parsed;
+        std::string parse_error;
+        ParseMeshSource(text, parsed, parse_error);
+
+        MeshRegistry registry;
+        RegisterSources(parsed, registry);
+
+        RecordingRenderDevice device;
+        registry.Upload(device);
+        registry.Destroy();
+    });
+
+    const double mapped = Bench::Run("open pack + load + upload", count, [&]() {
+
+        MeshPack pack;
+        pack.Open(PACK_PATH);
+
+        MeshRegistry registry;
+        registry.Load(pack);
+
+        RecordingRenderDevice device;
+        registry.Upload(device);
+        registry.Destroy();
+    });
+
+    std::printf("  speedup %.1fx\n", parse / mapped);
+
+    std::remove(PACK_PATH);
+    return 0;
+}
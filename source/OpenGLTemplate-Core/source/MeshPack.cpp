@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshPack.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshPack.hpp"
+
+#include <cstring>
+#include <fstream>
+
+#include "MeshRegistry.hpp"
+
+namespace Core {
+
+static std::uint64_t AlignSection(std::uint64_t offset) {
+
+    return (offset + MESH_PACK_ALIGNMENT - 1) / MESH_PACK_ALIGNMENT * MESH_PACK_ALIGNMENT;
+}
+
+bool MeshPack::Fail(const char* message) {
+
+    file.Close();
+
+    header = nullptr;
+    entries = nullptr;
+    vertices = nullptr;
+    indices = nullptr;
+    error = message;
+
+    return false;
+}
+
+bool MeshPack::Open(const std::string& path) {
+
+    Close();
+
+    if (!file.Open(path)) {
+
+        return Fail("cannot open file");
+    }
+
+    const std::uint8_t* data = file.Data();
+    const std::uint64_t size = file.Size();
+
+    if (size < sizeof(MeshPackHeader)) {
+
+        return Fail("file too small");
+    }
+
+    const MeshPackHeader* candidate = reinterpret_cast<const MeshPackHeader*>(data);
+
+    if (candidate->magic != MESH_PACK_MAGIC) {
+
+        return Fail("not a mesh pack");
+    }
+
+    if (candidate->version != MESH_PACK_VERSION) {
+
+        return Fail("unsupported version");
+    }
+
+    const MeshVertexFormat expected;
+    const MeshVertexFormat& format = candidate->vertex_format;
+
+    if (format.components != expected.components || format.format != expected.format ||
+        format.normalized != expected.normalized || format.stride != expected.stride ||
+        format.position_extent != expected.position_extent) {
+
+        return Fail("vertex format does not match PackedVertex");
+    }
+
+    auto section_fits = [&](std::uint64_t offset, std::uint64_t count, std::uint64_t element_size) {
+
+        return offset % MESH_PACK_ALIGNMENT == 0 && offset <= size && count <= (size - offset) / element_size;
+    };
+
+    if (candidate->file_size != size ||
+        !section_fits(candidate->table_offset, candidate->mesh_count, sizeof(MeshPackEntry)) ||
+        !section_fits(candidate->vertex_offset, candidate->vertex_count, sizeof(PackedVertex)) ||
+        !section_fits(candidate->index_offset, candidate->index_count, sizeof(std::uint16_t))) {
+
+        return Fail("sections out of bounds");
+    }
+
+    const MeshPackEntry* table = reinterpret_cast<const MeshPackEntry*>(data + candidate->table_offset);
+
+    for (std::uint32_t mesh = 0; mesh < candidate->mesh_count; ++mesh) {
+
+        const MeshPackEntry& entry = table[mesh];
+
+        if (entry.first_vertex < 0 || entry.vertex_count < 0 || entry.first_index < 0 || entry.index_count < 0 ||
+            static_cast<std::uint64_t>(entry.first_vertex) + entry.vertex_count > candidate->vertex_count ||
+            static_cast<std::uint64_t>(entry.first_index) + entry.index_count > candidate->index_count) {
+
+            return Fail("mesh range out of bounds");
+        }
+    }
+
+    const std::uint16_t* index_data = reinterpret_cast<const std::uint16_t*>(data + candidate->index_offset);
+
+    // indices go to the GPU as is, so one outside its mesh would read past the
+    // mesh's vertices when drawn
+    for (std::uint32_t mesh = 0; mesh < candidate->mesh_count; ++mesh) {
+
+        const MeshPackEntry& entry = table[mesh];
+        const std::uint16_t* first = index_data + entry.first_index;
+
+        for (std::int32_t i = 0; i < entry.index_count; ++i) {
+
+            if (first[i] != PRIMITIVE_RESTART_INDEX && first[i] >= entry.vertex_count) {
+
+                return Fail("mesh index out of range");
+            }
+        }
+    }
+
+    header = candidate;
+    entries = table;
+    vertices = reinterpret_cast<const PackedVertex*>(data + header->vertex_offset);
+    indices = index_data;
+    error = "";
+
+    return true;
+}
+
+void MeshPack::Close() {
+
+    file.Close();
+
+    header = nullptr;
+    entries = nullptr;
+    vertices = nullptr;
+    indices = nullptr;
+}
+
+int MeshPack::Find(NameHash name) const {
+
+    for (std::size_t mesh = 0; mesh < MeshCount(); ++mesh) {
+
+        if (entries[mesh].name == name) {
+
+            return static_cast<int>(mesh);
+        }
+    }
+
+    return -1;
+}
+
+std::vector<std::uint8_t> EncodeMeshPack(const MeshRegistry& registry, const std::vector<std::string>& names) {
+
+    const std::vector<PackedVertex>& vertices = registry.PackedVertices();
+    const std::vector<std::uint16_t>& indices = registry.PackedIndices();
+
+    MeshPackHeader header;
+    header.mesh_count = static_cast<std::uint32_t>(registry.MeshCount());
+    header.vertex_count = static_cast<std::uint32_t>(vertices.size());
+    header.index_count = static_cast<std::uint32_t>(indices.size());
+
+    header.table_offset = AlignSection(sizeof(MeshPackHeader));
+    header.vertex_offset = AlignSection(header.table_offset + header.mesh_count * sizeof(MeshPackEntry));
+    header.index_offset = AlignSection(header.vertex_offset + header.vertex_count * sizeof(PackedVertex));
+    header.file_size = header.index_offset + header.index_count * sizeof(std::uint16_t);
+
+    std::vector<std::uint8_t> file(header.file_size, 0);
+    std::memcpy(file.data(), &header, sizeof(header));
+
+    MeshPackEntry* entries = reinterpret_cast<MeshPackEntry*>(file.data() + header.table_offset);
+
+    for (MeshId mesh = 0; mesh < registry.MeshCount(); ++mesh) {
+
+        const MeshRange& range = registry.Range(mesh);
+
+        // a mesh's vertices run up to the next mesh's first vertex
+        const int next_vertex = mesh + 1 < registry.MeshCount()
+            ? registry.Range(mesh + 1).first_vertex : static_cast<int>(vertices.size());
+
+        MeshPackEntry& entry = entries[mesh];
+        entry.name = mesh < names.size() ? HashName(names[mesh]) : 0;
+        entry.first_vertex = range.first_vertex;
+        entry.vertex_count = next_vertex - range.first_vertex;
+        entry.first_index = range.first_index;
+        entry.index_count = range.index_count;
+        entry.bounding_radius = range.bounding_radius;
+    }
+
+    std::memcpy(file.data() + header.vertex_offset, vertices.data(), vertices.size() * sizeof(PackedVertex));
+    std::memcpy(file.data() + header.index_offset, indices.data(), indices.size() * sizeof(std::uint16_t));
+
+    return file;
+}
+
+bool WriteMeshPack(const std::string& path, const MeshRegistry& registry, const std::vector<std::string>& names) {
+
+    const std::vector<std::uint8_t> encoded = EncodeMeshPack(registry, names);
+
+    std::ofstream file(path, std::ios::binary);
+
+    if (!file) {
+
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+
+    return static_cast<bool>(file);
+}
+
+} // namespace Core
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshPack.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "IndexedMesh.hpp"
+#include "MappedFile.hpp"
+#include "RenderDevice.hpp"
+
+#define MESH_PACK_MAGIC     0x4B504D42u     // "BMPK" in file order
+#define MESH_PACK_VERSION   1
+#define MESH_PACK_ALIGNMENT 64              // every section starts on a cache line
+
+namespace Core {
+
+class MeshRegistry;
+
+// how the vertex section is laid out, checked against PackedVertex on load
+struct MeshVertexFormat {
+
+    std::uint8_t components = 2;
+    std::uint8_t format = static_cast<std::uint8_t>(AttributeFormat::Short);
+    std::uint8_t normalized = 1;
+    std::uint8_t stride = sizeof(PackedVertex);
+    float position_extent = POSITION_EXTENT;
+};
+
+struct MeshPackHeader {
+
+    std::uint32_t magic = MESH_PACK_MAGIC;
+    std::uint32_t version = MESH_PACK_VERSION;
+
+    std::uint32_t mesh_count = 0;
+    std::uint32_t vertex_count = 0;
+    std::uint32_t index_count = 0;
+
+    MeshVertexFormat vertex_format;
+    std::uint32_t reserved = 0;
+
+    // byte offsets from the start of the file
+    std::uint64_t table_offset = 0;     // mesh_count MeshPackEntry
+    std::uint64_t vertex_offset = 0;    // vertex_count PackedVertex
+    std::uint64_t index_offset = 0;     // index_count uint16
+    std::uint64_t file_size = 0;
+};
+
+// one mesh, the same range MeshRegistry uses
+struct MeshPackEntry {
+
+    NameHash name = 0;                  // HashName of the mesh's source name
+    std::int32_t first_vertex = 0;
+    std::int32_t vertex_count = 0;
+    std::int32_t first_index = 0;
+    std::int32_t index_count = 0;
+    float bounding_radius = 0.0f;
+};
+
+static_assert(sizeof(MeshPackHeader) == 64, "MeshPackHeader is part of the file format");
+static_assert(sizeof(MeshPackEntry) == 24, "MeshPackEntry is part of the file format");
+
+////////////////////////////////////////////////////////////////////////////////
+// Mesh Pack
+// --Binary file of many meshes, laid out exactly like MeshRegistry's shared
+//   buffers: header, mesh table, PackedVertex section, uint16 line strip
+//   index section (PRIMITIVE_RESTART_INDEX between strips). Little endian.
+// --Open() maps the file and checks the header and table, never the
+//   geometry itself; the vertex and index sections are handed to the
+//   device as they are (see MeshRegistry::Load). The pack must stay open
+//   while a registry uses it.
+// --Written by the asset compiler from text sources (see MeshSource.hpp).
+////////////////////////////////////////////////////////////////////////////////
+class MeshPack {
+
+public:
+    // false with Error() set if the file is missing or not a valid pack
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return header != nullptr; }
+    const char* Error() const { return error; }
+
+    std::size_t MeshCount() const { return header ? header->mesh_count : 0; }
+    const MeshPackEntry& Entry(std::size_t mesh) const { return entries[mesh]; }
+
+    // index of the first mesh with this name, -1 if none
+    int Find(NameHash name) const;
+
+    const PackedVertex* Vertices() const { return vertices; }
+    std::size_t VertexCount() const { return header ? header->vertex_count : 0; }
+    const std::uint16_t* Indices() const { return indices; }
+    std::size_t IndexCount() const { return header ? header->index_count : 0; }
+
+private:
+    bool Fail(const char* message);
+
+    MappedFile file;
+    const MeshPackHeader* header = nullptr;
+    const MeshPackEntry* entries = nullptr;
+    const PackedVertex* vertices = nullptr;
+    const std::uint16_t* indices = nullptr;
+
+    const char* error = "";
+};
+
+// every mesh registered with registry (not a loaded pack), names[i] naming MeshId i
+std::vector<std::uint8_t> EncodeMeshPack(const MeshRegistry& registry, const std::vector<std::string>& names);
+bool WriteMeshPack(const std::string& path, const MeshRegistry& registry, const std::vector<std::string>& names);
+
+} // namespace Core
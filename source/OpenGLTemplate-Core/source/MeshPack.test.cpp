@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshPack.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshPack.hpp"
+#include "MeshRegistry.hpp"
+#include "Models.hpp"
+#include "RecordingRenderDevice.hpp"
+#include "UnitTest.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+using namespace Core;
+
+static const char* PACK_PATH = "MeshPack.test.bmesh";
+
+static void BuildRegistry(MeshRegistry& registry, std::vector<std::string>& names) {
+
+    registry.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    registry.Register(BuildIndexedMesh(triangle_vertices.data(), triangle_vertices.size()));
+    registry.Register(BuildIndexedMesh(circle_vertices.data(), circle_vertices.size()));
+
+    names = {"square", "triangle", "circle"};
+}
+
+static void WriteBytes(const std::vector<std::uint8_t>& bytes) {
+
+    std::ofstream file(PACK_PATH, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+static std::vector<std::uint8_t> EncodeTestPack() {
+
+    MeshRegistry registry;
+    std::vector<std::string> names;
+    BuildRegistry(registry, names);
+
+    return EncodeMeshPack(registry, names);
+}
+
+TEST_CASE(PackRoundTripsThroughAFile) {
+
+    MeshRegistry registry;
+    std::vector<std::string> names;
+    BuildRegistry(registry, names);
+
+    CHECK(WriteMeshPack(PACK_PATH, registry, names));
+
+    MeshPack pack;
+    CHECK(pack.Open(PACK_PATH));
+    CHECK(pack.MeshCount() == 3);
+    CHECK(pack.VertexCount() == registry.VertexCount());
+    CHECK(pack.IndexCount() == registry.IndexCount());
+
+    // sections start on cache lines, so the mapping can be used in place
+    CHECK(reinterpret_cast<std::uintptr_t>(pack.Vertices()) % MESH_PACK_ALIGNMENT == 0);
+    CHECK(std::memcmp(pack.Vertices(), registry.PackedVertices().data(),
+                      registry.VertexCount() * sizeof(PackedVertex)) == 0);
+    CHECK(std::memcmp(pack.Indices(), registry.PackedIndices().data(),
+                      registry.IndexCount() * sizeof(std::uint16_t)) == 0);
+
+    const int circle = pack.Find(HashName("circle"));
+    CHECK(circle == 2);
+    CHECK(pack.Find(HashName("hexagon")) == -1);
+
+    const MeshPackEntry& entry = pack.Entry(circle);
+    CHECK(entry.first_index == registry.Range(2).first_index);
+    CHECK(entry.index_count == registry.Range(2).index_count);
+    CHECK(entry.first_vertex + entry.vertex_count == static_cast<int>(registry.VertexCount()));
+    CHECK_NEAR(entry.bounding_radius, registry.Range(2).bounding_radius, 1e-6f);
+
+    pack.Close();
+    std::remove(PACK_PATH);
+}
+
+TEST_CASE(InvalidPacksAreRejected) {
+
+    const std::vector<std::uint8_t> valid = EncodeTestPack();
+    MeshPack pack;
+
+    std::vector<std::uint8_t> bad_magic = valid;
+    bad_magic[0] ^= 0xFF;
+    WriteBytes(bad_magic);
+    CHECK(!pack.Open(PACK_PATH));
+    CHECK(std::strcmp(pack.Error(), "not a mesh pack") == 0);
+
+    std::vector<std::uint8_t> bad_version = valid;
+    bad_version[offsetof(MeshPackHeader, version)] += 1;
+    WriteBytes(bad_version);
+    CHECK(!pack.Open(PACK_PATH));
+    CHECK(std::strcmp(pack.Error(), "unsupported version") == 0);
+
+    std::vector<std::uint8_t> truncated(valid.begin(), valid.end() - 2);
+    WriteBytes(truncated);
+    CHECK(!pack.Open(PACK_PATH));
+    CHECK(!pack.IsOpen());
+
+    MeshPackHeader header;
+    std::memcpy(&header, valid.data(), sizeof(header));
+
+    std::vector<std::uint8_t> bad_entry = valid;
+    MeshPackEntry entry;
+    std::memcpy(&entry, valid.data() + header.table_offset, sizeof(entry));
+    entry.index_count = static_cast<std::int32_t>(header.index_count) + 1;
+    std::memcpy(bad_entry.data() + header.table_offset, &entry, sizeof(entry));
+    WriteBytes(bad_entry);
+    CHECK(!pack.Open(PACK_PATH));
+    CHECK(std::strcmp(pack.Error(), "mesh range out of bounds") == 0);
+
+    std::vector<std::uint8_t> bad_index = valid;
+    std::memcpy(&entry, valid.data() + header.table_offset, sizeof(entry));
+    const std::uint16_t past_end = static_cast<std::uint16_t>(entry.vertex_count);
+    std::memcpy(bad_index.data() + header.index_offset + entry.first_index * sizeof(std::uint16_t),
+                &past_end, sizeof(past_end));
+    WriteBytes(bad_index);
+    CHECK(!pack.Open(PACK_PATH));
+    CHECK(std::strcmp(pack.Error(), "mesh index out of range") == 0);
+
+    CHECK(!pack.Open("MeshPack.test.missing"));
+
+    WriteBytes(valid);
+    CHECK(pack.Open(PACK_PATH));
+
+    pack.Close();
+    std::remove(PACK_PATH);
+}
+
+TEST_CASE(LoadedPackUploadsLikeRegisteredMeshes) {
+
+    MeshRegistry direct;
+    std::vector<std::string> names;
+    BuildRegistry(direct, names);
+
+    RecordingRenderDevice direct_device;
+    direct.Upload(direct_device);
+
+    WriteMeshPack(PACK_PATH, direct, names);
+
+    MeshPack pack;
+    CHECK(pack.Open(PACK_PATH));
+
+    MeshRegistry loaded;
+    CHECK(loaded.Load(pack));
+    CHECK(!loaded.Load(pack));
+    CHECK(loaded.MeshCount() == direct.MeshCount());
+
+    for (MeshId mesh = 0; mesh < direct.MeshCount(); ++mesh) {
+
+        CHECK(loaded.Range(mesh).first_vertex == direct.Range(mesh).first_vertex);
+        CHECK(loaded.Range(mesh).first_index == direct.Range(mesh).first_index);
+        CHECK(loaded.Range(mesh).index_count == direct.Range(mesh).index_count);
+    }
+
+    RecordingRenderDevice loaded_device;
+    loaded.Upload(loaded_device);
+
+    // straight from the mapping: created with data, no extra uploads
+    CHECK(loaded_device.CountCommands(RenderCommandType::UploadBuffer) == 0);
+    CHECK(loaded_device.Buffer(loaded.VertexBuffer())->data ==
+          direct_device.Buffer(direct.VertexBuffer())->data);
+    CHECK(loaded_device.Buffer(loaded.IndexBuffer())->data ==
+          direct_device.Buffer(direct.IndexBuffer())->data);
+
+    loaded.Destroy();
+    pack.Close();
+    std::remove(PACK_PATH);
+}
+
+TEST_CASE(MeshesRegisteredAfterLoadFollowThePack) {
+
+    MeshRegistry source;
+    std::vector<std::string> names;
+    BuildRegistry(source, names);
+    WriteMeshPack(PACK_PATH, source, names);
+
+    MeshPack pack;
+    CHECK(pack.Open(PACK_PATH));
+
+    MeshRegistry mixed;
+    mixed.Load(pack);
+    const MeshId hexagon = mixed.Register(BuildIndexedMesh(hexagon_vertices.data(), hexagon_vertices.size()));
+
+    MeshRegistry direct;
+    BuildRegistry(direct, names);
+    const MeshId direct_hexagon = direct.Register(BuildIndexedMesh(hexagon_vertices.data(), hexagon_vertices.size()));
+
+    CHECK(hexagon == 3);
+    CHECK(mixed.Range(hexagon).first_vertex == direct.Range(direct_hexagon).first_vertex);
+    CHECK(mixed.Range(hexagon).first_index == direct.Range(direct_hexagon).first_index);
+    CHECK(mixed.VertexCount() == direct.VertexCount());
+
+    RecordingRenderDevice mixed_device;
+    RecordingRenderDevice direct_device;
+    mixed.Upload(mixed_device);
+    direct.Upload(direct_device);
+
+    CHECK(mixed_device.Buffer(mixed.VertexBuffer())->data == direct_device.Buffer(direct.VertexBuffer())->data);
+    CHECK(mixed_device.Buffer(mixed.IndexBuffer())->data == direct_device.Buffer(direct.IndexBuffer())->data);
+
+    // and again after the first upload
+    mixed.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    direct.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    mixed.Upload(mixed_device);
+    direct.Upload(direct_device);
+
+    CHECK(mixed_device.Buffer(mixed.VertexBuffer())->data == direct_device.Buffer(direct.VertexBuffer())->data);
+    CHECK(mixed_device.Buffer(mixed.IndexBuffer())->data == direct_device.Buffer(direct.IndexBuffer())->data);
+
+    mixed.Destroy();
+    pack.Close();
+    std::remove(PACK_PATH);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshRegistry.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshRegistry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "MeshPack.hpp"
+
+namespace Core {
+
+bool MeshRegistry::Load(const MeshPack& source) {
+
+    if (!ranges.empty() || device || !source.IsOpen()) {
+
+        return false;
+    }
+
+    pack = &source;
+    pack_vertex_count = source.VertexCount();
+    pack_index_count = source.IndexCount();
+
+    ranges.resize(source.MeshCount());
+
+    for (std::size_t mesh = 0; mesh < source.MeshCount(); ++mesh) {
+
+        const MeshPackEntry& entry = source.Entry(mesh);
+
+        ranges[mesh].first_vertex = entry.first_vertex;
+        ranges[mesh].first_index = entry.first_index;
+        ranges[mesh].index_count = entry.index_count;
+        ranges[mesh].bounding_radius = entry.bounding_radius;
+    }
+
+    return true;
+}
+
+MeshId MeshRegistry::Register(const IndexedMesh& mesh) {
+
+    MeshRange range;
+    range.first_vertex = static_cast<int>(VertexCount());
+    range.first_index = static_cast<int>(IndexCount());
+    range.index_count = static_cast<int>(mesh.indices.size());
+
+    for (const PackedVertex& vertex : mesh.vertices) {
+
+        range.bounding_radius = std::max(range.bounding_radius,
+                                         std::hypot(DequantizePosition(vertex.x),
+                                                    DequantizePosition(vertex.y)));
+    }
+
+    vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+    indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+    ranges.push_back(range);
+
+    return static_cast<MeshId>(ranges.size() - 1);
+}
+
+void MeshRegistry::Upload(RenderDevice& target) {
+
+    device = &target;
+
+    const std::size_t vertex_bytes = VertexCount() * sizeof(PackedVertex);
+    const std::size_t index_bytes = IndexCount() * sizeof(std::uint16_t);
+
+    if (vertex_array == 0) {
+
+        // a pack alone goes straight from its mapped pages to the device
+        const bool pack_only = pack && vertices.empty();
+        const bool single_source = pack_only || !pack;
+
+        const void* vertex_data = pack_only ? static_cast<const void*>(pack->Vertices()) : vertices.data();
+        const void* index_data = pack_only ? static_cast<const void*>(pack->Indices()) : indices.data();
+
+        vertex_buffer = device->CreateBuffer(BufferTarget::Vertex, vertex_bytes,
+                                             single_source ? vertex_data : nullptr, BufferUsage::Static);
+        index_buffer = device->CreateBuffer(BufferTarget::Index, index_bytes,
+                                            single_source ? index_data : nullptr, BufferUsage::Static);
+
+        if (!single_source) {
+
+            UploadSections();
+        }
+
+        vertex_array = device->CreateVertexArray(index_buffer);
+
+        VertexAttribute position;
+        position.location = 0;
+        position.buffer = vertex_buffer;
+        position.components = 2;
+        position.format = AttributeFormat::Short;
+        position.normalized = true;
+        position.stride = sizeof(PackedVertex);
+
+        device->SetVertexAttribute(vertex_array, position);
+        return;
+    }
+
+    // meshes registered after the first upload
+    device->ReallocateBuffer(vertex_buffer, vertex_bytes);
+    device->ReallocateBuffer(index_buffer, index_bytes);
+
+    UploadSections();
+}
+
+void MeshRegistry::UploadSections() {
+
+    const std::size_t pack_vertex_bytes = pack_vertex_count * sizeof(PackedVertex);
+    const std::size_t pack_index_bytes = pack_index_count * sizeof(std::uint16_t);
+
+    if (pack) {
+
+        device->UploadBuffer(vertex_buffer, 0, pack_vertex_bytes, pack->Vertices());
+        device->UploadBuffer(index_buffer, 0, pack_index_bytes, pack->Indices());
+    }
+
+    if (!vertices.empty()) {
+
+        device->UploadBuffer(vertex_buffer, pack_vertex_bytes, vertices.size() * sizeof(PackedVertex),
+                             vertices.data());
+        device->UploadBuffer(index_buffer, pack_index_bytes, indices.size() * sizeof(std::uint16_t),
+                             indices.data());
+    }
+}
+
+void MeshRegistry::Destroy() {
+
+    if (!device) {
+
+        return;
+    }
+
+    device->DestroyVertexArray(vertex_array);
+    device->DestroyBuffer(index_buffer);
+    device->DestroyBuffer(vertex_buffer);
+
+    vertex_array = 0;
+    index_buffer = 0;
+    vertex_buffer = 0;
+    device = nullptr;
+}
+
+void MeshRegistry::Bind() const {
+
+    device->BindVertexArray(vertex_array);
+}
+
+void MeshRegistry::Draw(MeshId mesh) const {
+
+    DrawInstanced(mesh, 1);
+}
+
+void MeshRegistry::DrawInstanced(MeshId mesh, int instance_count) const {
+
+    const MeshRange& range = ranges[mesh];
+
+    DrawCall draw;
+    draw.primitive = PrimitiveType::LineStrip;
+    draw.index_count = range.index_count;
+    draw.first_index = range.first_index;
+    draw.base_vertex = range.first_vertex;
+    draw.instance_count = instance_count;
+
+    device->Draw(draw);
+}
+
+} // namespace Core
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshRegistry.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "IndexedMesh.hpp"
+#include "RenderDevice.hpp"
+
+namespace Core {
+
+using MeshId = std::uint32_t;
+
+class MeshPack;
+
+struct MeshRange {
+
+    int first_vertex = 0;   // base vertex added to every index
+    int first_index = 0;
+    int index_count = 0;
+
+    float bounding_radius = 0.0f;   // farthest vertex from the model origin
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Mesh Registry
+// --Packs every registered static mesh into one shared vertex buffer and one
+//   shared index buffer (PackedVertex, uint16 line strip indices).
+// --A single vertex array is configured once on Upload(); draws only select
+//   a range. The registry keeps the device it was uploaded to.
+// --Primitive restart must be enabled with PRIMITIVE_RESTART_INDEX.
+// --A MeshPack can be loaded first: its meshes become MeshIds 0..n-1 and
+//   its mapped sections are uploaded as they are, without copies. Meshes
+//   registered afterwards are packed behind them.
+////////////////////////////////////////////////////////////////////////////////
+class MeshRegistry {
+
+public:
+    // only into an empty registry; the pack must stay open while in use
+    bool Load(const MeshPack& pack);
+
+    MeshId Register(const IndexedMesh& mesh);
+
+    const MeshRange& Range(MeshId mesh) const { return ranges[mesh]; }
+    std::size_t MeshCount() const { return ranges.size(); }
+    std::size_t VertexCount() const { return pack_vertex_count + vertices.size(); }
+    std::size_t IndexCount() const { return pack_index_count + indices.size(); }
+
+    // registered meshes only, a loaded pack's data stays in the pack
+    const std::vector<PackedVertex>& PackedVertices() const { return vertices; }
+    const std::vector<std::uint16_t>& PackedIndices() const { return indices; }
+
+    void Upload(RenderDevice& device);
+    void Destroy();
+    void Bind() const;
+
+    void Draw(MeshId mesh) const;
+    void DrawInstanced(MeshId mesh, int instance_count) const;
+
+    VertexArrayId VertexArray() const { return vertex_array; }
+    BufferId VertexBuffer() const { return vertex_buffer; }
+    BufferId IndexBuffer() const { return index_buffer; }
+
+private:
+    void UploadSections();
+
+    const MeshPack* pack = nullptr;
+    std::size_t pack_vertex_count = 0;
+    std::size_t pack_index_count = 0;
+
+    std::vector<PackedVertex> vertices;
+    std::vector<std::uint16_t> indices;
+    std::vector<MeshRange> ranges;
+
+    RenderDevice* device = nullptr;
+
+    VertexArrayId vertex_array{};
+    BufferId vertex_buffer{};
+    BufferId index_buffer{};
+};
+
+} // namespace Core
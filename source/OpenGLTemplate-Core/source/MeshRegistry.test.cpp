@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshRegistry.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshRegistry.hpp"
+#include "UnitTest.hpp"
+
+#include <array>
+
+using namespace Core;
+
+static const std::array<float, 6> line {
+    -1.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f,
+};
+
+static const std::array<float, 24> square {
+    0.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f,
+    1.0f, 0.0f, 0.0f,   1.0f, 1.0f, 0.0f,
+    1.0f, 1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f,   0.0f, 0.0f, 0.0f,
+};
+
+TEST_CASE(MeshesArePackedBackToBack) {
+
+    MeshRegistry registry;
+
+    MeshId line_mesh = registry.Register(BuildIndexedMesh(line.data(), line.size()));
+    MeshId square_mesh = registry.Register(BuildIndexedMesh(square.data(), square.size()));
+
+    CHECK(line_mesh != square_mesh);
+    CHECK(registry.MeshCount() == 2);
+    CHECK(registry.VertexCount() == 6);
+    CHECK(registry.IndexCount() == 7);
+
+    CHECK(registry.Range(line_mesh).first_vertex == 0);
+    CHECK(registry.Range(line_mesh).first_index == 0);
+    CHECK(registry.Range(line_mesh).index_count == 2);
+
+    CHECK(registry.Range(square_mesh).first_vertex == 2);
+    CHECK(registry.Range(square_mesh).first_index == 2);
+    CHECK(registry.Range(square_mesh).index_count == 5);
+}
+
+TEST_CASE(BoundingRadiusCoversEveryVertex) {
+
+    MeshRegistry registry;
+
+    MeshId line_mesh = registry.Register(BuildIndexedMesh(line.data(), line.size()));
+    MeshId square_mesh = registry.Register(BuildIndexedMesh(square.data(), square.size()));
+
+    CHECK_NEAR(registry.Range(line_mesh).bounding_radius, 1.0f, 1e-3f);
+    CHECK_NEAR(registry.Range(square_mesh).bounding_radius, 1.41421356f, 1e-3f);
+}
+
+TEST_CASE(IndicesStayLocalToTheirMesh) {
+
+    MeshRegistry registry;
+
+    registry.Register(BuildIndexedMesh(line.data(), line.size()));
+    MeshId mesh = registry.Register(BuildIndexedMesh(square.data(), square.size()));
+
+    const MeshRange& range = registry.Range(mesh);
+    const auto& indices = registry.PackedIndices();
+    const auto& vertices = registry.PackedVertices();
+
+    // base vertex is applied at draw time, so local indices start at zero
+    CHECK(indices[range.first_index] == 0);
+
+    const PackedVertex& first = vertices[range.first_vertex + indices[range.first_index]];
+    CHECK(first.x == QuantizePosition(0.0f));
+    CHECK(first.y == QuantizePosition(0.0f));
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,391 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshSource.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshSource.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+
+#include "ShapeGenerator.hpp"
+
+namespace Core {
+
+static void AddSegment(std::vector<float>& line_vertices, float x0, float y0, float x1, float y1) {
+
+    line_vertices.insert(line_vertices.end(), {x0, y0, 0.0f, x1, y1, 0.0f});
+}
+
+static void SkipSeparators(const char*& cursor) {
+
+    while (std::isspace(static_cast<unsigned char>(*cursor)) || *cursor == ',') {
+
+        ++cursor;
+    }
+}
+
+// only plain decimals, so strtof never sees "inf", "nan" or hex
+static bool StartsNumber(const char* cursor) {
+
+    return std::isdigit(static_cast<unsigned char>(*cursor)) || *cursor == '-' || *cursor == '+' ||
+           *cursor == '.';
+}
+
+static bool ReadNumbers(const char*& cursor, float* values, int count) {
+
+    for (int i = 0; i < count; ++i) {
+
+        SkipSeparators(cursor);
+
+        if (!StartsNumber(cursor)) {
+
+            return false;
+        }
+
+        char* end = nullptr;
+        values[i] = std::strtof(cursor, &end);
+
+        if (end == cursor) {
+
+            return false;
+        }
+
+        cursor = end;
+    }
+
+    return true;
+}
+
+bool ParsePathData(const char* data, std::vector<float>& line_vertices, std::string& error) {
+
+    const char* cursor = data;
+
+    char command = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+    float start_x = 0.0f;
+    float start_y = 0.0f;
+    bool started = false;
+
+    while (true) {
+
+        SkipSeparators(cursor);
+
+        if (*cursor == 0) {
+
+            return true;
+        }
+
+        if (std::isalpha(static_cast<unsigned char>(*cursor))) {
+
+            command = *cursor++;
+        }
+        else if (command == 0) {
+
+            error = "path must start with M";
+            return false;
+        }
+        // implicit repeat, a moveto continues as lineto
+        else if (command == 'M' || command == 'm') {
+
+            command = command == 'M' ? 'L' : 'l';
+        }
+        else if (command == 'Z' || command == 'z') {
+
+            error = "number after Z";
+            return false;
+        }
+
+        if (!started && command != 'M' && command != 'm') {
+
+            error = "path must start with M";
+            return false;
+        }
+
+        const bool relative = std::islower(static_cast<unsigned char>(command));
+        const float origin_x = relative ? x : 0.0f;
+        const float origin_y = relative ? y : 0.0f;
+
+        float values[6];
+
+        switch (std::toupper(static_cast<unsigned char>(command))) {
+
+            case('M'):
+                if (!ReadNumbers(cursor, values, 2)) {
+
+                    error = "M needs x y";
+                    return false;
+                }
+
+                x = start_x = origin_x + values[0];
+                y = start_y = origin_y + values[1];
+                started = true;
+                break;
+            case('L'):
+                if (!ReadNumbers(cursor, values, 2)) {
+
+                    error = "L needs x y";
+                    return false;
+                }
+
+                AddSegment(line_vertices, x, y, origin_x + values[0], origin_y + values[1]);
+                x = origin_x + values[0];
+                y = origin_y + values[1];
+                break;
+            case('H'):
+                if (!ReadNumbers(cursor, values, 1)) {
+
+                    error = "H needs x";
+                    return false;
+                }
+
+                AddSegment(line_vertices, x, y, origin_x + values[0], y);
+                x = origin_x + values[0];
+                break;
+            case('V'):
+                if (!ReadNumbers(cursor, values, 1)) {
+
+                    error = "V needs y";
+                    return false;
+                }
+
+                AddSegment(line_vertices, x, y, x, origin_y + values[0]);
+                y = origin_y + values[0];
+                break;
+            case('Z'):
+                if (x != start_x || y != start_y) {
+
+                    AddSegment(line_vertices, x, y, start_x, start_y);
+                }
+
+                x = start_x;
+                y = start_y;
+                break;
+            case('C'):
+            case('Q'): {
+
+                const bool cubic = std::toupper(static_cast<unsigned char>(command)) == 'C';
+                const int count = cubic ? 6 : 4;
+
+                if (!ReadNumbers(cursor, values, count)) {
+
+                    error = cubic ? "C needs x1 y1 x2 y2 x y" : "Q needs x1 y1 x y";
+                    return false;
+                }
+
+                for (int i = 0; i < count; i += 2) {
+
+                    values[i] += origin_x;
+                    values[i + 1] += origin_y;
+                }
+
+                const float end_x = values[count - 2];
+                const float end_y = values[count - 1];
+
+                float previous_x = x;
+                float previous_y = y;
+
+                for (int i = 1; i <= PATH_CURVE_SEGMENTS; ++i) {
+
+                    const float t = static_cast<float>(i) / PATH_CURVE_SEGMENTS;
+                    const float s = 1.0f - t;
+
+                    float next_x = end_x;
+                    float next_y = end_y;
+
+                    // the last point is the exact end point, so Z and joins match
+                    if (i < PATH_CURVE_SEGMENTS && cubic) {
+
+                        next_x = s * s * s * x + 3.0f * s * s * t * values[0] + 3.0f * s * t * t * values[2] +
+                                 t * t * t * end_x;
+                        next_y = s * s * s * y + 3.0f * s * s * t * values[1] + 3.0f * s * t * t * values[3] +
+                                 t * t * t * end_y;
+                    }
+                    else if (i < PATH_CURVE_SEGMENTS) {
+
+                        next_x = s * s * x + 2.0f * s * t * values[0] + t * t * end_x;
+                        next_y = s * s * y + 2.0f * s * t * values[1] + t * t * end_y;
+                    }
+
+                    AddSegment(line_vertices, previous_x, previous_y, next_x, next_y);
+
+                    previous_x = next_x;
+                    previous_y = next_y;
+                }
+
+                x = end_x;
+                y = end_y;
+                break;
+            }
+            default:
+                error = std::string("unsupported path command ") + command;
+                return false;
+        }
+    }
+}
+
+// the same vertices as Shape::RegularPolygon<sides>(radius, start_angle)
+static void AddRegularPolygon(std::vector<float>& line_vertices, int sides, float radius, float start_angle) {
+
+    const float sweep = static_cast<float>(2.0 * SHAPE_PI);
+
+    const float first_x = static_cast<float>(radius * ConstexprCos(start_angle));
+    const float first_y = static_cast<float>(radius * ConstexprSin(start_angle));
+
+    float x0 = first_x;
+    float y0 = first_y;
+
+    for (int i = 1; i <= sides; ++i) {
+
+        const double angle = start_angle + static_cast<double>(sweep) * i / sides;
+
+        float x1 = static_cast<float>(radius * ConstexprCos(angle));
+        float y1 = static_cast<float>(radius * ConstexprSin(angle));
+
+        if (i == sides) {
+
+            x1 = first_x;
+            y1 = first_y;
+        }
+
+        AddSegment(line_vertices, x0, y0, x1, y1);
+
+        x0 = x1;
+        y0 = y1;
+    }
+}
+
+bool ParseMeshSource(const std::string& text, std::vector<MeshSource>& meshes, std::string& error) {
+
+    std::istringstream lines(text);
+    std::string line;
+    int line_number = 0;
+
+    const std::size_t first_mesh = meshes.size();
+    int mesh_line = 0;
+
+    auto fail = [&](int number, const std::string& message) {
+
+        error = "line " + std::to_string(number) + ": " + message;
+        return false;
+    };
+
+    auto finish_mesh = [&]() {
+
+        return meshes.size() == first_mesh || !meshes.back().line_vertices.empty();
+    };
+
+    while (std::getline(lines, line)) {
+
+        line_number += 1;
+
+        const std::size_t comment = line.find('#');
+
+        if (comment != std::string::npos) {
+
+            line.erase(comment);
+        }
+
+        std::istringstream words(line);
+        std::string directive;
+
+        if (!(words >> directive)) {
+
+            continue;
+        }
+
+        if (directive == "mesh") {
+
+            std::string name;
+            std::string extra;
+
+            if (!(words >> name) || (words >> extra)) {
+
+                return fail(line_number, "mesh needs exactly one name");
+            }
+
+            if (!finish_mesh()) {
+
+                return fail(mesh_line, "mesh " + meshes.back().name + " has no geometry");
+            }
+
+            for (std::size_t mesh = first_mesh; mesh < meshes.size(); ++mesh) {
+
+                if (meshes[mesh].name == name) {
+
+                    return fail(line_number, "mesh " + name + " is already defined");
+                }
+            }
+
+            meshes.push_back(MeshSource{name, {}});
+            mesh_line = line_number;
+            continue;
+        }
+
+        if (meshes.size() == first_mesh) {
+
+            return fail(line_number, directive + " before the first mesh");
+        }
+
+        std::vector<float>& line_vertices = meshes.back().line_vertices;
+
+        if (directive == "path") {
+
+            std::string path_error;
+            const std::streamoff data_start = words.tellg();
+            const char* data = line.c_str() + (data_start < 0 ? line.size() : static_cast<std::size_t>(data_start));
+
+            if (!ParsePathData(data, line_vertices, path_error)) {
+
+                return fail(line_number, path_error);
+            }
+        }
+        else if (directive == "polygon") {
+
+            int sides = 0;
+            float radius = 0.0f;
+            float start_degrees = 0.0f;
+            std::string extra;
+
+            if (!(words >> sides >> radius)) {
+
+                return fail(line_number, "polygon needs SIDES RADIUS [START_DEGREES]");
+            }
+
+            if (!(words >> start_degrees) && !words.eof()) {
+
+                return fail(line_number, "polygon START_DEGREES must be a number");
+            }
+
+            if (words >> extra) {
+
+                return fail(line_number, "polygon has extra values");
+            }
+
+            if (sides < 3 || radius <= 0.0f) {
+
+                return fail(line_number, "polygon needs at least 3 sides and a positive radius");
+            }
+
+            AddRegularPolygon(line_vertices, sides, radius, static_cast<float>(start_degrees * SHAPE_PI / 180.0));
+        }
+        else {
+
+            return fail(line_number, "unknown directive " + directive);
+        }
+    }
+
+    if (!finish_mesh()) {
+
+        return fail(mesh_line, "mesh " + meshes.back().name + " has no geometry");
+    }
+
+    return true;
+}
+
+} // namespace Core
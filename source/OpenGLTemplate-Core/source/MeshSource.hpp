@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshSource.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define PATH_CURVE_SEGMENTS     16      // line segments per flattened curve
+
+namespace Core {
+
+// one named mesh in the GL_LINES authoring format of Models.hpp
+struct MeshSource {
+
+    std::string name;
+    std::vector<float> line_vertices;   // vertex pairs, 3 floats per vertex
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Mesh Source
+// --Text format read by the asset compiler, one directive per line:
+//     mesh NAME                              starts a mesh
+//     path DATA                              SVG path data, see below
+//     polygon SIDES RADIUS [START_DEGREES]   as Shape::RegularPolygon
+//   '#' starts a comment. A mesh can have any number of path and polygon
+//   lines; they are appended to it.
+// --Path data is the SVG subset M L H V Z C Q (lower case relative) with
+//   implicit repeats, in model units with y up. Curves are flattened into
+//   PATH_CURVE_SEGMENTS segments.
+// --Errors return false with a message; ParseMeshSource() prefixes it with
+//   "line N: ".
+////////////////////////////////////////////////////////////////////////////////
+bool ParsePathData(const char* data, std::vector<float>& line_vertices, std::string& error);
+bool ParseMeshSource(const std::string& text, std::vector<MeshSource>& meshes, std::string& error);
+
+} // namespace Core
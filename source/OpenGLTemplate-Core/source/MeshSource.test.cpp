@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: MeshSource.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "MeshSource.hpp"
+#include "Models.hpp"
+#include "UnitTest.hpp"
+
+using namespace Core;
+
+static std::vector<float> ParsePath(const char* data) {
+
+    std::vector<float> line_vertices;
+    std::string error;
+
+    CHECK(ParsePathData(data, line_vertices, error));
+
+    return line_vertices;
+}
+
+TEST_CASE(LinePathsBecomeSegments) {
+
+    // absolute and relative, separators and implicit repeats
+    const std::vector<float> absolute = ParsePath("M 0 0 L 10 0 10,10 H 0 Z");
+    const std::vector<float> relative = ParsePath("m0 0l10 0 0 10h-10z");
+
+    const std::vector<float> expected {
+         0.0f,  0.0f, 0.0f,  10.0f,  0.0f, 0.0f,
+        10.0f,  0.0f, 0.0f,  10.0f, 10.0f, 0.0f,
+        10.0f, 10.0f, 0.0f,   0.0f, 10.0f, 0.0f,
+         0.0f, 10.0f, 0.0f,   0.0f,  0.0f, 0.0f,
+    };
+
+    CHECK(absolute == expected);
+    CHECK(relative == expected);
+
+    // a moveto with extra pairs continues as lineto, V moves vertically
+    CHECK(ParsePath("M 1 2 3 4 V 8") == std::vector<float>({1.0f, 2.0f, 0.0f, 3.0f, 4.0f, 0.0f,
+                                                            3.0f, 4.0f, 0.0f, 3.0f, 8.0f, 0.0f}));
+}
+
+TEST_CASE(CurvesAreFlattenedOntoTheirEndPoints) {
+
+    const std::vector<float> quadratic = ParsePath("M 0 0 Q 50 100 100 0");
+    const std::vector<float> cubic = ParsePath("M 0 0 c 0 100 100 100 100 0");
+
+    CHECK(quadratic.size() == PATH_CURVE_SEGMENTS * 6);
+    CHECK(cubic.size() == PATH_CURVE_SEGMENTS * 6);
+
+    // exact end point, and the midpoint of a symmetric curve on its peak
+    CHECK(quadratic[quadratic.size() - 3] == 100.0f);
+    CHECK(quadratic[quadratic.size() - 2] == 0.0f);
+    CHECK_NEAR(quadratic[(PATH_CURVE_SEGMENTS / 2) * 6 - 3], 50.0f, 1e-4f);
+    CHECK_NEAR(quadratic[(PATH_CURVE_SEGMENTS / 2) * 6 - 2], 50.0f, 1e-4f);
+    CHECK_NEAR(cubic[(PATH_CURVE_SEGMENTS / 2) * 6 - 2], 75.0f, 1e-4f);
+
+    // segments join end to start
+    for (std::size_t i = 6; i < cubic.size(); i += 6) {
+
+        CHECK(cubic[i] == cubic[i - 3]);
+        CHECK(cubic[i + 1] == cubic[i - 2]);
+    }
+}
+
+TEST_CASE(BadPathsAreRejected) {
+
+    std::vector<float> line_vertices;
+    std::string error;
+
+    CHECK(!ParsePathData("L 1 1", line_vertices, error));
+    CHECK(error == "path must start with M");
+    CHECK(!ParsePathData("M 0 0 L 1", line_vertices, error));
+    CHECK(error == "L needs x y");
+    CHECK(!ParsePathData("M 0 0 A 1 1 0 0 0 2 2", line_vertices, error));
+    CHECK(error == "unsupported path command A");
+    CHECK(!ParsePathData("M 0 0 L inf 0", line_vertices, error));
+}
+
+TEST_CASE(PolygonsMatchTheCompileTimeShapes) {
+
+    const std::string text =
+        "# startup shapes\n"
+        "mesh triangle\n"
+        "polygon 3 50 90\n"
+        "\n"
+        "mesh circle   # 32 sides\n"
+        "polygon 32 50\n";
+
+    std::vector<MeshSource> meshes;
+    std::string error;
+
+    CHECK(ParseMeshSource(text, meshes, error));
+    CHECK(meshes.size() == 2);
+    CHECK(meshes[0].name == "triangle");
+    CHECK(meshes[0].line_vertices == std::vector<float>(triangle_vertices.begin(), triangle_vertices.end()));
+    CHECK(meshes[1].line_vertices == std::vector<float>(circle_vertices.begin(), circle_vertices.end()));
+}
+
+TEST_CASE(SourceErrorsNameTheLine) {
+
+    std::vector<MeshSource> meshes;
+    std::string error;
+
+    CHECK(!ParseMeshSource("path M 0 0 L 1 1\n", meshes, error));
+    CHECK(error == "line 1: path before the first mesh");
+
+    meshes.clear();
+    CHECK(!ParseMeshSource("mesh a\npath M 0 0 L 1 1\nmesh b\npath M 0 0 Q 1\n", meshes, error));
+    CHECK(error == "line 4: Q needs x1 y1 x y");
+
+    meshes.clear();
+    CHECK(!ParseMeshSource("mesh a\n\nmesh b\npolygon 4 1\n", meshes, error));
+    CHECK(error == "line 1: mesh a has no geometry");
+
+    meshes.clear();
+    CHECK(!ParseMeshSource("mesh a\npolygon 2 10\n", meshes, error));
+    CHECK(error == "line 2: polygon needs at least 3 sides and a positive radius");
+
+    meshes.clear();
+    CHECK(!ParseMeshSource("mesh a\npolygon 3 10\nmesh a\n", meshes, error));
+    CHECK(error == "line 3: mesh a is already defined");
+
+    meshes.clear();
+    CHECK(!ParseMeshSource("mesh a\nsphere 10\n", meshes, error));
+    CHECK(error == "line 2: unknown directive sphere");
+}
+
+int main() { return Core::Test::RunAll(); }
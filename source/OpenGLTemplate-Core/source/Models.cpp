@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Models.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "Models.hpp"
+
+#include <cmath>
+
+namespace Core {
+
+static constexpr float PI = 3.14159265358979323846f;
+
+IndexedMesh BuildCircleMesh(int segment_count) {
+
+    IndexedMesh mesh;
+    mesh.vertices.reserve(segment_count);
+    mesh.indices.reserve(segment_count + 1);
+
+    for (int i = 0; i < segment_count; ++i) {
+
+        const float angle = 2.0f * PI * i / segment_count;
+
+        mesh.vertices.push_back(PackedVertex{QuantizePosition(MODEL_LENGTH/2.0f * std::cos(angle)),
+                                             QuantizePosition(MODEL_LENGTH/2.0f * std::sin(angle))});
+        mesh.indices.push_back(static_cast<std::uint16_t>(i));
+    }
+
+    mesh.indices.push_back(0);
+    return mesh;
+}
+
+} // namespace Core
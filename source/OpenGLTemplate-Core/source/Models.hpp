@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Models.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+
+#include "IndexedMesh.hpp"
+#include "ShapeGenerator.hpp"
+
+#define MODEL_LENGTH        100   // pixels
+#define CIRCLE_SEGMENTS     32    // segments of the startup circle, see MeshLod for others
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Models Source Code (Coordinate Axis, Square, Triangle, Hexagon, Circle)
+// --GL_LINES vertex pairs with 3 floats (x, y, z) per vertex. These are the
+//   authoring format; meshes are converted with BuildIndexedMesh() for upload.
+// --Everything is built at compile time (see ShapeGenerator.hpp), so the
+//   tables are constant data with no static initialization.
+////////////////////////////////////////////////////////////////////////////////
+inline constexpr std::array<float, 6> x_axis_vertices {
+
+    -MODEL_LENGTH*10.0f,  0.0f,  0.0f, // left point
+     MODEL_LENGTH*10.0f,  0.0f,  0.0f, // right point
+};
+
+inline constexpr std::array<float, 6> y_axis_vertices {
+
+     0.0f,  MODEL_LENGTH*7.0f,  0.0f, // top point
+     0.0f, -MODEL_LENGTH*7.0f,  0.0f, // bottom point
+};
+
+inline constexpr LineList<4> square_vertices = Shape::RoundedRectangle<0>(MODEL_LENGTH, MODEL_LENGTH, 0.0f);
+
+// pointing up, with corners on the circle of MODEL_LENGTH diameter
+inline constexpr LineList<3> triangle_vertices =
+    Shape::RegularPolygon<3>(MODEL_LENGTH/2.0f, static_cast<float>(SHAPE_PI / 2.0));
+
+inline constexpr LineList<6> hexagon_vertices = Shape::RegularPolygon<6>(MODEL_LENGTH/2.0f);
+
+inline constexpr LineList<CIRCLE_SEGMENTS> circle_vertices =
+    Shape::RegularPolygon<CIRCLE_SEGMENTS>(MODEL_LENGTH/2.0f);
+
+static_assert(Shape::IsClosed(square_vertices) && Shape::IsClosed(triangle_vertices) &&
+              Shape::IsClosed(hexagon_vertices) && Shape::IsClosed(circle_vertices),
+              "closed models must end on their first vertex");
+
+// closed line strip of segment_count segments on the circle model's radius,
+// the CurveGenerator used for circle levels of detail (see MeshLod)
+IndexedMesh BuildCircleMesh(int segment_count);
+
+} // namespace Core
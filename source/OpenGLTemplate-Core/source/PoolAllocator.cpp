@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: PoolAllocator.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "PoolAllocator.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace Core {
+
+PoolAllocator::PoolAllocator(std::size_t size, std::size_t count, std::size_t alignment)
+    : block_count(count) {
+
+    alignment = std::max(alignment, alignof(FreeBlock));
+
+    // every block starts aligned, so round the size up to the alignment
+    block_size = std::max(size, sizeof(FreeBlock));
+    block_size = (block_size + alignment - 1) / alignment * alignment;
+
+    if (block_count == 0) {
+
+        return;
+    }
+
+    buffer.reset(new std::uint8_t[block_size * block_count + alignment - 1]);
+
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer.get());
+    const std::uintptr_t first = (base + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+
+    blocks = buffer.get() + (first - base);
+
+    // threaded back to front, so the first Allocate() returns the first block
+    for (std::size_t i = block_count; i-- > 0;) {
+
+        free_list = new (blocks + i * block_size) FreeBlock{free_list};
+    }
+}
+
+void* PoolAllocator::Allocate() {
+
+    if (!free_list) {
+
+        return nullptr;
+    }
+
+    FreeBlock* block = free_list;
+    free_list = block->next;
+
+    in_use += 1;
+    high_water = std::max(high_water, in_use);
+
+    return block;
+}
+
+void PoolAllocator::Free(void* block) {
+
+    if (!block || !Owns(block)) {
+
+        return;
+    }
+
+    free_list = new (block) FreeBlock{free_list};
+
+    in_use -= 1;
+}
+
+bool PoolAllocator::Owns(const void* block) const {
+
+    const std::uint8_t* pointer = static_cast<const std::uint8_t*>(block);
+
+    if (!blocks || pointer < blocks || pointer >= blocks + block_size * block_count) {
+
+        return false;
+    }
+
+    return static_cast<std::size_t>(pointer - blocks) % block_size == 0;
+}
+
+} // namespace Core
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: PoolAllocator.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Pool Allocator
+// --Fixed-size blocks carved out of one buffer allocated up front. Free
+//   blocks are kept in an intrusive list threaded through the blocks
+//   themselves, so Allocate() and Free() are a pop and a push.
+// --The most recently freed block is handed out first, while it is still
+//   in cache.
+// --Never grows: Allocate() returns nullptr once every block is in use.
+//   Free() ignores pointers the pool does not own; free each block once.
+////////////////////////////////////////////////////////////////////////////////
+class PoolAllocator {
+
+public:
+    // blocks are at least pointer sized and aligned to alignment (a power of two)
+    PoolAllocator(std::size_t block_size, std::size_t block_count,
+                  std::size_t alignment = alignof(std::max_align_t));
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    void* Allocate();
+    void Free(void* block);
+
+    // true if block is the start of one of this pool's blocks
+    bool Owns(const void* block) const;
+
+    std::size_t BlockSize() const { return block_size; }
+    std::size_t Capacity() const { return block_count; }
+    std::size_t InUse() const { return in_use; }
+    std::size_t HighWater() const { return high_water; }
+
+private:
+    struct FreeBlock {
+
+        FreeBlock* next;
+    };
+
+    std::size_t block_size = 0;
+    std::size_t block_count = 0;
+
+    std::unique_ptr<std::uint8_t[]> buffer;
+    std::uint8_t* blocks = nullptr;         // first block, aligned within buffer
+
+    FreeBlock* free_list = nullptr;
+    std::size_t in_use = 0;
+    std::size_t high_water = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Object Pool
+// --Typed front end of PoolAllocator for fixed-size records: Create()
+//   constructs a T in a free block, Destroy() runs its destructor and
+//   returns the block.
+////////////////////////////////////////////////////////////////////////////////
+template<typename T>
+class ObjectPool {
+
+public:
+    explicit ObjectPool(std::size_t capacity) : pool(sizeof(T), capacity, alignof(T)) {}
+
+    // nullptr once the pool is full
+    template<typename... Args>
+    T* Create(Args&&... args) {
+
+        void* block = pool.Allocate();
+        return block ? new (block) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    void Destroy(T* object) {
+
+        if (object && pool.Owns(object)) {
+
+            object->~T();
+            pool.Free(object);
+        }
+    }
+
+    std::size_t Capacity() const { return pool.Capacity(); }
+    std::size_t InUse() const { return pool.InUse(); }
+
+private:
+    PoolAllocator pool;
+};
+
+} // namespace Core
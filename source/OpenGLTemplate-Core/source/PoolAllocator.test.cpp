@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: PoolAllocator.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "PoolAllocator.hpp"
+#include "UnitTest.hpp"
+
+#include <vector>
+
+using namespace Core;
+
+struct alignas(32) Record {
+
+    Record(int record_id, int* destroyed) : id(record_id), destroyed_count(destroyed) {}
+    ~Record() { *destroyed_count += 1; }
+
+    int id;
+    int* destroyed_count;
+    float payload[5];
+};
+
+TEST_CASE(BlocksAreAlignedAndDistinct) {
+
+    PoolAllocator pool(24, 8, 16);
+
+    CHECK(pool.BlockSize() == 32);
+
+    std::vector<void*> blocks;
+
+    for (int i = 0; i < 8; ++i) {
+
+        void* block = pool.Allocate();
+
+        CHECK(block != nullptr);
+        CHECK(reinterpret_cast<std::uintptr_t>(block) % 16 == 0);
+        CHECK(pool.Owns(block));
+
+        blocks.push_back(block);
+    }
+
+    for (std::size_t i = 1; i < blocks.size(); ++i) {
+
+        CHECK(blocks[i] != blocks[i - 1]);
+    }
+
+    // tiny blocks still hold the free list link
+    PoolAllocator bytes(1, 4, 1);
+    CHECK(bytes.BlockSize() >= sizeof(void*));
+}
+
+TEST_CASE(ExhaustedPoolReturnsNullUntilABlockIsFreed) {
+
+    PoolAllocator pool(16, 2);
+
+    void* first = pool.Allocate();
+    void* second = pool.Allocate();
+
+    CHECK(pool.Allocate() == nullptr);
+    CHECK(pool.InUse() == 2);
+
+    pool.Free(first);
+
+    // the block freed last comes back first
+    CHECK(pool.Allocate() == first);
+    CHECK(pool.Allocate() == nullptr);
+
+    pool.Free(second);
+    pool.Free(first);
+
+    CHECK(pool.InUse() == 0);
+    CHECK(pool.HighWater() == 2);
+}
+
+TEST_CASE(ForeignPointersAreIgnored) {
+
+    PoolAllocator pool(16, 4);
+    int outside = 0;
+
+    void* block = pool.Allocate();
+
+    CHECK(!pool.Owns(&outside));
+    CHECK(!pool.Owns(static_cast<char*>(block) + 1));
+
+    pool.Free(&outside);
+    pool.Free(static_cast<char*>(block) + 1);
+    pool.Free(nullptr);
+
+    CHECK(pool.InUse() == 1);
+}
+
+TEST_CASE(ObjectPoolConstructsAndDestroys) {
+
+    ObjectPool<Record> records(3);
+    int destroyed = 0;
+
+    Record* a = records.Create(1, &destroyed);
+    Record* b = records.Create(2, &destroyed);
+    Record* c = records.Create(3, &destroyed);
+
+    CHECK(a && b && c);
+    CHECK(records.Create(4, &destroyed) == nullptr);
+    CHECK(reinterpret_cast<std::uintptr_t>(b) % alignof(Record) == 0);
+    CHECK(b->id == 2);
+
+    records.Destroy(b);
+
+    CHECK(destroyed == 1);
+    CHECK(records.InUse() == 2);
+
+    Record* d = records.Create(5, &destroyed);
+
+    CHECK(d == b);
+    CHECK(d->id == 5);
+
+    records.Destroy(a);
+    records.Destroy(c);
+    records.Destroy(d);
+
+    CHECK(destroyed == 4);
+    CHECK(records.InUse() == 0);
+}
+
+int main() { return Core::Test::RunAll(); }
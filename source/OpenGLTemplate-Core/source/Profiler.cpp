@@ -0,0 +1,336 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Profiler.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+#define GPU_TRACE_THREAD    1000    // chrome trace tid for gpu timings
+
+namespace Core {
+
+static std::int64_t SteadyNanoseconds() {
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void WriteJsonString(std::ostream& out, const char* text) {
+
+    out << '"';
+
+    for (const char* c = text; *c; ++c) {
+
+        switch (*c) {
+
+            case('"'): out << "\\\""; break;
+            case('\\'): out << "\\\\"; break;
+            case('\n'): out << "\\n"; break;
+            case('\t'): out << "\\t"; break;
+            default: out << *c; break;
+        }
+    }
+
+    out << '"';
+}
+
+RollingPercentiles::RollingPercentiles(std::size_t capacity)
+    : samples(std::max<std::size_t>(capacity, 1)) {
+
+}
+
+void RollingPercentiles::Add(double value_ms) {
+
+    samples[next] = value_ms;
+    next = (next + 1) % samples.size();
+    count = std::min(count + 1, samples.size());
+}
+
+void RollingPercentiles::Clear() {
+
+    count = 0;
+    next = 0;
+}
+
+FrameTimeStats RollingPercentiles::Stats() const {
+
+    FrameTimeStats stats;
+    stats.samples = count;
+
+    if (count == 0) {
+
+        return stats;
+    }
+
+    // until the ring wraps the samples are the first count entries
+    std::vector<double> sorted(samples.begin(), samples.begin() + count);
+    std::sort(sorted.begin(), sorted.end());
+
+    // nearest rank
+    const auto percentile = [&](double p) {
+
+        const std::size_t rank = static_cast<std::size_t>(std::ceil(p * count));
+        return sorted[std::min(std::max<std::size_t>(rank, 1), count) - 1];
+    };
+
+    stats.p50_ms = percentile(0.50);
+    stats.p95_ms = percentile(0.95);
+    stats.p99_ms = percentile(0.99);
+    stats.max_ms = sorted.back();
+
+    return stats;
+}
+
+static std::atomic<std::uint64_t> next_profiler_id { 1 };
+
+Profiler::Profiler(std::size_t events_per_thread, std::size_t frame_history)
+    : id(next_profiler_id.fetch_add(1)),
+      events_per_thread(std::max<std::size_t>(events_per_thread, 1)),
+      start_ns(SteadyNanoseconds()),
+      cpu_frames(frame_history),
+      gpu_frames(frame_history) {
+
+}
+
+Profiler::~Profiler() = default;
+
+std::int64_t Profiler::NowNanoseconds() const {
+
+    return SteadyNanoseconds() - start_ns;
+}
+
+Profiler::ThreadBuffer& Profiler::CurrentThreadBuffer() {
+
+    // fast path: this thread already looked up its buffer in this profiler
+    static thread_local std::uint64_t cached_profiler = 0;
+    static thread_local ThreadBuffer* cached_buffer = nullptr;
+
+    if (cached_profiler == id) {
+
+        return *cached_buffer;
+    }
+
+    std::lock_guard<std::mutex> lock(threads_mutex);
+
+    const std::thread::id self = std::this_thread::get_id();
+
+    auto found = std::find_if(threads.begin(), threads.end(),
+                              [&](const std::unique_ptr<ThreadBuffer>& buffer) { return buffer->owner == self; });
+
+    if (found == threads.end()) {
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->owner = self;
+        buffer->thread_index = static_cast<std::uint32_t>(threads.size());
+        buffer->events.resize(events_per_thread);
+
+        threads.push_back(std::move(buffer));
+        found = threads.end() - 1;
+    }
+
+    cached_profiler = id;
+    cached_buffer = found->get();
+
+    return *cached_buffer;
+}
+
+void Profiler::BeginScope(const char* name) {
+
+    ThreadBuffer& buffer = CurrentThreadBuffer();
+
+    if (buffer.depth < PROFILER_MAX_DEPTH) {
+
+        buffer.open_names[buffer.depth] = name;
+        buffer.open_begin_ns[buffer.depth] = NowNanoseconds();
+    }
+
+    buffer.depth += 1;
+}
+
+void Profiler::EndScope() {
+
+    ThreadBuffer& buffer = CurrentThreadBuffer();
+
+    if (buffer.depth == 0) {
+
+        return;
+    }
+
+    buffer.depth -= 1;
+
+    // scopes nested past the limit are counted for depth but not recorded
+    if (buffer.depth >= PROFILER_MAX_DEPTH) {
+
+        return;
+    }
+
+    ProfileEvent& event = buffer.events[buffer.write_count % buffer.events.size()];
+    event.name = buffer.open_names[buffer.depth];
+    event.begin_ns = buffer.open_begin_ns[buffer.depth];
+    event.end_ns = NowNanoseconds();
+    event.depth = buffer.depth;
+
+    buffer.write_count += 1;
+}
+
+void Profiler::MarkFrame() {
+
+    const std::int64_t now = NowNanoseconds();
+
+    std::lock_guard<std::mutex> lock(frames_mutex);
+
+    if (last_frame_ns >= 0) {
+
+        cpu_frames.Add((now - last_frame_ns) * 1e-6);
+    }
+
+    last_frame_ns = now;
+}
+
+void Profiler::RecordGpuTime(const char* name, std::int64_t cpu_begin_ns, double gpu_ms) {
+
+    std::lock_guard<std::mutex> lock(frames_mutex);
+
+    gpu_frames.Add(gpu_ms);
+
+    if (gpu_events.size() < PROFILER_GPU_CAPACITY) {
+
+        gpu_events.push_back({name, cpu_begin_ns, gpu_ms});
+    }
+    else {
+
+        gpu_events[gpu_write_count % PROFILER_GPU_CAPACITY] = {name, cpu_begin_ns, gpu_ms};
+    }
+
+    gpu_write_count += 1;
+}
+
+FrameTimeStats Profiler::CpuFrameStats() const {
+
+    std::lock_guard<std::mutex> lock(frames_mutex);
+    return cpu_frames.Stats();
+}
+
+FrameTimeStats Profiler::GpuFrameStats() const {
+
+    std::lock_guard<std::mutex> lock(frames_mutex);
+    return gpu_frames.Stats();
+}
+
+std::size_t Profiler::ThreadCount() const {
+
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    return threads.size();
+}
+
+std::vector<ProfileEvent> Profiler::Events(std::size_t thread_index) const {
+
+    std::lock_guard<std::mutex> lock(threads_mutex);
+
+    std::vector<ProfileEvent> events;
+
+    if (thread_index >= threads.size()) {
+
+        return events;
+    }
+
+    const ThreadBuffer& buffer = *threads[thread_index];
+    const std::size_t capacity = buffer.events.size();
+    const std::uint64_t first = buffer.write_count > capacity ? buffer.write_count - capacity : 0;
+
+    events.reserve(static_cast<std::size_t>(buffer.write_count - first));
+
+    for (std::uint64_t i = first; i < buffer.write_count; ++i) {
+
+        events.push_back(buffer.events[i % capacity]);
+    }
+
+    return events;
+}
+
+void Profiler::WriteChromeTrace(std::ostream& out) const {
+
+    // chrome://tracing and Perfetto read "X" (complete) events in microseconds
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool first = true;
+
+    const auto separator = [&]() {
+
+        out << (first ? "" : ",\n");
+        first = false;
+    };
+
+    const std::size_t thread_count = ThreadCount();
+
+    for (std::size_t t = 0; t < thread_count; ++t) {
+
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+            << ",\"args\":{\"name\":\"Thread " << t << "\"}}";
+
+        for (const ProfileEvent& event : Events(t)) {
+
+            separator();
+            out << "{\"name\":";
+            WriteJsonString(out, event.name);
+            out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << t
+                << ",\"ts\":" << event.begin_ns / 1000.0
+                << ",\"dur\":" << (event.end_ns - event.begin_ns) / 1000.0 << "}";
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(frames_mutex);
+
+    if (!gpu_events.empty()) {
+
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << GPU_TRACE_THREAD
+            << ",\"args\":{\"name\":\"GPU\"}}";
+    }
+
+    // gpu durations are placed at the cpu time their query began
+    for (const GpuEvent& event : gpu_events) {
+
+        separator();
+        out << "{\"name\":";
+        WriteJsonString(out, event.name);
+        out << ",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << GPU_TRACE_THREAD
+            << ",\"ts\":" << event.begin_ns / 1000.0
+            << ",\"dur\":" << event.duration_ms * 1000.0 << "}";
+    }
+
+    out << "\n]}\n";
+}
+
+bool Profiler::ExportChromeTrace(const char* path) const {
+
+    std::ofstream file(path);
+
+    if (!file) {
+
+        return false;
+    }
+
+    WriteChromeTrace(file);
+    return static_cast<bool>(file);
+}
+
+Profiler& DefaultProfiler() {
+
+    static Profiler profiler;
+    return profiler;
+}
+
+} // namespace Core
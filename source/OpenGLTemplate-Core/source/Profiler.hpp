@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Profiler.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#define PROFILER_EVENT_CAPACITY     16384   // scope events kept per thread
+#define PROFILER_GPU_CAPACITY       1024    // gpu timings kept for export
+#define PROFILER_FRAME_HISTORY      240     // frames in the rolling percentile window
+#define PROFILER_MAX_DEPTH          32      // nested scopes per thread
+
+// set to 0 to compile PROFILE_SCOPE out entirely
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED            1
+#endif
+
+namespace Core {
+
+struct ProfileEvent {
+
+    const char* name;               // must outlive the profiler, normally a literal
+    std::int64_t begin_ns;
+    std::int64_t end_ns;
+    std::uint32_t depth;
+};
+
+struct FrameTimeStats {
+
+    std::size_t samples = 0;
+    double p50_ms = 0.0;
+    double p95_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Rolling Percentiles
+// --Keeps the last capacity samples; Stats() sorts a copy, so call it at
+//   report time rather than every frame.
+////////////////////////////////////////////////////////////////////////////////
+class RollingPercentiles {
+
+public:
+    explicit RollingPercentiles(std::size_t capacity = PROFILER_FRAME_HISTORY);
+
+    void Add(double value_ms);
+    void Clear();
+
+    std::size_t Size() const { return count; }
+    FrameTimeStats Stats() const;
+
+private:
+    std::vector<double> samples;
+    std::size_t count = 0;
+    std::size_t next = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Profiler
+// --CPU scopes (PROFILE_SCOPE) are recorded per thread into a fixed ring
+//   that only its own thread writes, so recording never takes a lock. A
+//   thread registers its ring on its first scope.
+// --MarkFrame() once per frame feeds the rolling frame-time percentiles.
+//   GPU durations arrive late from GpuTimer through RecordGpuTime().
+// --Events and ExportChromeTrace() read every thread's ring: call them
+//   between frames, when no other thread is inside a scope (e.g. after
+//   the job system's per-frame join).
+////////////////////////////////////////////////////////////////////////////////
+class Profiler {
+
+public:
+    explicit Profiler(std::size_t events_per_thread = PROFILER_EVENT_CAPACITY,
+                      std::size_t frame_history = PROFILER_FRAME_HISTORY);
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void BeginScope(const char* name);
+    void EndScope();
+
+    // registers the calling thread's ring now instead of on its first scope,
+    // where the allocation would land in the middle of a frame
+    void RegisterThread() { CurrentThreadBuffer(); }
+
+    // records the time since the previous mark as one frame
+    void MarkFrame();
+
+    void RecordGpuTime(const char* name, std::int64_t cpu_begin_ns, double gpu_ms);
+
+    FrameTimeStats CpuFrameStats() const;
+    FrameTimeStats GpuFrameStats() const;
+
+    // recorded scopes of one thread, oldest first; thread 0 registered first
+    std::vector<ProfileEvent> Events(std::size_t thread_index) const;
+    std::size_t ThreadCount() const;
+
+    void WriteChromeTrace(std::ostream& out) const;
+    bool ExportChromeTrace(const char* path) const;
+
+    // nanoseconds since the profiler was created
+    std::int64_t NowNanoseconds() const;
+
+private:
+    struct ThreadBuffer {
+
+        std::thread::id owner;
+        std::uint32_t thread_index = 0;
+        std::vector<ProfileEvent> events;
+        std::uint64_t write_count = 0;
+
+        std::uint32_t depth = 0;
+        const char* open_names[PROFILER_MAX_DEPTH];
+        std::int64_t open_begin_ns[PROFILER_MAX_DEPTH];
+    };
+
+    struct GpuEvent {
+
+        const char* name;
+        std::int64_t begin_ns;
+        double duration_ms;
+    };
+
+    ThreadBuffer& CurrentThreadBuffer();
+
+    const std::uint64_t id;
+    const std::size_t events_per_thread;
+    const std::int64_t start_ns;
+
+    mutable std::mutex threads_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> threads;
+
+    mutable std::mutex frames_mutex;
+    std::int64_t last_frame_ns = -1;
+    RollingPercentiles cpu_frames;
+    RollingPercentiles gpu_frames;
+    std::vector<GpuEvent> gpu_events;
+    std::uint64_t gpu_write_count = 0;
+};
+
+// process-wide profiler used by PROFILE_SCOPE
+Profiler& DefaultProfiler();
+
+// RAII scope on the calling thread
+class ProfileScope {
+
+public:
+    ProfileScope(Profiler& profiler, const char* name) : profiler(profiler) { profiler.BeginScope(name); }
+    ~ProfileScope() { profiler.EndScope(); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler& profiler;
+};
+
+} // namespace Core
+
+#define CORE_PROFILE_CONCAT_INNER(a, b) a##b
+#define CORE_PROFILE_CONCAT(a, b) CORE_PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(name) \
+    Core::ProfileScope CORE_PROFILE_CONCAT(profile_scope_, __LINE__)(Core::DefaultProfiler(), name)
+#else
+#define PROFILE_SCOPE(name) do {} while (0)
+#endif
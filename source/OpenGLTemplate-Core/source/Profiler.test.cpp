@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: Profiler.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "GpuTimer.hpp"
+#include "Profiler.hpp"
+#include "UnitTest.hpp"
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace Core;
+
+TEST_CASE(NestedScopesRecordDepthAndContainment) {
+
+    Profiler profiler;
+
+    {
+        ProfileScope outer(profiler, "Outer");
+        ProfileScope inner(profiler, "Inner");
+    }
+
+    const std::vector<ProfileEvent> events = profiler.Events(0);
+
+    // scopes are written when they close, innermost first
+    CHECK(events.size() == 2);
+    CHECK(std::strcmp(events[0].name, "Inner") == 0);
+    CHECK(events[0].depth == 1);
+    CHECK(std::strcmp(events[1].name, "Outer") == 0);
+    CHECK(events[1].depth == 0);
+    CHECK(events[1].begin_ns <= events[0].begin_ns);
+    CHECK(events[0].end_ns <= events[1].end_ns);
+}
+
+TEST_CASE(RingKeepsNewestEvents) {
+
+    Profiler profiler(4);
+
+    const char* names[] = {"0", "1", "2", "3", "4", "5"};
+
+    for (const char* name : names) {
+
+        ProfileScope scope(profiler, name);
+    }
+
+    const std::vector<ProfileEvent> events = profiler.Events(0);
+
+    CHECK(events.size() == 4);
+    CHECK(std::strcmp(events.front().name, "2") == 0);
+    CHECK(std::strcmp(events.back().name, "5") == 0);
+}
+
+TEST_CASE(EachThreadRecordsIntoItsOwnBuffer) {
+
+    Profiler profiler;
+
+    {
+        ProfileScope scope(profiler, "Main");
+    }
+
+    std::thread worker([&]() {
+
+        ProfileScope first(profiler, "Worker A");
+    });
+
+    worker.join();
+
+    CHECK(profiler.ThreadCount() == 2);
+    CHECK(profiler.Events(0).size() == 1);
+    CHECK(profiler.Events(1).size() == 1);
+    CHECK(std::strcmp(profiler.Events(1)[0].name, "Worker A") == 0);
+}
+
+TEST_CASE(RollingPercentilesUseNearestRank) {
+
+    RollingPercentiles frames(100);
+
+    for (int i = 1; i <= 100; ++i) {
+
+        frames.Add(i);
+    }
+
+    FrameTimeStats stats = frames.Stats();
+
+    CHECK(stats.samples == 100);
+    CHECK_NEAR(stats.p50_ms, 50.0, 1e-9);
+    CHECK_NEAR(stats.p95_ms, 95.0, 1e-9);
+    CHECK_NEAR(stats.p99_ms, 99.0, 1e-9);
+    CHECK_NEAR(stats.max_ms, 100.0, 1e-9);
+
+    // the window rolls: 100 new samples replace the old ones
+    for (int i = 0; i < 100; ++i) {
+
+        frames.Add(1000.0);
+    }
+
+    stats = frames.Stats();
+
+    CHECK_NEAR(stats.p50_ms, 1000.0, 1e-9);
+    CHECK(frames.Size() == 100);
+}
+
+TEST_CASE(MarkFrameFeedsCpuFrameStats) {
+
+    Profiler profiler;
+
+    profiler.MarkFrame();
+    CHECK(profiler.CpuFrameStats().samples == 0);
+
+    profiler.MarkFrame();
+    profiler.MarkFrame();
+
+    const FrameTimeStats stats = profiler.CpuFrameStats();
+
+    CHECK(stats.samples == 2);
+    CHECK(stats.p50_ms >= 0.0);
+}
+
+TEST_CASE(ChromeTraceContainsCpuAndGpuEvents) {
+
+    Profiler profiler;
+
+    {
+        ProfileScope scope(profiler, "On\"Render");
+    }
+
+    profiler.RecordGpuTime("GPU Frame", 1000, 2.5);
+
+    std::ostringstream out;
+    profiler.WriteChromeTrace(out);
+
+    const std::string json = out.str();
+
+    CHECK(json.find("\"traceEvents\"") != std::string::npos);
+    CHECK(json.find("\"name\":\"On\\\"Render\",\"cat\":\"cpu\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("\"cat\":\"gpu\"") != std::string::npos);
+    CHECK(json.find("\"dur\":2500.000") != std::string::npos);
+    CHECK(profiler.GpuFrameStats().samples == 1);
+
+    int depth = 0;
+
+    for (char c : json) {
+
+        depth += (c == '{' || c == '[') - (c == '}' || c == ']');
+    }
+
+    CHECK(depth == 0);
+}
+
+TEST_CASE(GpuTimerDegradesWithoutContext) {
+
+    Profiler profiler;
+    GpuTimer timer;
+
+    CHECK(!timer.Init(profiler));
+    CHECK(!timer.Available());
+
+    // every call is a no-op
+    timer.BeginFrame();
+    timer.EndFrame();
+    timer.Collect();
+    timer.Destroy();
+
+    CHECK(profiler.GpuFrameStats().samples == 0);
+}
+
+int main() { return Core::Test::RunAll(); }
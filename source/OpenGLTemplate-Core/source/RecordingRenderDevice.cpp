@@ -0,0 +1,337 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RecordingRenderDevice.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "RecordingRenderDevice.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Core {
+
+const char* RenderCommandName(RenderCommandType type) {
+
+    switch (type) {
+
+        case(RenderCommandType::SetViewport): return "SetViewport";
+        case(RenderCommandType::Clear): return "Clear";
+        case(RenderCommandType::UseProgram): return "UseProgram";
+        case(RenderCommandType::BindVertexArray): return "BindVertexArray";
+        case(RenderCommandType::SetVertexAttribute): return "SetVertexAttribute";
+        case(RenderCommandType::SetUniform): return "SetUniform";
+        case(RenderCommandType::UploadBuffer): return "UploadBuffer";
+        case(RenderCommandType::ReallocateBuffer): return "ReallocateBuffer";
+        case(RenderCommandType::BindUniformBuffer): return "BindUniformBuffer";
+        case(RenderCommandType::InsertFence): return "InsertFence";
+        case(RenderCommandType::Draw): return "Draw";
+    }
+
+    return "?";
+}
+
+const RecordedBuffer* RecordingRenderDevice::Buffer(BufferId buffer) const {
+
+    if (buffer == 0 || buffer > buffers.size() || !buffers[buffer - 1].alive) {
+
+        return nullptr;
+    }
+
+    return &buffers[buffer - 1];
+}
+
+const RecordedVertexArray* RecordingRenderDevice::VertexArray(VertexArrayId vertex_array) const {
+
+    if (vertex_array == 0 || vertex_array > vertex_arrays.size() || !vertex_arrays[vertex_array - 1].alive) {
+
+        return nullptr;
+    }
+
+    return &vertex_arrays[vertex_array - 1];
+}
+
+const RecordedProgram* RecordingRenderDevice::Program(ProgramId program) const {
+
+    if (program == 0 || program > programs.size() || !programs[program - 1].alive) {
+
+        return nullptr;
+    }
+
+    return &programs[program - 1];
+}
+
+const float* RecordingRenderDevice::UniformValue(ProgramId program, NameHash name) const {
+
+    const RecordedProgram* recorded = Program(program);
+
+    if (!recorded) {
+
+        return nullptr;
+    }
+
+    for (const auto& uniform : recorded->uniforms) {
+
+        if (uniform.first == name) {
+
+            return uniform.second.data();
+        }
+    }
+
+    return nullptr;
+}
+
+BufferId RecordingRenderDevice::UniformBufferAt(unsigned int binding) const {
+
+    return binding < uniform_bindings.size() ? uniform_bindings[binding] : 0;
+}
+
+std::size_t RecordingRenderDevice::CountCommands(RenderCommandType type) const {
+
+    return static_cast<std::size_t>(std::count_if(commands.begin(), commands.end(),
+                                    [type](const RenderCommand& command) { return command.type == type; }));
+}
+
+RenderCommand& RecordingRenderDevice::Record(RenderCommandType type, std::uint32_t id) {
+
+    RenderCommand& command = commands.emplace_back();
+    command.type = type;
+    command.id = id;
+
+    return command;
+}
+
+ProgramId RecordingRenderDevice::CreateProgramImpl(const char* vertex_source, const char* fragment_source) {
+
+    RecordedProgram& program = programs.emplace_back();
+    program.vertex_source = vertex_source;
+    program.fragment_source = fragment_source;
+    program.alive = true;
+
+    return static_cast<ProgramId>(programs.size());
+}
+
+void RecordingRenderDevice::DestroyProgramImpl(ProgramId program) {
+
+    if (Program(program)) {
+
+        programs[program - 1] = RecordedProgram{};
+    }
+}
+
+bool RecordingRenderDevice::BindUniformBlockImpl(ProgramId program, NameHash block_name, unsigned int binding) {
+
+    if (!Program(program)) {
+
+        return false;
+    }
+
+    programs[program - 1].block_bindings.emplace_back(block_name, binding);
+    return true;
+}
+
+BufferId RecordingRenderDevice::CreateBufferImpl(BufferTarget target, std::size_t size, const void* data, BufferUsage usage) {
+
+    RecordedBuffer& buffer = buffers.emplace_back();
+    buffer.target = target;
+    buffer.usage = usage;
+    buffer.data.resize(size);
+    buffer.alive = true;
+
+    if (data) {
+
+        std::memcpy(buffer.data.data(), data, size);
+    }
+
+    return static_cast<BufferId>(buffers.size());
+}
+
+void RecordingRenderDevice::DestroyBufferImpl(BufferId buffer) {
+
+    if (Buffer(buffer)) {
+
+        buffers[buffer - 1] = RecordedBuffer{};
+    }
+}
+
+void RecordingRenderDevice::ReallocateBufferImpl(BufferId buffer, std::size_t size) {
+
+    if (!Buffer(buffer) || buffers[buffer - 1].mapped) {
+
+        return;
+    }
+
+    buffers[buffer - 1].data.assign(size, 0);
+
+    RenderCommand& command = Record(RenderCommandType::ReallocateBuffer, buffer);
+    command.size = size;
+}
+
+void RecordingRenderDevice::UploadBufferImpl(BufferId buffer, std::size_t offset, std::size_t size, const void* data) {
+
+    // growing a mapped buffer would move it out from under its mapping
+    if (!Buffer(buffer) || buffers[buffer - 1].mapped) {
+
+        return;
+    }
+
+    std::vector<std::uint8_t>& storage = buffers[buffer - 1].data;
+
+    if (offset + size > storage.size()) {
+
+        storage.resize(offset + size);
+    }
+
+    std::memcpy(storage.data() + offset, data, size);
+
+    RenderCommand& command = Record(RenderCommandType::UploadBuffer, buffer);
+    command.offset = offset;
+    command.size = size;
+}
+
+void RecordingRenderDevice::BindUniformBufferImpl(BufferId buffer, unsigned int binding) {
+
+    if (binding >= uniform_bindings.size()) {
+
+        uniform_bindings.resize(binding + 1, 0);
+    }
+
+    uniform_bindings[binding] = buffer;
+
+    RenderCommand& command = Record(RenderCommandType::BindUniformBuffer, buffer);
+    command.binding = binding;
+}
+
+BufferId RecordingRenderDevice::CreateMappedBufferImpl(BufferTarget target, std::size_t size, void** mapping) {
+
+    if (!persistent_mapping) {
+
+        return 0;
+    }
+
+    const BufferId buffer = CreateBufferImpl(target, size, nullptr, BufferUsage::Stream);
+    buffers[buffer - 1].mapped = true;
+
+    // moving the vector of buffers keeps each buffer's storage in place
+    *mapping = buffers[buffer - 1].data.data();
+    return buffer;
+}
+
+FenceId RecordingRenderDevice::InsertFenceImpl() {
+
+    const FenceId fence = next_fence++;
+    Record(RenderCommandType::InsertFence, fence);
+
+    return fence;
+}
+
+VertexArrayId RecordingRenderDevice::CreateVertexArrayImpl(BufferId index_buffer) {
+
+    RecordedVertexArray& vertex_array = vertex_arrays.emplace_back();
+    vertex_array.index_buffer = index_buffer;
+    vertex_array.alive = true;
+
+    return static_cast<VertexArrayId>(vertex_arrays.size());
+}
+
+void RecordingRenderDevice::DestroyVertexArrayImpl(VertexArrayId vertex_array) {
+
+    if (VertexArray(vertex_array)) {
+
+        vertex_arrays[vertex_array - 1] = RecordedVertexArray{};
+    }
+}
+
+void RecordingRenderDevice::SetVertexAttributeImpl(const VertexAttribute& attribute) {
+
+    const VertexArrayId vertex_array = CurrentVertexArray();
+
+    if (!VertexArray(vertex_array)) {
+
+        return;
+    }
+
+    std::vector<VertexAttribute>& attributes = vertex_arrays[vertex_array - 1].attributes;
+
+    if (attribute.location >= attributes.size()) {
+
+        attributes.resize(attribute.location + 1);
+    }
+
+    attributes[attribute.location] = attribute;
+
+    RenderCommand& command = Record(RenderCommandType::SetVertexAttribute, vertex_array);
+    command.attribute = attribute;
+}
+
+void RecordingRenderDevice::BeginFrameImpl() {
+
+    commands.clear();
+    uniform_data.clear();
+}
+
+void RecordingRenderDevice::SetViewportImpl(int x, int y, int width, int height) {
+
+    RenderCommand& command = Record(RenderCommandType::SetViewport);
+    command.viewport[0] = x;
+    command.viewport[1] = y;
+    command.viewport[2] = width;
+    command.viewport[3] = height;
+}
+
+void RecordingRenderDevice::ClearImpl(const float* color_vec) {
+
+    RenderCommand& command = Record(RenderCommandType::Clear);
+    std::memcpy(command.color_vec, color_vec, sizeof(command.color_vec));
+}
+
+void RecordingRenderDevice::UseProgramImpl(ProgramId program) {
+
+    Record(RenderCommandType::UseProgram, program);
+}
+
+void RecordingRenderDevice::BindVertexArrayImpl(VertexArrayId vertex_array) {
+
+    Record(RenderCommandType::BindVertexArray, vertex_array);
+}
+
+void RecordingRenderDevice::SetUniformImpl(NameHash name, UniformType type, const float* value) {
+
+    const ProgramId program = CurrentProgram();
+    const int float_count = UniformFloatCount(type);
+
+    RenderCommand& command = Record(RenderCommandType::SetUniform, program);
+    command.name = name;
+    command.uniform_type = type;
+    command.data_offset = uniform_data.size();
+
+    uniform_data.insert(uniform_data.end(), value, value + float_count);
+
+    if (!Program(program)) {
+
+        return;
+    }
+
+    auto& uniforms = programs[program - 1].uniforms;
+
+    auto found = std::find_if(uniforms.begin(), uniforms.end(),
+                              [name](const auto& uniform) { return uniform.first == name; });
+
+    if (found == uniforms.end()) {
+
+        uniforms.emplace_back(name, std::array<float, 16>{});
+        found = uniforms.end() - 1;
+    }
+
+    std::copy(value, value + float_count, found->second.begin());
+}
+
+void RecordingRenderDevice::DrawImpl(const DrawCall& draw) {
+
+    RenderCommand& command = Record(RenderCommandType::Draw, CurrentVertexArray());
+    command.draw = draw;
+}
+
+} // namespace Core
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RecordingRenderDevice.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RenderDevice.hpp"
+
+namespace Core {
+
+enum class RenderCommandType : std::uint8_t {
+
+    SetViewport,
+    Clear,
+    UseProgram,
+    BindVertexArray,
+    SetVertexAttribute,
+    SetUniform,
+    UploadBuffer,
+    ReallocateBuffer,
+    BindUniformBuffer,
+    InsertFence,
+    Draw
+};
+
+const char* RenderCommandName(RenderCommandType type);
+
+////////////////////////////////////////////////////////////////////////////////
+// Render Command
+// --One recorded call. Only the fields of its type are meaningful: id is the
+//   program, vertex array or buffer; uniform values live in the device's
+//   UniformData() starting at data_offset.
+////////////////////////////////////////////////////////////////////////////////
+struct RenderCommand {
+
+    RenderCommandType type;
+    std::uint32_t id = 0;
+
+    NameHash name = 0;
+    UniformType uniform_type = UniformType::Float;
+    std::size_t data_offset = 0;
+
+    std::size_t offset = 0;         // buffer upload range
+    std::size_t size = 0;
+    unsigned int binding = 0;
+
+    int viewport[4] {};
+    float color_vec[4] {};
+
+    VertexAttribute attribute;
+    DrawCall draw;
+};
+
+struct RecordedBuffer {
+
+    BufferTarget target = BufferTarget::Vertex;
+    BufferUsage usage = BufferUsage::Static;
+    std::vector<std::uint8_t> data;
+    bool mapped = false;            // CreateMappedBuffer hands out data.data()
+    bool alive = false;
+};
+
+struct RecordedVertexArray {
+
+    BufferId index_buffer = 0;
+    std::vector<VertexAttribute> attributes;   // by location, components 0 when unset
+    bool alive = false;
+};
+
+struct RecordedProgram {
+
+    std::string vertex_source;
+    std::string fragment_source;
+    std::vector<std::pair<NameHash, unsigned int>> block_bindings;
+    std::vector<std::pair<NameHash, std::array<float, 16>>> uniforms;
+    bool alive = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Recording Render Device
+// --Headless backend: keeps buffer contents, vertex layouts and program
+//   uniform values in memory like a driver would, and records every call
+//   of the current frame (BeginFrame clears the list).
+// --Nothing is rasterized. Use it to measure CPU-side frame cost, draw and
+//   state change counts, or to inspect exactly what a frame submitted.
+// --Every call completes immediately, so fences are signaled as soon as they
+//   are inserted. Mapped buffers map the recorded data directly; turn them
+//   off to exercise the plain GL 3.3 paths.
+////////////////////////////////////////////////////////////////////////////////
+class RecordingRenderDevice : public RenderDevice {
+
+public:
+    const char* Name() const override { return "Recording"; }
+
+    const std::vector<RenderCommand>& Commands() const { return commands; }
+    const std::vector<float>& UniformData() const { return uniform_data; }
+
+    // nullptr for unknown or destroyed ids
+    const RecordedBuffer* Buffer(BufferId buffer) const;
+    const RecordedVertexArray* VertexArray(VertexArrayId vertex_array) const;
+    const RecordedProgram* Program(ProgramId program) const;
+
+    // last value set on the program, nullptr if never set
+    const float* UniformValue(ProgramId program, NameHash name) const;
+
+    // buffer bound to a uniform binding point, 0 if none
+    BufferId UniformBufferAt(unsigned int binding) const;
+
+    std::size_t CountCommands(RenderCommandType type) const;
+
+    void SetPersistentMapping(bool supported) { persistent_mapping = supported; }
+
+protected:
+    ProgramId CreateProgramImpl(const char* vertex_source, const char* fragment_source) override;
+    void DestroyProgramImpl(ProgramId program) override;
+    bool BindUniformBlockImpl(ProgramId program, NameHash block_name, unsigned int binding) override;
+
+    BufferId CreateBufferImpl(BufferTarget target, std::size_t size, const void* data, BufferUsage usage) override;
+    void DestroyBufferImpl(BufferId buffer) override;
+    void ReallocateBufferImpl(BufferId buffer, std::size_t size) override;
+    void UploadBufferImpl(BufferId buffer, std::size_t offset, std::size_t size, const void* data) override;
+    void BindUniformBufferImpl(BufferId buffer, unsigned int binding) override;
+    BufferId CreateMappedBufferImpl(BufferTarget target, std::size_t size, void** mapping) override;
+
+    FenceId InsertFenceImpl() override;
+    bool IsFenceSignaledImpl(FenceId) override { return true; }
+    void WaitFenceImpl(FenceId) override {}
+    void DeleteFenceImpl(FenceId) override {}
+
+    VertexArrayId CreateVertexArrayImpl(BufferId index_buffer) override;
+    void DestroyVertexArrayImpl(VertexArrayId vertex_array) override;
+    void SetVertexAttributeImpl(const VertexAttribute& attribute) override;
+
+    void BeginFrameImpl() override;
+
+    void SetViewportImpl(int x, int y, int width, int height) override;
+    void ClearImpl(const float* color_vec) override;
+
+    void UseProgramImpl(ProgramId program) override;
+    void BindVertexArrayImpl(VertexArrayId vertex_array) override;
+    void SetUniformImpl(NameHash name, UniformType type, const float* value) override;
+    void DrawImpl(const DrawCall& draw) override;
+
+private:
+    RenderCommand& Record(RenderCommandType type, std::uint32_t id = 0);
+
+    std::vector<RecordedBuffer> buffers;            // BufferId - 1
+    std::vector<RecordedVertexArray> vertex_arrays; // VertexArrayId - 1
+    std::vector<RecordedProgram> programs;          // ProgramId - 1
+    std::vector<BufferId> uniform_bindings;
+
+    std::vector<RenderCommand> commands;
+    std::vector<float> uniform_data;
+
+    bool persistent_mapping = true;
+    FenceId next_fence = 1;
+};
+
+} // namespace Core
@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RenderDevice.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "RenderDevice.hpp"
+
+namespace Core {
+
+int UniformFloatCount(UniformType type) {
+
+    switch (type) {
+
+        case(UniformType::Float): return 1;
+        case(UniformType::Vec4): return 4;
+        case(UniformType::Mat4): return 16;
+    }
+
+    return 0;
+}
+
+ProgramId RenderDevice::CreateProgram(const char* vertex_source, const char* fragment_source) {
+
+    return CreateProgramImpl(vertex_source, fragment_source);
+}
+
+void RenderDevice::DestroyProgram(ProgramId program) {
+
+    if (program == current_program) {
+
+        current_program = 0;
+    }
+
+    DestroyProgramImpl(program);
+}
+
+bool RenderDevice::BindUniformBlock(ProgramId program, NameHash block_name, unsigned int binding) {
+
+    return BindUniformBlockImpl(program, block_name, binding);
+}
+
+BufferId RenderDevice::CreateBuffer(BufferTarget target, std::size_t size, const void* data, BufferUsage usage) {
+
+    if (data) {
+
+        frame_stats.buffer_uploads += 1;
+        frame_stats.bytes_uploaded += size;
+    }
+
+    return CreateBufferImpl(target, size, data, usage);
+}
+
+void RenderDevice::DestroyBuffer(BufferId buffer) {
+
+    DestroyBufferImpl(buffer);
+}
+
+void RenderDevice::ReallocateBuffer(BufferId buffer, std::size_t size) {
+
+    ReallocateBufferImpl(buffer, size);
+}
+
+void RenderDevice::UploadBuffer(BufferId buffer, std::size_t offset, std::size_t size, const void* data) {
+
+    frame_stats.buffer_uploads += 1;
+    frame_stats.bytes_uploaded += size;
+
+    UploadBufferImpl(buffer, offset, size, data);
+}
+
+void RenderDevice::BindUniformBuffer(BufferId buffer, unsigned int binding) {
+
+    BindUniformBufferImpl(buffer, binding);
+}
+
+BufferId RenderDevice::CreateMappedBuffer(BufferTarget target, std::size_t size, void** mapping) {
+
+    *mapping = nullptr;
+    return CreateMappedBufferImpl(target, size, mapping);
+}
+
+FenceId RenderDevice::InsertFence() {
+
+    return InsertFenceImpl();
+}
+
+bool RenderDevice::IsFenceSignaled(FenceId fence) {
+
+    return fence == 0 || IsFenceSignaledImpl(fence);
+}
+
+void RenderDevice::WaitFence(FenceId fence) {
+
+    if (IsFenceSignaled(fence)) {
+
+        return;
+    }
+
+    frame_stats.fence_waits += 1;
+    WaitFenceImpl(fence);
+}
+
+void RenderDevice::DeleteFence(FenceId fence) {
+
+    if (fence != 0) {
+
+        DeleteFenceImpl(fence);
+    }
+}
+
+VertexArrayId RenderDevice::CreateVertexArray(BufferId index_buffer) {
+
+    return CreateVertexArrayImpl(index_buffer);
+}
+
+void RenderDevice::DestroyVertexArray(VertexArrayId vertex_array) {
+
+    if (vertex_array == current_vertex_array) {
+
+        current_vertex_array = 0;
+    }
+
+    DestroyVertexArrayImpl(vertex_array);
+}
+
+void RenderDevice::SetVertexAttribute(VertexArrayId vertex_array, const VertexAttribute& attribute) {
+
+    BindVertexArray(vertex_array);
+
+    frame_stats.attribute_changes += 1;
+    SetVertexAttributeImpl(attribute);
+}
+
+void RenderDevice::BeginFrame() {
+
+    frame_stats = RenderDeviceStats{};
+    BeginFrameImpl();
+}
+
+void RenderDevice::EndFrame() {
+
+    EndFrameImpl();
+    frame_count += 1;
+}
+
+void RenderDevice::SetViewport(int x, int y, int width, int height) {
+
+    SetViewportImpl(x, y, width, height);
+}
+
+void RenderDevice::Clear(const float* color_vec) {
+
+    ClearImpl(color_vec);
+}
+
+void RenderDevice::UseProgram(ProgramId program) {
+
+    if (program == current_program) {
+
+        return;
+    }
+
+    current_program = program;
+    frame_stats.program_binds += 1;
+
+    UseProgramImpl(program);
+}
+
+void RenderDevice::BindVertexArray(VertexArrayId vertex_array) {
+
+    if (vertex_array == current_vertex_array) {
+
+        return;
+    }
+
+    current_vertex_array = vertex_array;
+    frame_stats.vertex_array_binds += 1;
+
+    BindVertexArrayImpl(vertex_array);
+}
+
+void RenderDevice::SetUniform(NameHash name, UniformType type, const float* value) {
+
+    frame_stats.uniform_sets += 1;
+    SetUniformImpl(name, type, value);
+}
+
+void RenderDevice::Draw(const DrawCall& draw) {
+
+    frame_stats.draw_calls += 1;
+    frame_stats.instances += draw.instance_count;
+
+    DrawImpl(draw);
+}
+
+} // namespace Core
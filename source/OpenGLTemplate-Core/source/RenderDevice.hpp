@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RenderDevice.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ShaderReflection.hpp"
+
+namespace Core {
+
+// 0 is never a valid handle
+using BufferId = std::uint32_t;
+using ProgramId = std::uint32_t;
+using VertexArrayId = std::uint32_t;
+using FenceId = std::uint32_t;
+
+enum class BufferTarget : std::uint8_t {
+
+    Vertex,
+    Index,          // uint16 indices
+    Uniform
+};
+
+enum class BufferUsage : std::uint8_t {
+
+    Static,
+    Dynamic,
+    Stream
+};
+
+enum class AttributeFormat : std::uint8_t {
+
+    Float,
+    Short
+};
+
+enum class PrimitiveType : std::uint8_t {
+
+    LineStrip,
+    Lines,
+    Triangles
+};
+
+enum class UniformType : std::uint8_t {
+
+    Float,
+    Vec4,
+    Mat4
+};
+
+int UniformFloatCount(UniformType type);
+
+struct VertexAttribute {
+
+    unsigned int location = 0;
+    BufferId buffer = 0;
+    int components = 0;
+    AttributeFormat format = AttributeFormat::Float;
+    bool normalized = false;
+    std::size_t stride = 0;
+    std::size_t offset = 0;
+    unsigned int divisor = 0;       // 0 advances per vertex, 1 per instance
+};
+
+struct DrawCall {
+
+    PrimitiveType primitive = PrimitiveType::LineStrip;
+    int index_count = 0;
+    int first_index = 0;            // into the vertex array's index buffer
+    int base_vertex = 0;
+    int instance_count = 1;
+};
+
+struct RenderDeviceStats {
+
+    std::size_t draw_calls = 0;
+    std::size_t instances = 0;
+    std::size_t program_binds = 0;
+    std::size_t vertex_array_binds = 0;
+    std::size_t attribute_changes = 0;
+    std::size_t uniform_sets = 0;
+    std::size_t buffer_uploads = 0;
+    std::size_t bytes_uploaded = 0;
+    std::size_t fence_waits = 0;        // WaitFence calls that found the GPU behind
+
+    std::size_t StateChanges() const {
+
+        return program_binds + vertex_array_binds + attribute_changes + uniform_sets;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Render Device
+// --Thin interface over the handful of GL 3.3 features the renderer uses:
+//   buffers, vertex arrays, programs with reflected uniforms, indexed draws,
+//   fences; plus persistently mapped buffers where the backend has them.
+// --Public calls are non-virtual: they count per-frame stats and skip
+//   redundant program and vertex array binds before reaching a backend.
+// --Backends: GLRenderDevice (the window's context) and RecordingRenderDevice
+//   (headless, captures the command stream in memory).
+////////////////////////////////////////////////////////////////////////////////
+class RenderDevice {
+
+public:
+    virtual ~RenderDevice() = default;
+
+    virtual const char* Name() const = 0;
+
+    ProgramId CreateProgram(const char* vertex_source, const char* fragment_source);
+    void DestroyProgram(ProgramId program);
+    bool BindUniformBlock(ProgramId program, NameHash block_name, unsigned int binding);
+
+    BufferId CreateBuffer(BufferTarget target, std::size_t size, const void* data, BufferUsage usage);
+    void DestroyBuffer(BufferId buffer);
+
+    // drops the old storage, in-flight draws keep reading it
+    void ReallocateBuffer(BufferId buffer, std::size_t size);
+    void UploadBuffer(BufferId buffer, std::size_t offset, std::size_t size, const void* data);
+    void BindUniformBuffer(BufferId buffer, unsigned int binding);
+
+    // write-only, coherent mapping that stays valid until the buffer is
+    // destroyed; returns 0 when the backend cannot map persistently. The
+    // storage is immutable, ReallocateBuffer and UploadBuffer do not apply.
+    BufferId CreateMappedBuffer(BufferTarget target, std::size_t size, void** mapping);
+
+    // passed once the GPU has finished every command issued before it
+    FenceId InsertFence();
+    bool IsFenceSignaled(FenceId fence);
+    void WaitFence(FenceId fence);
+    void DeleteFence(FenceId fence);
+
+    VertexArrayId CreateVertexArray(BufferId index_buffer);
+    void DestroyVertexArray(VertexArrayId vertex_array);
+
+    // binds the vertex array first
+    void SetVertexAttribute(VertexArrayId vertex_array, const VertexAttribute& attribute);
+
+    // resets the frame stats
+    void BeginFrame();
+    void EndFrame();
+
+    void SetViewport(int x, int y, int width, int height);
+    void Clear(const float* color_vec);
+
+    void UseProgram(ProgramId program);
+    void BindVertexArray(VertexArrayId vertex_array);
+
+    // applies to the program in use
+    void SetUniform(NameHash name, UniformType type, const float* value);
+
+    // uses the bound vertex array's index buffer
+    void Draw(const DrawCall& draw);
+
+    ProgramId CurrentProgram() const { return current_program; }
+    VertexArrayId CurrentVertexArray() const { return current_vertex_array; }
+
+    const RenderDeviceStats& FrameStats() const { return frame_stats; }
+    std::uint64_t FrameCount() const { return frame_count; }
+
+protected:
+    virtual ProgramId CreateProgramImpl(const char* vertex_source, const char* fragment_source) = 0;
+    virtual void DestroyProgramImpl(ProgramId program) = 0;
+    virtual bool BindUniformBlockImpl(ProgramId program, NameHash block_name, unsigned int binding) = 0;
+
+    virtual BufferId CreateBufferImpl(BufferTarget target, std::size_t size, const void* data, BufferUsage usage) = 0;
+    virtual void DestroyBufferImpl(BufferId buffer) = 0;
+    virtual void ReallocateBufferImpl(BufferId buffer, std::size_t size) = 0;
+    virtual void UploadBufferImpl(BufferId buffer, std::size_t offset, std::size_t size, const void* data) = 0;
+    virtual void BindUniformBufferImpl(BufferId buffer, unsigned int binding) = 0;
+    virtual BufferId CreateMappedBufferImpl(BufferTarget target, std::size_t size, void** mapping) = 0;
+
+    virtual FenceId InsertFenceImpl() = 0;
+    virtual bool IsFenceSignaledImpl(FenceId fence) = 0;
+    virtual void WaitFenceImpl(FenceId fence) = 0;
+    virtual void DeleteFenceImpl(FenceId fence) = 0;
+
+    virtual VertexArrayId CreateVertexArrayImpl(BufferId index_buffer) = 0;
+    virtual void DestroyVertexArrayImpl(VertexArrayId vertex_array) = 0;
+    virtual void SetVertexAttributeImpl(const VertexAttribute& attribute) = 0;
+
+    virtual void BeginFrameImpl() {}
+    virtual void EndFrameImpl() {}
+
+    virtual void SetViewportImpl(int x, int y, int width, int height) = 0;
+    virtual void ClearImpl(const float* color_vec) = 0;
+
+    virtual void UseProgramImpl(ProgramId program) = 0;
+    virtual void BindVertexArrayImpl(VertexArrayId vertex_array) = 0;
+    virtual void SetUniformImpl(NameHash name, UniformType type, const float* value) = 0;
+    virtual void DrawImpl(const DrawCall& draw) = 0;
+
+private:
+    ProgramId current_program = 0;
+    VertexArrayId current_vertex_array = 0;
+
+    RenderDeviceStats frame_stats;
+    std::uint64_t frame_count = 0;
+};
+
+} // namespace Core
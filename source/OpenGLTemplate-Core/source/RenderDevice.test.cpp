@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RenderDevice.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "BatchRenderer.hpp"
+#include "MeshRegistry.hpp"
+#include "RecordingRenderDevice.hpp"
+#include "UniformBuffer.hpp"
+#include "UnitTest.hpp"
+
+#include <array>
+#include <cstring>
+
+using namespace Core;
+
+static const std::array<float, 6> line {
+    -1.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f,
+};
+
+static const std::array<float, 24> square {
+    0.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f,
+    1.0f, 0.0f, 0.0f,   1.0f, 1.0f, 0.0f,
+    1.0f, 1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f,   0.0f, 0.0f, 0.0f,
+};
+
+constexpr NameHash U_COLOR_VEC = HashName("u_Color_vec");
+
+TEST_CASE(RedundantBindsAreSkipped) {
+
+    RecordingRenderDevice device;
+
+    ProgramId program = device.CreateProgram("vs", "fs");
+    VertexArrayId vertex_array = device.CreateVertexArray(0);
+
+    device.BeginFrame();
+
+    device.UseProgram(program);
+    device.UseProgram(program);
+    device.BindVertexArray(vertex_array);
+    device.BindVertexArray(vertex_array);
+
+    CHECK(device.FrameStats().program_binds == 1);
+    CHECK(device.FrameStats().vertex_array_binds == 1);
+    CHECK(device.FrameStats().StateChanges() == 2);
+    CHECK(device.CountCommands(RenderCommandType::UseProgram) == 1);
+    CHECK(device.CountCommands(RenderCommandType::BindVertexArray) == 1);
+}
+
+TEST_CASE(BeginFrameResetsStatsAndCommands) {
+
+    RecordingRenderDevice device;
+
+    ProgramId program = device.CreateProgram("vs", "fs");
+
+    device.BeginFrame();
+    device.UseProgram(program);
+    device.Draw(DrawCall{PrimitiveType::LineStrip, 4, 0, 0, 3});
+    device.EndFrame();
+
+    CHECK(device.FrameStats().draw_calls == 1);
+    CHECK(device.FrameStats().instances == 3);
+    CHECK(device.Commands().size() == 2);
+    CHECK(device.FrameCount() == 1);
+
+    device.BeginFrame();
+
+    CHECK(device.FrameStats().draw_calls == 0);
+    CHECK(device.Commands().empty());
+
+    // bindings survive the frame boundary, so this is still redundant
+    device.UseProgram(program);
+    CHECK(device.FrameStats().program_binds == 0);
+}
+
+TEST_CASE(UniformsAreKeptPerProgram) {
+
+    RecordingRenderDevice device;
+
+    ProgramId first = device.CreateProgram("vs", "fs");
+    ProgramId second = device.CreateProgram("vs", "fs");
+
+    const float red[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+    const float blue[4] = {0.0f, 0.0f, 1.0f, 1.0f};
+
+    device.BeginFrame();
+    device.UseProgram(first);
+    device.SetUniform(U_COLOR_VEC, UniformType::Vec4, red);
+    device.UseProgram(second);
+    device.SetUniform(U_COLOR_VEC, UniformType::Vec4, blue);
+
+    CHECK(device.UniformValue(first, U_COLOR_VEC)[0] == 1.0f);
+    CHECK(device.UniformValue(second, U_COLOR_VEC)[2] == 1.0f);
+    CHECK(device.UniformValue(first, HashName("u_Model_mat")) == nullptr);
+
+    CHECK(device.FrameStats().uniform_sets == 2);
+    CHECK(device.UniformData().size() == 8);
+}
+
+TEST_CASE(MeshRegistryUploadsSharedBuffers) {
+
+    RecordingRenderDevice device;
+    MeshRegistry registry;
+
+    MeshId line_mesh = registry.Register(BuildIndexedMesh(line.data(), line.size()));
+    MeshId square_mesh = registry.Register(BuildIndexedMesh(square.data(), square.size()));
+
+    registry.Upload(device);
+
+    const RecordedBuffer* vertices = device.Buffer(registry.VertexBuffer());
+    const RecordedBuffer* indices = device.Buffer(registry.IndexBuffer());
+    const RecordedVertexArray* vertex_array = device.VertexArray(registry.VertexArray());
+
+    CHECK(vertices && vertices->data.size() == registry.VertexCount() * sizeof(PackedVertex));
+    CHECK(indices && indices->data.size() == registry.IndexCount() * sizeof(std::uint16_t));
+    CHECK(indices && indices->target == BufferTarget::Index);
+
+    CHECK(vertex_array && vertex_array->index_buffer == registry.IndexBuffer());
+    CHECK(vertex_array && vertex_array->attributes[0].format == AttributeFormat::Short);
+    CHECK(vertex_array && vertex_array->attributes[0].normalized);
+
+    device.BeginFrame();
+    registry.Bind();
+    registry.Draw(line_mesh);
+    registry.DrawInstanced(square_mesh, 7);
+
+    const RenderCommand& draw = device.Commands().back();
+
+    CHECK(draw.type == RenderCommandType::Draw);
+    CHECK(draw.id == registry.VertexArray());
+    CHECK(draw.draw.first_index == registry.Range(square_mesh).first_index);
+    CHECK(draw.draw.base_vertex == registry.Range(square_mesh).first_vertex);
+    CHECK(draw.draw.instance_count == 7);
+    CHECK(device.FrameStats().draw_calls == 2);
+
+    registry.Destroy();
+
+    CHECK(device.Buffer(registry.VertexBuffer()) == nullptr);
+    CHECK(device.VertexArray(1) == nullptr);
+}
+
+TEST_CASE(BatchFlushDrawsEachNonEmptyMeshOnce) {
+
+    RecordingRenderDevice device;
+    MeshRegistry registry;
+
+    MeshId line_mesh = registry.Register(BuildIndexedMesh(line.data(), line.size()));
+    registry.Register(BuildIndexedMesh(square.data(), square.size()));
+    registry.Upload(device);
+
+    ProgramId program = device.CreateProgram("vs", "fs");
+
+    BatchRenderer batch;
+    batch.Init(device, program, registry, 4);
+
+    const float color_vec[4] = {0.5f, 0.25f, 1.0f, 1.0f};
+
+    device.BeginFrame();
+    batch.Begin();
+    batch.Submit(line_mesh, Affine2D::Translation(3.0f, 4.0f), color_vec);
+    batch.Submit(line_mesh, Affine2D::Identity(), color_vec);
+    batch.Flush();
+
+    CHECK(device.CountCommands(RenderCommandType::Draw) == 1);
+    CHECK(device.FrameStats().instances == 2);
+    CHECK(device.FrameStats().program_binds == 1);
+    CHECK(device.FrameStats().bytes_uploaded == 2 * sizeof(InstanceData));
+
+    // the instance buffer is the one the color attribute reads from
+    const RecordedVertexArray* vertex_array = device.VertexArray(registry.VertexArray());
+    CHECK(vertex_array && vertex_array->attributes.size() == 5);
+    CHECK(vertex_array && vertex_array->attributes[4].divisor == 1);
+
+    const RecordedBuffer* instances = device.Buffer(vertex_array->attributes[4].buffer);
+
+    InstanceData first;
+    std::memcpy(&first, instances->data.data(), sizeof(first));
+
+    CHECK(first.transform.tx == 3.0f);
+    CHECK(first.transform.ty == 4.0f);
+    CHECK(first.color_vec[1] == 0.25f);
+
+    batch.Shutdown();
+}
+
+TEST_CASE(UniformBufferBindsOnCreate) {
+
+    RecordingRenderDevice device;
+    UniformBuffer buffer;
+
+    buffer.Create(device, 64, 3);
+
+    CHECK(device.UniformBufferAt(3) == buffer.Buffer());
+    CHECK(device.Buffer(buffer.Buffer())->target == BufferTarget::Uniform);
+
+    const float value = 2.5f;
+    buffer.Update(&value, sizeof(value), 8);
+
+    float stored = 0.0f;
+    std::memcpy(&stored, device.Buffer(buffer.Buffer())->data.data() + 8, sizeof(stored));
+
+    CHECK(stored == 2.5f);
+
+    buffer.Destroy();
+}
+
+int main() { return Core::Test::RunAll(); }
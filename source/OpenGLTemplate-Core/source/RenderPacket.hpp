@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RenderPacket.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BatchRenderer.hpp"
+#include "CameraUniformBlock.hpp"
+#include "DrawList.hpp"
+#include "FramePacer.hpp"
+#include "RenderDevice.hpp"
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Render Packet
+// --Everything needed to submit one frame, built on the main thread and
+//   consumed by the render thread (see RenderThread). Nothing in it points
+//   at simulation state, so the next frame can be simulated meanwhile.
+// --Immutable once submitted: the builder only writes it between Acquire()
+//   and Submit(), the render thread only writes the results at the end.
+// --Packets are reused, so their lists keep their capacity across frames.
+////////////////////////////////////////////////////////////////////////////////
+struct RenderPacket {
+
+    std::uint64_t frame = 0;
+    FrameTiming timing;
+    double build_seconds = 0.0;     // main thread time spent building it
+
+    bool set_viewport = false;      // the framebuffer was resized
+    int viewport_width = 0;
+    int viewport_height = 0;
+
+    bool upload_meshes = false;     // the mesh registry grew since the last packet
+
+    CameraBlockData camera;
+
+    bool batched = true;
+    BatchRenderer instances;        // batched path, CPU only: Reset(), never Init()
+    DrawList draws;                 // per-entity path, sorted unless disabled
+
+    std::vector<float> trail;       // x, y of a streamed line strip, empty for none
+
+    // results, written by the render thread after submitting
+    bool rendered = false;
+    RenderDeviceStats device_stats;
+    double submit_seconds = 0.0;
+};
+
+} // namespace Core
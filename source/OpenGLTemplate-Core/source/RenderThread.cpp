@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RenderThread.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "RenderThread.hpp"
+
+#include <chrono>
+
+namespace Core {
+
+static std::size_t RoundUpToPowerOfTwo(std::size_t value) {
+
+    std::size_t power = 1;
+
+    while (power < value) {
+
+        power *= 2;
+    }
+
+    return power;
+}
+
+RenderPacketQueue::RenderPacketQueue(std::size_t capacity)
+    : slots(RoundUpToPowerOfTwo(capacity), nullptr),
+      mask(slots.size() - 1) {
+
+}
+
+bool RenderPacketQueue::TryPush(RenderPacket* packet) {
+
+    const std::size_t write = tail.load(std::memory_order_relaxed);
+
+    if (write - head.load(std::memory_order_acquire) == slots.size()) {
+
+        return false;
+    }
+
+    slots[write & mask] = packet;
+    tail.store(write + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool RenderPacketQueue::TryPop(RenderPacket*& packet) {
+
+    const std::size_t read = head.load(std::memory_order_relaxed);
+
+    if (read == tail.load(std::memory_order_acquire)) {
+
+        return false;
+    }
+
+    packet = slots[read & mask];
+    head.store(read + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool RenderPacketQueue::Empty() const {
+
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+}
+
+RenderThread::RenderThread(std::size_t packet_count)
+    : packets(packet_count),
+      submitted(packet_count + 1),
+      returned(packet_count) {
+
+    for (RenderPacket& packet : packets) {
+
+        free_packets.push_back(&packet);
+    }
+}
+
+RenderThread::~RenderThread() {
+
+    Stop();
+}
+
+void RenderThread::Start(RenderFunction render_function, bool threaded,
+                         ContextFunction start_function, ContextFunction stop_function) {
+
+    render = std::move(render_function);
+    on_start = std::move(start_function);
+    on_stop = std::move(stop_function);
+    started = true;
+
+    if (threaded) {
+
+        thread = std::thread(&RenderThread::Loop, this);
+    }
+}
+
+void RenderThread::Stop() {
+
+    if (thread.joinable()) {
+
+        Push(submitted, nullptr);
+        thread.join();
+    }
+
+    Drain();
+    started = false;
+}
+
+RenderPacket& RenderThread::Acquire() {
+
+    if (free_packets.empty()) {
+
+        RenderPacket* packet = nullptr;
+
+        if (!returned.TryPop(packet)) {
+
+            const auto wait_start = std::chrono::steady_clock::now();
+
+            packet = Pop(returned);
+
+            stall_count += 1;
+            stall_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - wait_start).count();
+        }
+
+        free_packets.push_back(packet);
+        in_flight -= 1;
+    }
+
+    RenderPacket* packet = free_packets.back();
+    free_packets.pop_back();
+
+    return *packet;
+}
+
+void RenderThread::Submit(RenderPacket& packet) {
+
+    packet.rendered = false;
+    in_flight += 1;
+
+    if (thread.joinable()) {
+
+        Push(submitted, &packet);
+        return;
+    }
+
+    // not threaded: render right here, as if the thread had been instant
+    if (started && render) {
+
+        render(packet);
+    }
+
+    packet.rendered = true;
+    Push(returned, &packet);
+}
+
+void RenderThread::Drain() {
+
+    while (in_flight > 0) {
+
+        free_packets.push_back(Pop(returned));
+        in_flight -= 1;
+    }
+}
+
+void RenderThread::Loop() {
+
+    if (on_start) {
+
+        on_start();
+    }
+
+    while (RenderPacket* packet = Pop(submitted)) {
+
+        render(*packet);
+
+        packet->rendered = true;
+        Push(returned, packet);
+    }
+
+    if (on_stop) {
+
+        on_stop();
+    }
+}
+
+RenderPacket* RenderThread::Pop(RenderPacketQueue& queue) {
+
+    RenderPacket* packet = nullptr;
+
+    for (int attempt = 0; !queue.TryPop(packet); ++attempt) {
+
+        if (attempt < RENDER_SPIN_COUNT) {
+
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wake_mutex);
+
+        sleeping.fetch_add(1);
+
+        wake.wait(lock, [&queue]() {
+
+            // pairs with the fence in Push(): either the pusher sees this
+            // sleeper or this check sees the push
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return !queue.Empty();
+        });
+
+        sleeping.fetch_sub(1);
+    }
+
+    return packet;
+}
+
+void RenderThread::Push(RenderPacketQueue& queue, RenderPacket* packet) {
+
+    // never full: each queue holds every packet, submitted also the stop marker
+    queue.TryPush(packet);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (sleeping.load() > 0) {
+
+        // taking the lock orders this wake after a sleeper's predicate check
+        { std::lock_guard<std::mutex> lock(wake_mutex); }
+        wake.notify_all();
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RenderThread.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RenderPacket.hpp"
+
+#define RENDER_PACKET_COUNT     2       // one packet built while one is submitted
+#define RENDER_SPIN_COUNT       64      // empty polls before a waiting thread sleeps
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Render Packet Queue
+// --Bounded single-producer single-consumer ring of packet pointers. Push
+//   and pop are lock-free: each side owns one index and publishes it with
+//   release, the other reads it with acquire.
+////////////////////////////////////////////////////////////////////////////////
+class RenderPacketQueue {
+
+public:
+    // capacity is rounded up to a power of two
+    explicit RenderPacketQueue(std::size_t capacity);
+
+    // producer only; false if full
+    bool TryPush(RenderPacket* packet);
+
+    // consumer only; false if empty
+    bool TryPop(RenderPacket*& packet);
+
+    bool Empty() const;
+    std::size_t Capacity() const { return slots.size(); }
+
+private:
+    std::vector<RenderPacket*> slots;
+    std::size_t mask;
+
+    alignas(64) std::atomic<std::size_t> head{0};   // next pop, written by the consumer
+    alignas(64) std::atomic<std::size_t> tail{0};   // next push, written by the producer
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Render Thread
+// --Owns the render device (and the GL context) after Start(): the main
+//   thread Acquire()s a free packet, fills it and Submit()s it, and the
+//   render thread calls the render function on each packet in order, then
+//   hands it back. Frame N is submitted while frame N + 1 is simulated.
+// --Packets go round through two RenderPacketQueues, so at most
+//   RENDER_PACKET_COUNT frames are in flight; Acquire() waits (a stall)
+//   when the render thread is that far behind.
+// --Waiting threads spin RENDER_SPIN_COUNT polls, then sleep; the other
+//   side only takes the mutex to wake a sleeper.
+// --Started with threaded false, Submit() renders on the calling thread, so
+//   both modes share one code path.
+////////////////////////////////////////////////////////////////////////////////
+class RenderThread {
+
+public:
+    using RenderFunction = std::function<void(RenderPacket&)>;
+    using ContextFunction = std::function<void()>;
+
+    explicit RenderThread(std::size_t packet_count = RENDER_PACKET_COUNT);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // on_start and on_stop run on the render thread as it starts and exits,
+    // e.g. to make the GL context current there; unused without a thread
+    void Start(RenderFunction render, bool threaded = true,
+               ContextFunction on_start = {}, ContextFunction on_stop = {});
+
+    // renders every submitted packet, then joins
+    void Stop();
+
+    bool IsThreaded() const { return thread.joinable(); }
+
+    // a packet the render thread is done with; its results are from the
+    // frame it carried last. Every Acquire() must be followed by Submit()
+    RenderPacket& Acquire();
+    void Submit(RenderPacket& packet);
+
+    // waits until every submitted packet has been rendered
+    void Drain();
+
+    // every packet; only while drained, stopped or not started
+    std::deque<RenderPacket>& Packets() { return packets; }
+
+    std::size_t PacketCount() const { return packets.size(); }
+    std::uint64_t StallCount() const { return stall_count; }
+    double StallSeconds() const { return stall_seconds; }
+
+private:
+    void Loop();
+
+    // the queue's consumer; spins, then sleeps until a packet arrives
+    RenderPacket* Pop(RenderPacketQueue& queue);
+
+    // the queue's producer; wakes the other side if it sleeps
+    void Push(RenderPacketQueue& queue, RenderPacket* packet);
+
+    std::deque<RenderPacket> packets;       // deque, packets never move
+    std::vector<RenderPacket*> free_packets;    // popped back, not acquired yet
+
+    RenderPacketQueue submitted;    // main thread to render thread, nullptr stops
+    RenderPacketQueue returned;     // render thread to main thread
+
+    RenderFunction render;
+    ContextFunction on_start;
+    ContextFunction on_stop;
+
+    std::thread thread;
+    bool started = false;
+
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    std::atomic<int> sleeping{0};
+
+    std::size_t in_flight = 0;      // submitted, not popped back yet
+    std::uint64_t stall_count = 0;
+    double stall_seconds = 0.0;
+};
+
+} // namespace Core
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: RenderThread.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "RenderThread.hpp"
+#include "UnitTest.hpp"
+
+#include <thread>
+
+using namespace Core;
+
+TEST_CASE(QueueIsFirstInFirstOut) {
+
+    RenderPacketQueue queue(3);
+    RenderPacket packets[4];
+    RenderPacket* popped = nullptr;
+
+    CHECK(queue.Capacity() == 4);
+    CHECK(queue.Empty());
+    CHECK(!queue.TryPop(popped));
+
+    for (RenderPacket& packet : packets) {
+
+        CHECK(queue.TryPush(&packet));
+    }
+
+    CHECK(!queue.TryPush(&packets[0]));
+
+    for (RenderPacket& packet : packets) {
+
+        CHECK(queue.TryPop(popped) && popped == &packet);
+    }
+
+    CHECK(queue.Empty());
+}
+
+TEST_CASE(QueueWrapsAround) {
+
+    RenderPacketQueue queue(2);
+    RenderPacket packets[2];
+    RenderPacket* popped = nullptr;
+    int wrong = 0;
+
+    for (int i = 0; i < 1000; ++i) {
+
+        wrong += !queue.TryPush(&packets[i % 2]);
+        wrong += !queue.TryPop(popped) || popped != &packets[i % 2];
+    }
+
+    CHECK(wrong == 0);
+    CHECK(queue.Empty());
+}
+
+TEST_CASE(QueueHandsOffAcrossThreads) {
+
+    const int count = 200000;
+
+    RenderPacketQueue queue(8);
+    std::vector<RenderPacket> packets(16);
+
+    std::thread producer([&]() {
+
+        for (int i = 0; i < count; ++i) {
+
+            while (!queue.TryPush(&packets[i % packets.size()])) {
+
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int wrong = 0;
+
+    for (int i = 0; i < count; ++i) {
+
+        RenderPacket* popped = nullptr;
+
+        while (!queue.TryPop(popped)) {
+
+            std::this_thread::yield();
+        }
+
+        wrong += popped != &packets[i % packets.size()];
+    }
+
+    producer.join();
+
+    CHECK(wrong == 0);
+}
+
+TEST_CASE(PacketsRenderInOrderOnTheRenderThread) {
+
+    const std::uint64_t count = 20000;
+
+    RenderThread render_thread;
+
+    const std::thread::id main_id = std::this_thread::get_id();
+    std::thread::id start_id;
+    std::thread::id stop_id;
+    std::uint64_t next_frame = 0;
+    std::uint64_t wrong_order = 0;
+    std::uint64_t wrong_thread = 0;
+
+    render_thread.Start([&](RenderPacket& packet) {
+
+        wrong_order += packet.frame != next_frame++;
+        wrong_thread += std::this_thread::get_id() == main_id;
+
+        // a result computed from the payload
+        packet.submit_seconds = static_cast<double>(packet.trail.size());
+    },
+    true,
+    [&]() { start_id = std::this_thread::get_id(); },
+    [&]() { stop_id = std::this_thread::get_id(); });
+
+    CHECK(render_thread.IsThreaded());
+
+    std::uint64_t wrong_results = 0;
+
+    for (std::uint64_t frame = 0; frame < count; ++frame) {
+
+        RenderPacket& packet = render_thread.Acquire();
+
+        // the results of the frame it carried last
+        if (packet.rendered) {
+
+            wrong_results += packet.submit_seconds != static_cast<double>(packet.trail.size());
+        }
+
+        packet.frame = frame;
+        packet.trail.assign(frame % 7, 0.0f);
+
+        render_thread.Submit(packet);
+    }
+
+    render_thread.Stop();
+
+    CHECK(!render_thread.IsThreaded());
+    CHECK(next_frame == count);
+    CHECK(wrong_order == 0);
+    CHECK(wrong_thread == 0);
+    CHECK(wrong_results == 0);
+    CHECK(start_id != main_id && start_id == stop_id);
+
+    for (RenderPacket& packet : render_thread.Packets()) {
+
+        CHECK(packet.rendered);
+    }
+}
+
+TEST_CASE(InlineModeRendersOnSubmit) {
+
+    RenderThread render_thread(2);
+    int rendered = 0;
+    int context_calls = 0;
+
+    render_thread.Start([&](RenderPacket& packet) {
+
+        packet.frame += 100;
+        rendered += 1;
+    },
+    false,
+    [&]() { context_calls += 1; },
+    [&]() { context_calls += 1; });
+
+    CHECK(!render_thread.IsThreaded());
+
+    for (int frame = 0; frame < 5; ++frame) {
+
+        RenderPacket& packet = render_thread.Acquire();
+        packet.frame = frame;
+
+        render_thread.Submit(packet);
+
+        CHECK(rendered == frame + 1);
+        CHECK(packet.rendered && packet.frame == static_cast<std::uint64_t>(frame) + 100);
+    }
+
+    render_thread.Stop();
+
+    CHECK(render_thread.StallCount() == 0);
+    CHECK(context_calls == 0);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderCache.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ShaderCache.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+
+#include "ImageWriter.hpp"
+
+namespace Core {
+
+// the bytes in front of every entry's binary
+struct ShaderCacheEntryHeader {
+
+    std::uint32_t magic = SHADER_CACHE_MAGIC;
+    std::uint32_t version = SHADER_CACHE_VERSION;
+    ShaderCacheKey key = 0;
+    std::uint32_t format = 0;
+    std::uint32_t size = 0;
+    std::uint32_t crc = 0;
+    std::uint32_t reserved = 0;
+};
+
+static_assert(sizeof(ShaderCacheEntryHeader) == 32, "ShaderCacheEntryHeader is part of the file format");
+
+static void HashPart(ShaderCacheKey& hash, const char* text, std::size_t size) {
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+        hash ^= static_cast<std::uint8_t>(text[i]);
+        hash *= 1099511628211ull;
+    }
+
+    // the terminating 0 byte: x ^ 0 = x
+    hash *= 1099511628211ull;
+}
+
+ShaderCacheKey HashShaderSources(const char* vertex_source, const char* fragment_source,
+                                 const std::string& driver) {
+
+    ShaderCacheKey hash = 14695981039346656037ull;
+
+    HashPart(hash, vertex_source, std::strlen(vertex_source));
+    HashPart(hash, fragment_source, std::strlen(fragment_source));
+    HashPart(hash, driver.data(), driver.size());
+
+    return hash;
+}
+
+static bool WriteEntry(const std::string& path, const ShaderCacheEntryHeader& header, const ShaderBinary& binary) {
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if (!file) {
+
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(binary.data.data()), static_cast<std::streamsize>(binary.data.size()));
+
+    return static_cast<bool>(file);
+}
+
+std::string ShaderCache::EntryPath(ShaderCacheKey key) const {
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+
+    return (std::filesystem::path(directory) / name).string();
+}
+
+bool ShaderCache::Load(ShaderCacheKey key, ShaderBinary& binary) {
+
+    const std::string path = EntryPath(key);
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file) {
+
+        stats.misses += 1;
+        return false;
+    }
+
+    const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    ShaderCacheEntryHeader header;
+    bool valid = bytes.size() >= sizeof(header);
+
+    if (valid) {
+
+        std::memcpy(&header, bytes.data(), sizeof(header));
+
+        valid = header.magic == SHADER_CACHE_MAGIC && header.version == SHADER_CACHE_VERSION &&
+                header.key == key && header.size > 0 && header.size == bytes.size() - sizeof(header) &&
+                header.crc == Crc32(bytes.data() + sizeof(header), header.size);
+    }
+
+    if (!valid) {
+
+        std::error_code error;
+        std::filesystem::remove(path, error);
+
+        stats.misses += 1;
+        return false;
+    }
+
+    binary.format = header.format;
+    binary.data.assign(bytes.begin() + sizeof(header), bytes.end());
+
+    stats.hits += 1;
+    return true;
+}
+
+bool ShaderCache::Store(ShaderCacheKey key, const ShaderBinary& binary) {
+
+    if (binary.data.empty()) {
+
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    ShaderCacheEntryHeader header;
+    header.key = key;
+    header.format = binary.format;
+    header.size = static_cast<std::uint32_t>(binary.data.size());
+    header.crc = Crc32(binary.data.data(), binary.data.size());
+
+    // written aside and renamed, so another instance never reads half an entry
+    const std::string path = EntryPath(key);
+    const std::string temporary = path + ".tmp";
+
+    if (!WriteEntry(temporary, header, binary)) {
+
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    std::filesystem::rename(temporary, path, error);
+
+    if (error) {
+
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    stats.stores += 1;
+    return true;
+}
+
+void ShaderCache::Invalidate(ShaderCacheKey key) {
+
+    std::error_code error;
+    std::filesystem::remove(EntryPath(key), error);
+
+    stats.rejects += 1;
+}
+
+} // namespace Core
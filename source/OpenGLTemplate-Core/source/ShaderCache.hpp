@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderCache.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define SHADER_CACHE_MAGIC      0x48534342u     // "BCSH" in file order
+#define SHADER_CACHE_VERSION    1
+
+namespace Core {
+
+using ShaderCacheKey = std::uint64_t;
+
+// FNV-1a 64 of both stages and the driver; every part ends in a 0 byte, which
+// no source can contain, so moving text between the parts changes the key
+ShaderCacheKey HashShaderSources(const char* vertex_source, const char* fragment_source,
+                                 const std::string& driver);
+
+// a linked program as glGetProgramBinary returns it
+struct ShaderBinary {
+
+    std::uint32_t format = 0;
+    std::vector<std::uint8_t> data;
+};
+
+struct ShaderCacheStats {
+
+    std::size_t hits = 0;
+    std::size_t misses = 0;         // no entry, or a corrupt one
+    std::size_t stores = 0;
+    std::size_t rejects = 0;        // entries the driver would not load
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Shader Cache
+// --Linked program binaries on disk, one file per key in a directory. Keys
+//   cover the sources and the driver's vendor, renderer and version, so an
+//   edited shader or a driver update simply misses.
+// --Entries carry the key, binary format, size and a CRC; anything that does
+//   not match (truncated writes, an older cache version) is deleted on
+//   Load() and counts as a miss.
+// --A driver can still refuse a binary it wrote (e.g. a settings change);
+//   Invalidate() deletes the entry so the next launch compiles and stores
+//   it again.
+// --No GL calls: GLRenderDevice fills and reads ShaderBinary.
+////////////////////////////////////////////////////////////////////////////////
+class ShaderCache {
+
+public:
+    // created on the first Store()
+    void SetDirectory(const std::string& path) { directory = path; }
+    const std::string& Directory() const { return directory; }
+
+    bool Load(ShaderCacheKey key, ShaderBinary& binary);
+    bool Store(ShaderCacheKey key, const ShaderBinary& binary);
+    void Invalidate(ShaderCacheKey key);
+
+    std::string EntryPath(ShaderCacheKey key) const;
+
+    const ShaderCacheStats& Stats() const { return stats; }
+
+private:
+    std::string directory = "shader_cache";
+    ShaderCacheStats stats;
+};
+
+} // namespace Core
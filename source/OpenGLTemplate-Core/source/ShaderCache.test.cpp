@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderCache.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ShaderCache.hpp"
+#include "UnitTest.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace Core;
+
+static const char* CACHE_DIRECTORY = "ShaderCache.test.dir";
+static const std::string DRIVER = "Vendor|Renderer 9000|4.6.0 Driver 1.2|";
+
+static ShaderBinary MakeBinary(std::uint32_t format, std::size_t size) {
+
+    ShaderBinary binary;
+    binary.format = format;
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+        binary.data.push_back(static_cast<std::uint8_t>(i * 7 + 3));
+    }
+
+    return binary;
+}
+
+static std::vector<char> ReadFile(const std::string& path) {
+
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+static void WriteFile(const std::string& path, const std::vector<char>& bytes) {
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+TEST_CASE(KeysCoverSourcesAndDriver) {
+
+    const ShaderCacheKey key = HashShaderSources("void main() {}", "out vec4 c;", DRIVER);
+
+    CHECK(key == HashShaderSources("void main() {}", "out vec4 c;", DRIVER));
+    CHECK(key != HashShaderSources("void main() { }", "out vec4 c;", DRIVER));
+    CHECK(key != HashShaderSources("void main() {}", "out vec4 d;", DRIVER));
+
+    // a driver update misses instead of loading a stale binary
+    CHECK(key != HashShaderSources("void main() {}", "out vec4 c;", "Vendor|Renderer 9000|4.6.0 Driver 1.3|"));
+
+    // text moved from one stage to the other
+    CHECK(HashShaderSources("ab", "c", DRIVER) != HashShaderSources("a", "bc", DRIVER));
+}
+
+TEST_CASE(StoredBinariesLoadBack) {
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+
+    ShaderCache cache;
+    cache.SetDirectory(CACHE_DIRECTORY);
+
+    const ShaderCacheKey key = HashShaderSources("vertex", "fragment", DRIVER);
+    const ShaderBinary stored = MakeBinary(0x8741, 300);
+
+    ShaderBinary loaded;
+    CHECK(!cache.Load(key, loaded));
+    CHECK(cache.Stats().misses == 1);
+
+    CHECK(cache.Store(key, stored));
+    CHECK(std::filesystem::exists(cache.EntryPath(key)));
+
+    CHECK(cache.Load(key, loaded));
+    CHECK(loaded.format == stored.format);
+    CHECK(loaded.data == stored.data);
+    CHECK(cache.Stats().hits == 1);
+    CHECK(cache.Stats().stores == 1);
+
+    // another program does not see it
+    CHECK(!cache.Load(HashShaderSources("vertex", "other", DRIVER), loaded));
+
+    CHECK(!cache.Store(key, ShaderBinary{}));
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+}
+
+TEST_CASE(DamagedEntriesAreDeleted) {
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+
+    ShaderCache cache;
+    cache.SetDirectory(CACHE_DIRECTORY);
+
+    const ShaderCacheKey key = HashShaderSources("vertex", "fragment", DRIVER);
+    const std::string path = cache.EntryPath(key);
+    ShaderBinary loaded;
+
+    cache.Store(key, MakeBinary(1, 64));
+    const std::vector<char> valid = ReadFile(path);
+
+    // truncated write
+    WriteFile(path, std::vector<char>(valid.begin(), valid.end() - 1));
+    CHECK(!cache.Load(key, loaded));
+    CHECK(!std::filesystem::exists(path));
+
+    // flipped bit in the binary
+    std::vector<char> corrupt = valid;
+    corrupt.back() ^= 0x10;
+    WriteFile(path, corrupt);
+    CHECK(!cache.Load(key, loaded));
+    CHECK(!std::filesystem::exists(path));
+
+    // entry from an older cache version (the version follows the magic)
+    std::vector<char> old_version = valid;
+    old_version[4] -= 1;
+    WriteFile(path, old_version);
+    CHECK(!cache.Load(key, loaded));
+
+    // an entry copied to another key's name
+    WriteFile(path, valid);
+    const ShaderCacheKey other = HashShaderSources("vertex", "fragment 2", DRIVER);
+    std::filesystem::rename(path, cache.EntryPath(other));
+    CHECK(!cache.Load(other, loaded));
+
+    CHECK(cache.Stats().misses == 4);
+    CHECK(cache.Stats().hits == 0);
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+}
+
+TEST_CASE(RejectedBinariesAreInvalidated) {
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+
+    ShaderCache cache;
+    cache.SetDirectory(CACHE_DIRECTORY);
+
+    const ShaderCacheKey key = HashShaderSources("vertex", "fragment", DRIVER);
+    ShaderBinary loaded;
+
+    cache.Store(key, MakeBinary(1, 64));
+    CHECK(cache.Load(key, loaded));
+
+    // what GLRenderDevice does when glProgramBinary fails to link
+    cache.Invalidate(key);
+    CHECK(cache.Stats().rejects == 1);
+    CHECK(!cache.Load(key, loaded));
+
+    // recompiled and stored again
+    CHECK(cache.Store(key, MakeBinary(2, 80)));
+    CHECK(cache.Load(key, loaded));
+    CHECK(loaded.format == 2);
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,285 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderProgram.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ShaderProgram.hpp"
+#include "Logger.hpp"
+
+#include <glad/glad.h>
+
+#define INFOLOG_SIZE        512
+#define NAME_BUFFER_SIZE    256
+
+namespace Core {
+
+static unsigned int StartShader(GLenum stage, const char* source) {
+
+    unsigned int shader = glCreateShader(stage);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    return shader;
+}
+
+static bool CheckShader(unsigned int shader, const char* stage_name) {
+
+    int success = 0;
+    char info_log[INFOLOG_SIZE];
+
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (!success) {
+
+        glGetShaderInfoLog(shader, INFOLOG_SIZE, nullptr, info_log);
+        LOG_ERROR("%s Shader Compilation Failed: %s", stage_name, info_log);
+    }
+
+    return success != 0;
+}
+
+bool ShaderProgram::BinariesSupported() {
+
+    return GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary;
+}
+
+bool ShaderProgram::ParallelCompileSupported() {
+
+#ifdef GL_KHR_parallel_shader_compile
+    if (GLAD_GL_KHR_parallel_shader_compile) {
+
+        return true;
+    }
+#endif
+
+    return GLAD_GL_ARB_parallel_shader_compile;
+}
+
+bool ShaderProgram::Create(const char* vertex_source, const char* fragment_source) {
+
+    Begin(vertex_source, fragment_source);
+    return Finish();
+}
+
+void ShaderProgram::Begin(const char* vertex_source, const char* fragment_source, bool retrievable) {
+
+    vertex_shader = StartShader(GL_VERTEX_SHADER, vertex_source);
+    fragment_shader = StartShader(GL_FRAGMENT_SHADER, fragment_source);
+
+    program = glCreateProgram();
+
+    if (retrievable && BinariesSupported()) {
+
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    // status is only queried in Finish(), a query here would wait for the link
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    glLinkProgram(program);
+}
+
+bool ShaderProgram::IsReady() const {
+
+    if (vertex_shader == 0 || !ParallelCompileSupported()) {
+
+        return true;
+    }
+
+    // GL_COMPLETION_STATUS_KHR is the same enum
+    int complete = 0;
+    glGetProgramiv(program, GL_COMPLETION_STATUS_ARB, &complete);
+
+    return complete != 0;
+}
+
+bool ShaderProgram::Finish() {
+
+    if (vertex_shader == 0) {
+
+        return program != 0;
+    }
+
+    int success = 0;
+    char info_log[INFOLOG_SIZE];
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (!success) {
+
+        // the stage logs usually say why the link failed
+        CheckShader(vertex_shader, "Vertex");
+        CheckShader(fragment_shader, "Fragment");
+    }
+
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    vertex_shader = 0;
+    fragment_shader = 0;
+
+    if (!success) {
+
+        glGetProgramInfoLog(program, INFOLOG_SIZE, nullptr, info_log);
+        LOG_ERROR("Shader Program Linking Failed: %s", info_log);
+        return false;
+    }
+
+    Reflect();
+    return true;
+}
+
+bool ShaderProgram::CreateFromBinary(const ShaderBinary& binary) {
+
+    if (!BinariesSupported() || binary.data.empty()) {
+
+        return false;
+    }
+
+    program = glCreateProgram();
+    glProgramBinary(program, binary.format, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
+
+    int success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (!success) {
+
+        Destroy();
+        return false;
+    }
+
+    Reflect();
+    return true;
+}
+
+bool ShaderProgram::GetBinary(ShaderBinary& binary) const {
+
+    if (!BinariesSupported() || program == 0) {
+
+        return false;
+    }
+
+    int length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+    if (length <= 0) {
+
+        return false;
+    }
+
+    GLenum format = 0;
+    GLsizei written = 0;
+
+    binary.data.resize(static_cast<std::size_t>(length));
+    glGetProgramBinary(program, length, &written, &format, binary.data.data());
+
+    binary.format = format;
+    binary.data.resize(static_cast<std::size_t>(written));
+
+    return written > 0;
+}
+
+void ShaderProgram::Destroy() {
+
+    if (vertex_shader != 0) {
+
+        glDeleteShader(vertex_shader);
+        glDeleteShader(fragment_shader);
+        vertex_shader = 0;
+        fragment_shader = 0;
+    }
+
+    glDeleteProgram(program);
+    program = 0;
+
+    uniforms.Clear();
+    attributes.Clear();
+    uniform_blocks.Clear();
+}
+
+void ShaderProgram::Use() const {
+
+    glUseProgram(program);
+}
+
+bool ShaderProgram::BindUniformBlock(NameHash block_name, unsigned int binding) const {
+
+    const ReflectedVariable* block = uniform_blocks.Find(block_name);
+
+    if (!block) {
+
+        return false;
+    }
+
+    glUniformBlockBinding(program, static_cast<GLuint>(block->location), binding);
+    return true;
+}
+
+void ShaderProgram::SetMat4(NameHash name, const float* value) const {
+
+    glUniformMatrix4fv(uniforms.Location(name), 1, GL_FALSE, value);
+}
+
+void ShaderProgram::SetVec4(NameHash name, const float* value) const {
+
+    glUniform4fv(uniforms.Location(name), 1, value);
+}
+
+void ShaderProgram::SetFloat(NameHash name, float value) const {
+
+    glUniform1f(uniforms.Location(name), value);
+}
+
+void ShaderProgram::Reflect() {
+
+    char name[NAME_BUFFER_SIZE];
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = 0;
+
+    int uniform_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
+
+    for (int i = 0; i < uniform_count; ++i) {
+
+        glGetActiveUniform(program, i, NAME_BUFFER_SIZE, &length, &size, &type, name);
+
+        // members of uniform blocks have no location; they are set via buffers
+        int location = glGetUniformLocation(program, name);
+
+        if (location < 0) {
+
+            continue;
+        }
+
+        uniforms.Insert(NormalizeUniformName({name, static_cast<std::size_t>(length)}),
+                        location, type, size);
+    }
+
+    int attribute_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &attribute_count);
+
+    for (int i = 0; i < attribute_count; ++i) {
+
+        glGetActiveAttrib(program, i, NAME_BUFFER_SIZE, &length, &size, &type, name);
+
+        attributes.Insert({name, static_cast<std::size_t>(length)},
+                          glGetAttribLocation(program, name), type, size);
+    }
+
+    int block_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &block_count);
+
+    for (int i = 0; i < block_count; ++i) {
+
+        GLint data_size = 0;
+        glGetActiveUniformBlockName(program, i, NAME_BUFFER_SIZE, &length, name);
+        glGetActiveUniformBlockiv(program, i, GL_UNIFORM_BLOCK_DATA_SIZE, &data_size);
+
+        uniform_blocks.Insert({name, static_cast<std::size_t>(length)}, i, 0, data_size);
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderProgram.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ShaderCache.hpp"
+#include "ShaderReflection.hpp"
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Shader Program
+// --Compiles and links a vertex/fragment pair, then reflects every active
+//   uniform, attribute and uniform block once into hashed lookup tables.
+// --Begin() only issues the compile and link. With KHR_parallel_shader_compile
+//   the driver works on other threads until Finish(); without it the work
+//   may still be deferred by the driver to the first status query.
+// --Linked programs can be saved and restored with GetBinary() and
+//   CreateFromBinary() (GL 4.1 or ARB_get_program_binary, see ShaderCache).
+////////////////////////////////////////////////////////////////////////////////
+class ShaderProgram {
+
+public:
+    // Begin() then Finish()
+    bool Create(const char* vertex_source, const char* fragment_source);
+
+    // retrievable asks the driver to keep the binary for GetBinary()
+    void Begin(const char* vertex_source, const char* fragment_source, bool retrievable = false);
+    bool IsReady() const;   // Finish() would not block
+    bool Finish();          // false if compiling or linking failed
+
+    // false if the driver rejects the binary, the program is then destroyed
+    bool CreateFromBinary(const ShaderBinary& binary);
+    bool GetBinary(ShaderBinary& binary) const;
+
+    static bool BinariesSupported();
+    static bool ParallelCompileSupported();
+
+    void Destroy();
+
+    void Use() const;
+    unsigned int Id() const { return program; }
+
+    int UniformLocation(NameHash name) const { return uniforms.Location(name); }
+    int AttributeLocation(NameHash name) const { return attributes.Location(name); }
+
+    // returns false if the program has no active block with that name
+    bool BindUniformBlock(NameHash block_name, unsigned int binding) const;
+
+    void SetMat4(NameHash name, const float* value) const;
+    void SetVec4(NameHash name, const float* value) const;
+    void SetFloat(NameHash name, float value) const;
+
+    const ReflectionTable& Uniforms() const { return uniforms; }
+    const ReflectionTable& Attributes() const { return attributes; }
+    const ReflectionTable& UniformBlocks() const { return uniform_blocks; }
+
+private:
+    void Reflect();
+
+    unsigned int program{};
+    unsigned int vertex_shader{};       // only between Begin() and Finish()
+    unsigned int fragment_shader{};
+
+    ReflectionTable uniforms;
+    ReflectionTable attributes;
+    ReflectionTable uniform_blocks;
+};
+
+} // namespace Core
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderReflection.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ShaderReflection.hpp"
+
+namespace Core {
+
+bool ReflectionTable::Insert(std::string_view name, int location, unsigned int type, int size) {
+
+    // keep the load factor at or below one half
+    if ((count + 1) * 2 > slots.size()) {
+
+        Grow();
+    }
+
+    const NameHash hash = HashName(name);
+    const std::size_t mask = slots.size() - 1;
+
+    for (std::size_t i = hash & mask; ; i = (i + 1) & mask) {
+
+        if (!occupied[i]) {
+
+            slots[i] = ReflectedVariable{hash, location, type, size};
+            occupied[i] = true;
+            count += 1;
+            return true;
+        }
+
+        if (slots[i].hash == hash) {
+
+            return false;
+        }
+    }
+}
+
+const ReflectedVariable* ReflectionTable::Find(NameHash hash) const {
+
+    if (slots.empty()) {
+
+        return nullptr;
+    }
+
+    const std::size_t mask = slots.size() - 1;
+
+    for (std::size_t i = hash & mask; occupied[i]; i = (i + 1) & mask) {
+
+        if (slots[i].hash == hash) {
+
+            return &slots[i];
+        }
+    }
+
+    return nullptr;
+}
+
+int ReflectionTable::Location(NameHash hash) const {
+
+    const ReflectedVariable* variable = Find(hash);
+    return variable ? variable->location : -1;
+}
+
+void ReflectionTable::Clear() {
+
+    slots.clear();
+    occupied.clear();
+    count = 0;
+}
+
+void ReflectionTable::Grow() {
+
+    std::vector<ReflectedVariable> old_slots = std::move(slots);
+    std::vector<bool> old_occupied = std::move(occupied);
+
+    const std::size_t new_size = old_slots.empty() ? 16 : old_slots.size() * 2;
+
+    slots.assign(new_size, ReflectedVariable{});
+    occupied.assign(new_size, false);
+
+    const std::size_t mask = new_size - 1;
+
+    for (std::size_t j = 0; j < old_slots.size(); ++j) {
+
+        if (!old_occupied[j]) {
+
+            continue;
+        }
+
+        std::size_t i = old_slots[j].hash & mask;
+
+        while (occupied[i]) {
+
+            i = (i + 1) & mask;
+        }
+
+        slots[i] = old_slots[j];
+        occupied[i] = true;
+    }
+}
+
+std::string_view NormalizeUniformName(std::string_view name) {
+
+    constexpr std::string_view array_suffix = "[0]";
+
+    if (name.size() > array_suffix.size() &&
+        name.substr(name.size() - array_suffix.size()) == array_suffix) {
+
+        return name.substr(0, name.size() - array_suffix.size());
+    }
+
+    return name;
+}
+
+} // namespace Core
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderReflection.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Core {
+
+using NameHash = std::uint32_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Name Hashing
+// --FNV-1a, constexpr so call sites can hash uniform names at compile time.
+////////////////////////////////////////////////////////////////////////////////
+constexpr NameHash HashName(std::string_view name) {
+
+    NameHash hash = 2166136261u;
+
+    for (char c : name) {
+
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+struct ReflectedVariable {
+
+    NameHash hash = 0;
+    int location = -1;      // uniform/attribute location, or block index
+    unsigned int type = 0;  // GL type enum, 0 for uniform blocks
+    int size = 0;           // array size, or block data size in bytes
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Reflection Table
+// --Open addressing table keyed by NameHash, filled once at link time.
+// --Lookups never touch the driver or compare strings.
+////////////////////////////////////////////////////////////////////////////////
+class ReflectionTable {
+
+public:
+    // returns false if the name (or a colliding name) is already present
+    bool Insert(std::string_view name, int location, unsigned int type, int size);
+
+    const ReflectedVariable* Find(NameHash hash) const;
+    int Location(NameHash hash) const;
+
+    std::size_t Size() const { return count; }
+    void Clear();
+
+private:
+    void Grow();
+
+    std::vector<ReflectedVariable> slots;
+    std::vector<bool> occupied;
+    std::size_t count = 0;
+};
+
+// strips a trailing "[0]" that GL reports for array uniforms
+std::string_view NormalizeUniformName(std::string_view name);
+
+} // namespace Core
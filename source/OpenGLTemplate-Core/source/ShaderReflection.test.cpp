@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShaderReflection.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ShaderReflection.hpp"
+#include "UnitTest.hpp"
+
+#include <string>
+
+using namespace Core;
+
+TEST_CASE(HashNameIsCompileTimeConstant) {
+
+    constexpr NameHash hash = HashName("u_Model_mat");
+    static_assert(hash == HashName("u_Model_mat"), "hash must be deterministic");
+    static_assert(HashName("") == 2166136261u, "empty string hashes to the FNV offset basis");
+
+    CHECK(hash != HashName("u_Color_vec"));
+}
+
+TEST_CASE(InsertedNamesResolveToLocations) {
+
+    ReflectionTable table;
+
+    CHECK(table.Insert("u_Model_mat", 3, 0x8B5C, 1));
+    CHECK(table.Insert("u_Color_vec", 7, 0x8B52, 1));
+
+    CHECK(table.Size() == 2);
+    CHECK(table.Location(HashName("u_Model_mat")) == 3);
+    CHECK(table.Location(HashName("u_Color_vec")) == 7);
+
+    const ReflectedVariable* color = table.Find(HashName("u_Color_vec"));
+    CHECK(color != nullptr);
+    CHECK(color->type == 0x8B52);
+}
+
+TEST_CASE(MissingNamesReturnInvalidLocation) {
+
+    ReflectionTable table;
+    CHECK(table.Location(HashName("u_Missing")) == -1);
+    CHECK(table.Find(HashName("u_Missing")) == nullptr);
+
+    table.Insert("u_Present", 0, 0, 1);
+    CHECK(table.Location(HashName("u_Missing")) == -1);
+}
+
+TEST_CASE(DuplicateInsertIsRejected) {
+
+    ReflectionTable table;
+
+    CHECK(table.Insert("u_Model_mat", 1, 0, 1));
+    CHECK(!table.Insert("u_Model_mat", 2, 0, 1));
+    CHECK(table.Location(HashName("u_Model_mat")) == 1);
+    CHECK(table.Size() == 1);
+}
+
+TEST_CASE(TableGrowsAndKeepsEntries) {
+
+    ReflectionTable table;
+
+    for (int i = 0; i < 200; ++i) {
+
+        CHECK(table.Insert("u_Value_" + std::to_string(i), i, 0, 1));
+    }
+
+    CHECK(table.Size() == 200);
+
+    for (int i = 0; i < 200; ++i) {
+
+        CHECK(table.Location(HashName("u_Value_" + std::to_string(i))) == i);
+    }
+
+    table.Clear();
+    CHECK(table.Size() == 0);
+    CHECK(table.Location(HashName("u_Value_0")) == -1);
+}
+
+TEST_CASE(ArrayUniformNamesAreNormalized) {
+
+    CHECK(NormalizeUniformName("u_Lights[0]") == "u_Lights");
+    CHECK(NormalizeUniformName("u_Model_mat") == "u_Model_mat");
+    CHECK(NormalizeUniformName("[0]") == "[0]");
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShapeGenerator.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Compile-Time Math
+// --std::sin and std::cos are not constexpr in C++17. These use range
+//   reduction and a Taylor series in double, accurate to about 1e-12 before
+//   the final float rounding.
+////////////////////////////////////////////////////////////////////////////////
+constexpr double SHAPE_PI = 3.14159265358979323846;
+
+constexpr double ConstexprSin(double radians) {
+
+    // reduce to [-pi, pi], then to [-pi/2, pi/2] with sin(pi - x) = sin(x)
+    const double turns = radians / (2.0 * SHAPE_PI);
+    const long long whole = static_cast<long long>(turns < 0.0 ? turns - 0.5 : turns + 0.5);
+
+    double x = radians - static_cast<double>(whole) * 2.0 * SHAPE_PI;
+
+    if (x > SHAPE_PI / 2.0) {
+
+        x = SHAPE_PI - x;
+    }
+    else if (x < -SHAPE_PI / 2.0) {
+
+        x = -SHAPE_PI - x;
+    }
+
+    double term = x;
+    double sum = x;
+
+    for (int n = 1; n < 12; ++n) {
+
+        term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+        sum += term;
+    }
+
+    return sum;
+}
+
+constexpr double ConstexprCos(double radians) {
+
+    return ConstexprSin(radians + SHAPE_PI / 2.0);
+}
+
+constexpr double ConstexprSqrt(double value) {
+
+    if (value <= 0.0) {
+
+        return 0.0;
+    }
+
+    double guess = value < 1.0 ? 1.0 : value;
+
+    for (int i = 0; i < 64; ++i) {
+
+        guess = 0.5 * (guess + value / guess);
+    }
+
+    return guess;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Shape Generator
+// --Builds model line lists at compile time, in the same GL_LINES authoring
+//   format as Models.hpp (vertex pairs, 3 floats per vertex, z = 0), so
+//   constexpr results are plain rodata and need no startup work.
+// --Every segment starts on the exact vertex the previous one ended on, so
+//   BuildIndexedMesh() turns each shape into a single line strip.
+////////////////////////////////////////////////////////////////////////////////
+template <std::size_t N>
+using LineList = std::array<float, N * 6>;      // N segments
+
+namespace Shape {
+
+// writes segment index from (x0, y0) to (x1, y1)
+template <std::size_t S>
+constexpr void SetSegment(std::array<float, S>& lines, std::size_t index,
+                          float x0, float y0, float x1, float y1) {
+
+    lines[index * 6 + 0] = x0;
+    lines[index * 6 + 1] = y0;
+    lines[index * 6 + 2] = 0.0f;
+    lines[index * 6 + 3] = x1;
+    lines[index * 6 + 4] = y1;
+    lines[index * 6 + 5] = 0.0f;
+}
+
+// N segments along a circular arc from start_angle, counterclockwise by sweep
+template <std::size_t N>
+constexpr LineList<N> Arc(float radius, float start_angle, float sweep,
+                          float center_x = 0.0f, float center_y = 0.0f) {
+
+    static_assert(N > 0, "an arc needs at least one segment");
+
+    LineList<N> lines {};
+
+    float x0 = center_x + static_cast<float>(radius * ConstexprCos(start_angle));
+    float y0 = center_y + static_cast<float>(radius * ConstexprSin(start_angle));
+
+    for (std::size_t i = 1; i <= N; ++i) {
+
+        const double angle = start_angle + static_cast<double>(sweep) * i / N;
+
+        const float x1 = center_x + static_cast<float>(radius * ConstexprCos(angle));
+        const float y1 = center_y + static_cast<float>(radius * ConstexprSin(angle));
+
+        SetSegment(lines, i - 1, x0, y0, x1, y1);
+
+        x0 = x1;
+        y0 = y1;
+    }
+
+    return lines;
+}
+
+// closed regular N-gon on a circle of radius, first vertex at start_angle
+template <std::size_t N>
+constexpr LineList<N> RegularPolygon(float radius, float start_angle = 0.0f) {
+
+    static_assert(N >= 3, "a polygon needs at least three sides");
+
+    LineList<N> lines = Arc<N>(radius, start_angle, static_cast<float>(2.0 * SHAPE_PI));
+
+    // close on the exact first vertex rather than its rounded 2 pi twin
+    lines[N * 6 - 3] = lines[0];
+    lines[N * 6 - 2] = lines[1];
+
+    return lines;
+}
+
+// axis-aligned rectangle centered on the origin with N segments per corner,
+// N = 0 gives a plain rectangle
+template <std::size_t N>
+constexpr LineList<4 * N + 4> RoundedRectangle(float width, float height, float corner_radius) {
+
+    LineList<4 * N + 4> lines {};
+
+    const float inner_x = width / 2.0f - corner_radius;
+    const float inner_y = height / 2.0f - corner_radius;
+
+    // corner centers counterclockwise from the top right
+    const float centers[4][2] = {
+        { inner_x,  inner_y},
+        {-inner_x,  inner_y},
+        {-inner_x, -inner_y},
+        { inner_x, -inner_y},
+    };
+
+    // corner k turns from k * 90 degrees to (k + 1) * 90 degrees
+    auto corner_point = [&](std::size_t corner, std::size_t quarter) {
+
+        const double angle = SHAPE_PI / 2.0 * quarter;
+
+        return std::array<float, 2> {
+            centers[corner][0] + static_cast<float>(corner_radius * ConstexprCos(angle)),
+            centers[corner][1] + static_cast<float>(corner_radius * ConstexprSin(angle)),
+        };
+    };
+
+    std::size_t segment = 0;
+    std::array<float, 2> edge_start {};
+
+    for (std::size_t corner = 0; corner < 4; ++corner) {
+
+        if constexpr (N > 0) {
+
+            const std::array<float, 2> arc_start = corner_point(corner, corner);
+
+            float x0 = arc_start[0];
+            float y0 = arc_start[1];
+
+            for (std::size_t i = 1; i <= N; ++i) {
+
+                const double angle = SHAPE_PI / 2.0 * (corner + static_cast<double>(i) / N);
+
+                const float x1 = centers[corner][0] + static_cast<float>(corner_radius * ConstexprCos(angle));
+                const float y1 = centers[corner][1] + static_cast<float>(corner_radius * ConstexprSin(angle));
+
+                SetSegment(lines, segment++, x0, y0, x1, y1);
+
+                x0 = x1;
+                y0 = y1;
+            }
+
+            edge_start = {x0, y0};
+        }
+        else {
+
+            edge_start = corner_point(corner, corner + 1);
+        }
+
+        // straight edge to where the next corner starts
+        const std::size_t next = (corner + 1) % 4;
+        const std::array<float, 2> edge_end = corner_point(next, next);
+
+        SetSegment(lines, segment++, edge_start[0], edge_start[1], edge_end[0], edge_end[1]);
+    }
+
+    // close on the exact first vertex
+    lines[segment * 6 - 3] = lines[0];
+    lines[segment * 6 - 2] = lines[1];
+
+    return lines;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Compile-Time Checks
+////////////////////////////////////////////////////////////////////////////////
+template <std::size_t S>
+constexpr std::size_t SegmentCount(const std::array<float, S>&) {
+
+    static_assert(S % 6 == 0, "line lists hold whole segments");
+    return S / 6;
+}
+
+// every segment starts where the previous one ended
+template <std::size_t S>
+constexpr bool IsConnected(const std::array<float, S>& lines) {
+
+    for (std::size_t i = 1; i < S / 6; ++i) {
+
+        if (lines[i * 6] != lines[i * 6 - 3] || lines[i * 6 + 1] != lines[i * 6 - 2]) {
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// connected, and the last segment ends on the first vertex
+template <std::size_t S>
+constexpr bool IsClosed(const std::array<float, S>& lines) {
+
+    return IsConnected(lines) && lines[S - 3] == lines[0] && lines[S - 2] == lines[1];
+}
+
+} // namespace Shape
+
+} // namespace Core
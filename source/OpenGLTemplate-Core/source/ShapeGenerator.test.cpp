@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: ShapeGenerator.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "ShapeGenerator.hpp"
+#include "IndexedMesh.hpp"
+#include "Models.hpp"
+#include "UnitTest.hpp"
+
+#include <cmath>
+
+using namespace Core;
+
+////////////////////////////////////////////////////////////////////////////////
+// Compile-Time Checks
+// --These fail the build, not the test run.
+////////////////////////////////////////////////////////////////////////////////
+constexpr auto pentagon = Shape::RegularPolygon<5>(10.0f);
+constexpr auto quarter_arc = Shape::Arc<8>(10.0f, 0.0f, static_cast<float>(SHAPE_PI / 2.0));
+constexpr auto pill = Shape::RoundedRectangle<4>(60.0f, 20.0f, 10.0f);
+
+static_assert(Shape::SegmentCount(pentagon) == 5, "one segment per side");
+static_assert(Shape::SegmentCount(quarter_arc) == 8, "N segments per arc");
+static_assert(Shape::SegmentCount(pill) == 4 * 4 + 4, "four corners and four edges");
+static_assert(Shape::SegmentCount(square_vertices) == 4, "square has four sides");
+static_assert(Shape::SegmentCount(circle_vertices) == CIRCLE_SEGMENTS, "circle segment count");
+
+static_assert(Shape::IsClosed(pentagon), "polygons close on their first vertex");
+static_assert(Shape::IsClosed(pill), "rounded rectangles close on their first vertex");
+static_assert(Shape::IsConnected(quarter_arc) && !Shape::IsClosed(quarter_arc), "arcs stay open");
+
+static_assert(pentagon[0] == 10.0f && pentagon[1] == 0.0f, "first vertex at start_angle");
+static_assert(quarter_arc[quarter_arc.size() - 3] < 1e-5f && quarter_arc[quarter_arc.size() - 2] > 9.9999f,
+              "quarter arc ends on the y axis");
+
+TEST_CASE(ConstexprTrigMatchesTheStandardLibrary) {
+
+    for (double radians = -20.0; radians < 20.0; radians += 0.37) {
+
+        CHECK_NEAR(ConstexprSin(radians), std::sin(radians), 1e-9);
+        CHECK_NEAR(ConstexprCos(radians), std::cos(radians), 1e-9);
+    }
+
+    for (double value : {0.0, 0.25, 2.0, 3.0, 12345.0}) {
+
+        CHECK_NEAR(ConstexprSqrt(value), std::sqrt(value), 1e-9);
+    }
+}
+
+TEST_CASE(PolygonVerticesLieOnTheCircle) {
+
+    for (std::size_t i = 0; i < hexagon_vertices.size(); i += 3) {
+
+        CHECK_NEAR(std::hypot(hexagon_vertices[i], hexagon_vertices[i + 1]), MODEL_LENGTH / 2.0f, 1e-4f);
+    }
+
+    // the triangle points up
+    CHECK_NEAR(triangle_vertices[0], 0.0f, 1e-5f);
+    CHECK_NEAR(triangle_vertices[1], MODEL_LENGTH / 2.0f, 1e-5f);
+}
+
+TEST_CASE(RoundedRectangleStaysInsideItsBounds) {
+
+    float max_x = 0.0f;
+    float max_y = 0.0f;
+
+    for (std::size_t i = 0; i < pill.size(); i += 3) {
+
+        max_x = std::fmax(max_x, std::fabs(pill[i]));
+        max_y = std::fmax(max_y, std::fabs(pill[i + 1]));
+    }
+
+    CHECK_NEAR(max_x, 30.0f, 1e-4f);
+    CHECK_NEAR(max_y, 10.0f, 1e-4f);
+
+    // corner segments lie on circles of the corner radius around (+-20, 0)
+    CHECK_NEAR(std::hypot(pill[3] - 20.0f, pill[4]), 10.0f, 1e-4f);
+}
+
+TEST_CASE(ClosedShapesIndexIntoOneStrip) {
+
+    const IndexedMesh circle = BuildIndexedMesh(circle_vertices.data(), circle_vertices.size());
+    const IndexedMesh rounded = BuildIndexedMesh(pill.data(), pill.size());
+
+    CHECK(circle.vertices.size() == CIRCLE_SEGMENTS);
+    CHECK(circle.indices.size() == CIRCLE_SEGMENTS + 1);
+    CHECK(circle.indices.front() == circle.indices.back());
+
+    CHECK(rounded.indices.front() == rounded.indices.back());
+
+    for (std::uint16_t index : rounded.indices) {
+
+        CHECK(index != PRIMITIVE_RESTART_INDEX);
+    }
+}
+
+int main() { return Core::Test::RunAll(); }
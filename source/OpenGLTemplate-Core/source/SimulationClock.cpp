@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SimulationClock.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SimulationClock.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core {
+
+SimulationClock::SimulationClock(double tick_rate, int max_steps)
+    : step_seconds(1.0 / tick_rate), max_steps_per_frame(std::max(max_steps, 1)) {
+
+}
+
+void SimulationClock::SetTickRate(double tick_rate) {
+
+    // keep the same interpolation position at the new step length
+    const double alpha = accumulator / step_seconds;
+
+    step_seconds = 1.0 / tick_rate;
+    accumulator = alpha * step_seconds;
+}
+
+void SimulationClock::SetMaxStepsPerFrame(int max_steps) {
+
+    max_steps_per_frame = std::max(max_steps, 1);
+}
+
+int SimulationClock::Advance(double elapsed_seconds) {
+
+    accumulator += std::max(elapsed_seconds, 0.0);
+
+    const double available_steps = std::floor(accumulator / step_seconds);
+
+    int steps = static_cast<int>(std::min(available_steps, static_cast<double>(max_steps_per_frame)));
+
+    if (available_steps > steps) {
+
+        // drop the backlog but keep the fractional remainder for interpolation
+        dropped_steps += static_cast<std::uint64_t>(available_steps) - steps;
+        accumulator -= (available_steps - steps) * step_seconds;
+    }
+
+    accumulator -= steps * step_seconds;
+
+    // guard against rounding leaving the accumulator a hair outside [0, step)
+    if (accumulator < 0.0) {
+
+        accumulator = 0.0;
+    }
+    else if (accumulator >= step_seconds) {
+
+        accumulator = std::nextafter(step_seconds, 0.0);
+    }
+
+    tick_count += steps;
+    return steps;
+}
+
+void SimulationClock::Reset() {
+
+    accumulator = 0.0;
+    tick_count = 0;
+    dropped_steps = 0;
+}
+
+} // namespace Core
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SimulationClock.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+
+#define SIMULATION_TICK_RATE        60.0    // fixed steps per second
+#define SIMULATION_MAX_CATCH_UP     5       // fixed steps per frame before time is dropped
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Simulation Clock
+// --Fixed timestep accumulator: each frame adds the real elapsed time and
+//   Advance() returns how many fixed steps to simulate. The remainder is
+//   carried over, and Alpha() is how far rendering sits between the last
+//   two simulated states.
+// --After a hitch at most max_steps_per_frame steps run; the rest of the
+//   backlog is dropped instead of spiraling into ever longer frames.
+// --Simulation results only depend on the number of steps, so runs with
+//   the same tick count are deterministic regardless of frame rate.
+////////////////////////////////////////////////////////////////////////////////
+class SimulationClock {
+
+public:
+    explicit SimulationClock(double tick_rate = SIMULATION_TICK_RATE,
+                             int max_steps_per_frame = SIMULATION_MAX_CATCH_UP);
+
+    void SetTickRate(double tick_rate);
+    void SetMaxStepsPerFrame(int max_steps);
+
+    double TickRate() const { return 1.0 / step_seconds; }
+    double StepSeconds() const { return step_seconds; }
+
+    // adds elapsed real time and returns the number of steps to run now
+    int Advance(double elapsed_seconds);
+
+    // interpolation factor in [0, 1) between the previous and current step
+    float Alpha() const { return static_cast<float>(accumulator / step_seconds); }
+
+    std::uint64_t TickCount() const { return tick_count; }
+    std::uint64_t DroppedSteps() const { return dropped_steps; }
+
+    void Reset();
+
+private:
+    double step_seconds;
+    int max_steps_per_frame;
+
+    double accumulator = 0.0;
+
+    std::uint64_t tick_count = 0;
+    std::uint64_t dropped_steps = 0;
+};
+
+} // namespace Core
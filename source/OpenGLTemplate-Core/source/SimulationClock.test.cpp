@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SimulationClock.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SimulationClock.hpp"
+#include "UnitTest.hpp"
+
+using namespace Core;
+
+TEST_CASE(AccumulatesPartialFrames) {
+
+    SimulationClock clock(100.0, 5);    // 10 ms steps
+
+    CHECK(clock.Advance(0.004) == 0);
+    CHECK_NEAR(clock.Alpha(), 0.4f, 1e-5f);
+
+    CHECK(clock.Advance(0.004) == 0);
+    CHECK(clock.Advance(0.004) == 1);
+    CHECK_NEAR(clock.Alpha(), 0.2f, 1e-5f);
+
+    CHECK(clock.TickCount() == 1);
+}
+
+TEST_CASE(LongFramesRunSeveralSteps) {
+
+    SimulationClock clock(100.0, 5);
+
+    CHECK(clock.Advance(0.035) == 3);
+    CHECK_NEAR(clock.Alpha(), 0.5f, 1e-5f);
+    CHECK(clock.DroppedSteps() == 0);
+}
+
+TEST_CASE(HitchesAreCappedAndTheBacklogDropped) {
+
+    SimulationClock clock(100.0, 4);
+
+    CHECK(clock.Advance(1.0025) == 4);
+    CHECK(clock.DroppedSteps() == 96);
+    CHECK_NEAR(clock.Alpha(), 0.25f, 1e-4f);
+
+    // the next normal frame does not inherit the hitch
+    CHECK(clock.Advance(0.010) == 1);
+}
+
+TEST_CASE(StepCountIsIndependentOfFrameRate) {
+
+    // power of two rates keep every sum exact
+    SimulationClock fast(64.0, 10);
+    SimulationClock slow(64.0, 10);
+
+    int fast_steps = 0;
+    int slow_steps = 0;
+
+    for (int frame = 0; frame < 256; ++frame) {
+
+        fast_steps += fast.Advance(1.0 / 256.0);
+    }
+
+    for (int frame = 0; frame < 32; ++frame) {
+
+        slow_steps += slow.Advance(1.0 / 32.0);
+    }
+
+    CHECK(fast_steps == 64);
+    CHECK(slow_steps == 64);
+    CHECK(fast.Alpha() == 0.0f);
+}
+
+TEST_CASE(ChangingTheTickRateKeepsAlpha) {
+
+    SimulationClock clock(60.0, 5);
+
+    clock.Advance(0.5 / 60.0);
+    CHECK_NEAR(clock.Alpha(), 0.5f, 1e-5f);
+
+    clock.SetTickRate(20.0);
+    CHECK_NEAR(clock.Alpha(), 0.5f, 1e-5f);
+    CHECK_NEAR(static_cast<float>(clock.StepSeconds()), 0.05f, 1e-7f);
+
+    CHECK(clock.Advance(0.0) == 0);
+    CHECK(clock.Advance(0.025) == 1);
+}
+
+int main() { return Core::Test::RunAll(); }
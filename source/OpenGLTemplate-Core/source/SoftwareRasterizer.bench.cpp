@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SoftwareRasterizer.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SoftwareRasterizer.hpp"
+#include "JobSystem.hpp"
+#include "TransformKernels.hpp"
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+
+#define LINE_COUNT      1000000
+#define TARGET_WIDTH    1920
+#define TARGET_HEIGHT   1080
+#define SHORT_LENGTH    16.0f       // about a model edge at default zoom
+#define LONG_LENGTH     400.0f
+
+static std::vector<LineSegment> RandomSegments(std::size_t count, float length, unsigned int seed) {
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> x_dist(0.0f, TARGET_WIDTH);
+    std::uniform_real_distribution<float> y_dist(0.0f, TARGET_HEIGHT);
+    std::uniform_real_distribution<float> offset_dist(-length, length);
+
+    std::vector<LineSegment> segments(count);
+
+    for (LineSegment& segment : segments) {
+
+        segment.x0 = x_dist(rng);
+        segment.y0 = y_dist(rng);
+        segment.x1 = segment.x0 + offset_dist(rng);
+        segment.y1 = segment.y0 + offset_dist(rng);
+        segment.color = 0xFFFFFFFF;
+    }
+
+    return segments;
+}
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : LINE_COUNT;
+    const unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    const std::vector<LineSegment> short_lines = RandomSegments(count, SHORT_LENGTH, 42);
+    const std::vector<LineSegment> long_lines = RandomSegments(count / 10, LONG_LENGTH, 43);
+
+    Framebuffer target;
+    target.Resize(TARGET_WIDTH, TARGET_HEIGHT);
+
+    LineRasterizer rasterizer;
+
+    std::cout << "Target:\t" << TARGET_WIDTH << "x" << TARGET_HEIGHT << ", "
+              << RASTER_TILE_SIZE << " pixel tiles" << std::endl;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Span kernels on one thread at every supported level
+    ////////////////////////////////////////////////////////////////////////////
+    for (int level = 0; level <= static_cast<int>(DetectSimdLevel()); ++level) {
+
+        SetSimdLevel(static_cast<SimdLevel>(level));
+
+        const std::string level_name = SimdLevelName(ActiveSimdLevel());
+
+        Bench::Run(("short lines " + level_name).c_str(), short_lines.size(), [&]() {
+
+            rasterizer.Rasterize(short_lines.data(), short_lines.size(), target);
+            Bench::DoNotOptimize(target.pixels.data());
+        });
+
+        Bench::Run(("long lines " + level_name).c_str(), long_lines.size(), [&]() {
+
+            rasterizer.Rasterize(long_lines.data(), long_lines.size(), target);
+            Bench::DoNotOptimize(target.pixels.data());
+        });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Tile-parallel binning and rasterization
+    ////////////////////////////////////////////////////////////////////////////
+    double single_thread = 0.0;
+
+    for (unsigned int threads = 1; threads <= max_threads; threads *= 2) {
+
+        JobSystem jobs(threads - 1);
+
+        const std::string name = "short lines " + std::to_string(threads) + " threads";
+
+        const double seconds = Bench::Run(name.c_str(), short_lines.size(), [&]() {
+
+            rasterizer.Rasterize(short_lines.data(), short_lines.size(), target, &jobs);
+            jobs.WaitAll();
+        });
+
+        if (threads == 1) {
+
+            single_thread = seconds;
+        }
+
+        std::cout << "    speedup: " << single_thread / seconds << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,475 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SoftwareRasterizer.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SoftwareRasterizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+
+#include "JobSystem.hpp"
+#include "TransformKernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define CORE_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define CORE_SIMD_X86 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define CORE_TARGET_SSE2 __attribute__((target("sse2")))
+    #define CORE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define CORE_TARGET_SSE2
+    #define CORE_TARGET_AVX2
+#endif
+
+namespace Core {
+
+static std::uint32_t ToByte(float value) {
+
+    return static_cast<std::uint32_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+std::uint32_t PackColor(const float* color_vec) {
+
+    return ToByte(color_vec[0])
+         | ToByte(color_vec[1]) << 8
+         | ToByte(color_vec[2]) << 16
+         | ToByte(color_vec[3]) << 24;
+}
+
+void Framebuffer::Resize(int new_width, int new_height) {
+
+    width = std::max(new_width, 0);
+    height = std::max(new_height, 0);
+    pixels.assign(static_cast<std::size_t>(width) * height, 0);
+}
+
+void Framebuffer::Fill(std::uint32_t color) {
+
+    std::fill(pixels.begin(), pixels.end(), color);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Line Setup
+// --Liang-Barsky clips to the framebuffer first, so the fixed point minor
+//   coordinate never has to hold more than the framebuffer size.
+////////////////////////////////////////////////////////////////////////////////
+static bool ClipTest(float p, float q, float& t0, float& t1) {
+
+    if (p == 0.0f) {
+
+        return q >= 0.0f;
+    }
+
+    const float t = q / p;
+
+    if (p < 0.0f) {
+
+        if (t > t1) {
+
+            return false;
+        }
+
+        t0 = std::max(t0, t);
+    }
+    else {
+
+        if (t < t0) {
+
+            return false;
+        }
+
+        t1 = std::min(t1, t);
+    }
+
+    return true;
+}
+
+bool SetupLineSpan(const LineSegment& segment, int width, int height, LineSpan& out) {
+
+    if (width <= 0 || height <= 0) {
+
+        return false;
+    }
+
+    float x0 = segment.x0;
+    float y0 = segment.y0;
+    float dx = segment.x1 - segment.x0;
+    float dy = segment.y1 - segment.y0;
+
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+
+    if (!ClipTest(-dx, x0, t0, t1) || !ClipTest(dx, width - x0, t0, t1) ||
+        !ClipTest(-dy, y0, t0, t1) || !ClipTest(dy, height - y0, t0, t1)) {
+
+        return false;
+    }
+
+    float x1 = x0 + dx * t1;
+    float y1 = y0 + dy * t1;
+    x0 += dx * t0;
+    y0 += dy * t0;
+
+    out.x_major = std::fabs(dx) >= std::fabs(dy);
+
+    // reduce both cases to stepping along the major axis in +1 increments
+    float major0 = out.x_major ? x0 : y0;
+    float major1 = out.x_major ? x1 : y1;
+    float minor0 = out.x_major ? y0 : x0;
+    float minor1 = out.x_major ? y1 : x1;
+
+    if (major0 > major1) {
+
+        std::swap(major0, major1);
+        std::swap(minor0, minor1);
+    }
+
+    const int major_limit = (out.x_major ? width : height) - 1;
+    const float major_delta = major1 - major0;
+    const float slope = major_delta > 0.0f ? (minor1 - minor0) / major_delta : 0.0f;
+
+    out.major_begin = std::clamp(static_cast<int>(std::floor(major0)), 0, major_limit);
+    out.major_end = std::clamp(static_cast<int>(std::floor(major1)), 0, major_limit);
+
+    // sample the minor coordinate at the center of each major step
+    const float minor_at_begin = minor0 + (out.major_begin + 0.5f - major0) * slope;
+    const float scale = static_cast<float>(1 << RASTER_FIXED_SHIFT);
+
+    out.minor_fixed = static_cast<std::int32_t>(std::floor(minor_at_begin * scale));
+    out.step_fixed = static_cast<std::int32_t>(std::lround(slope * scale));
+    out.color = segment.color;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Span Kernels
+////////////////////////////////////////////////////////////////////////////////
+struct SpanClip {
+
+    int major_lo;           // first major step inside the tile
+    int major_hi;           // last major step inside the tile
+    int minor_lo;           // tile range on the minor axis, half-open
+    int minor_hi;
+    std::int32_t fixed;     // minor coordinate at major_lo
+};
+
+static bool ClipSpan(const LineSpan& span, const TileRect& tile, SpanClip& clip) {
+
+    clip.major_lo = std::max(span.major_begin, span.x_major ? tile.x0 : tile.y0);
+    clip.major_hi = std::min(span.major_end, (span.x_major ? tile.x1 : tile.y1) - 1);
+    clip.minor_lo = span.x_major ? tile.y0 : tile.x0;
+    clip.minor_hi = span.x_major ? tile.y1 : tile.x1;
+
+    if (clip.major_lo > clip.major_hi) {
+
+        return false;
+    }
+
+    clip.fixed = static_cast<std::int32_t>(span.minor_fixed +
+        static_cast<std::int64_t>(clip.major_lo - span.major_begin) * span.step_fixed);
+
+    return true;
+}
+
+static inline void WritePixel(const LineSpan& span, int major, int minor, Framebuffer& target) {
+
+    const std::size_t index = span.x_major
+        ? static_cast<std::size_t>(minor) * target.width + major
+        : static_cast<std::size_t>(major) * target.width + minor;
+
+    target.pixels[index] = span.color;
+}
+
+static void RasterizeRangeScalar(const LineSpan& span, const SpanClip& clip, int major,
+                                 std::int32_t fixed, Framebuffer& target) {
+
+    for (; major <= clip.major_hi; ++major, fixed += span.step_fixed) {
+
+        const int minor = fixed >> RASTER_FIXED_SHIFT;
+
+        if (minor >= clip.minor_lo && minor < clip.minor_hi) {
+
+            WritePixel(span, major, minor, target);
+        }
+    }
+}
+
+void RasterizeSpanScalar(const LineSpan& span, const TileRect& tile, Framebuffer& target) {
+
+    SpanClip clip;
+
+    if (ClipSpan(span, tile, clip)) {
+
+        RasterizeRangeScalar(span, clip, clip.major_lo, clip.fixed, target);
+    }
+}
+
+#if CORE_SIMD_X86
+CORE_TARGET_SSE2
+static void RasterizeSpanSSE2(const LineSpan& span, const TileRect& tile, Framebuffer& target) {
+
+    SpanClip clip;
+
+    if (!ClipSpan(span, tile, clip)) {
+
+        return;
+    }
+
+    const std::int32_t step = span.step_fixed;
+
+    __m128i fixed = _mm_add_epi32(_mm_set1_epi32(clip.fixed),
+                                  _mm_setr_epi32(0, step, 2 * step, 3 * step));
+
+    const __m128i step4 = _mm_set1_epi32(4 * step);
+    const __m128i below = _mm_set1_epi32(clip.minor_lo - 1);
+    const __m128i above = _mm_set1_epi32(clip.minor_hi);
+
+    alignas(16) std::int32_t minors[4];
+    int major = clip.major_lo;
+
+    for (; major + 3 <= clip.major_hi; major += 4) {
+
+        const __m128i minor = _mm_srai_epi32(fixed, RASTER_FIXED_SHIFT);
+        const __m128i inside = _mm_and_si128(_mm_cmpgt_epi32(minor, below),
+                                             _mm_cmplt_epi32(minor, above));
+
+        const int mask = _mm_movemask_ps(_mm_castsi128_ps(inside));
+
+        if (mask != 0) {
+
+            _mm_store_si128(reinterpret_cast<__m128i*>(minors), minor);
+
+            for (int lane = 0; lane < 4; ++lane) {
+
+                if (mask & (1 << lane)) {
+
+                    WritePixel(span, major + lane, minors[lane], target);
+                }
+            }
+        }
+
+        fixed = _mm_add_epi32(fixed, step4);
+    }
+
+    RasterizeRangeScalar(span, clip, major, _mm_cvtsi128_si32(fixed), target);
+}
+
+CORE_TARGET_AVX2
+static void RasterizeSpanAVX2(const LineSpan& span, const TileRect& tile, Framebuffer& target) {
+
+    SpanClip clip;
+
+    if (!ClipSpan(span, tile, clip)) {
+
+        return;
+    }
+
+    const std::int32_t step = span.step_fixed;
+
+    __m256i fixed = _mm256_add_epi32(_mm256_set1_epi32(clip.fixed),
+                                     _mm256_mullo_epi32(_mm256_set1_epi32(step),
+                                                        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+
+    const __m256i step8 = _mm256_set1_epi32(8 * step);
+    const __m256i below = _mm256_set1_epi32(clip.minor_lo - 1);
+    const __m256i above = _mm256_set1_epi32(clip.minor_hi);
+
+    alignas(32) std::int32_t minors[8];
+    int major = clip.major_lo;
+
+    for (; major + 7 <= clip.major_hi; major += 8) {
+
+        const __m256i minor = _mm256_srai_epi32(fixed, RASTER_FIXED_SHIFT);
+        const __m256i inside = _mm256_and_si256(_mm256_cmpgt_epi32(minor, below),
+                                                _mm256_cmpgt_epi32(above, minor));
+
+        const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(inside));
+
+        if (mask != 0) {
+
+            _mm256_store_si256(reinterpret_cast<__m256i*>(minors), minor);
+
+            for (int lane = 0; lane < 8; ++lane) {
+
+                if (mask & (1 << lane)) {
+
+                    WritePixel(span, major + lane, minors[lane], target);
+                }
+            }
+        }
+
+        fixed = _mm256_add_epi32(fixed, step8);
+    }
+
+    RasterizeRangeScalar(span, clip, major, _mm256_cvtsi256_si32(fixed), target);
+}
+#endif
+
+void RasterizeSpan(const LineSpan& span, const TileRect& tile, Framebuffer& target) {
+
+#if CORE_SIMD_X86
+    switch(ActiveSimdLevel()) {
+        case(SimdLevel::AVX2):
+            RasterizeSpanAVX2(span, tile, target);
+            return;
+        case(SimdLevel::SSE2):
+            RasterizeSpanSSE2(span, tile, target);
+            return;
+        default:
+            break;
+    }
+#endif
+
+    RasterizeSpanScalar(span, tile, target);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Line Rasterizer
+////////////////////////////////////////////////////////////////////////////////
+void LineRasterizer::Rasterize(const LineSegment* segments, std::size_t count,
+                               Framebuffer& target, JobSystem* jobs) {
+
+    tiles_x = (target.width + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE;
+    tiles_y = (target.height + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE;
+
+    const std::size_t tile_count = TileCount();
+
+    if (count == 0 || tile_count == 0) {
+
+        return;
+    }
+
+    // one binning chunk per thread, each bins into its own lists so no
+    // locking is needed and tiles can still replay segments in order
+    const std::size_t thread_count = jobs ? jobs->WorkerCount() + 1 : 1;
+
+    chunk_size = std::max<std::size_t>((count + thread_count - 1) / thread_count, RASTER_MIN_CHUNK);
+    chunk_count = (count + chunk_size - 1) / chunk_size;
+
+    spans.resize(count);
+
+    if (bins.size() < chunk_count * tile_count) {
+
+        bins.resize(chunk_count * tile_count);
+    }
+
+    auto bin_chunks = [this, segments, count, &target](std::size_t begin, std::size_t end) {
+
+        for (std::size_t chunk = begin; chunk < end; ++chunk) {
+
+            BinRange(chunk, chunk * chunk_size, std::min(count, (chunk + 1) * chunk_size),
+                     segments, target);
+        }
+    };
+
+    auto rasterize_tiles = [this, &target](std::size_t begin, std::size_t end) {
+
+        for (std::size_t tile = begin; tile < end; ++tile) {
+
+            RasterizeTile(tile, target);
+        }
+    };
+
+    if (!jobs || jobs->WorkerCount() == 0) {
+
+        bin_chunks(0, chunk_count);
+        rasterize_tiles(0, tile_count);
+        return;
+    }
+
+    JobHandle binned = jobs->ParallelFor(chunk_count, 1, std::ref(bin_chunks));
+    JobHandle rasterized = jobs->ParallelFor(tile_count, 1, std::ref(rasterize_tiles), {binned});
+
+    jobs->Wait(rasterized);
+}
+
+void LineRasterizer::BinRange(std::size_t chunk, std::size_t begin, std::size_t end,
+                              const LineSegment* segments, const Framebuffer& target) {
+
+    const std::size_t tile_count = TileCount();
+    std::vector<std::uint32_t>* chunk_bins = bins.data() + chunk * tile_count;
+
+    for (std::size_t tile = 0; tile < tile_count; ++tile) {
+
+        chunk_bins[tile].clear();
+    }
+
+    for (std::size_t i = begin; i < end; ++i) {
+
+        LineSpan& span = spans[i];
+
+        if (!SetupLineSpan(segments[i], target.width, target.height, span)) {
+
+            continue;
+        }
+
+        const int minor_limit = (span.x_major ? target.height : target.width) - 1;
+
+        // walk the tile bands the span crosses on its major axis and bin it
+        // into the tiles its minor range covers within each band
+        const int band_first = span.major_begin / RASTER_TILE_SIZE;
+        const int band_last = span.major_end / RASTER_TILE_SIZE;
+
+        for (int band = band_first; band <= band_last; ++band) {
+
+            const int major_lo = std::max(span.major_begin, band * RASTER_TILE_SIZE);
+            const int major_hi = std::min(span.major_end, band * RASTER_TILE_SIZE + RASTER_TILE_SIZE - 1);
+
+            const std::int64_t fixed_lo = span.minor_fixed +
+                static_cast<std::int64_t>(major_lo - span.major_begin) * span.step_fixed;
+            const std::int64_t fixed_hi = span.minor_fixed +
+                static_cast<std::int64_t>(major_hi - span.major_begin) * span.step_fixed;
+
+            const int minor_a = static_cast<int>(fixed_lo >> RASTER_FIXED_SHIFT);
+            const int minor_b = static_cast<int>(fixed_hi >> RASTER_FIXED_SHIFT);
+
+            const int minor_lo = std::clamp(std::min(minor_a, minor_b), 0, minor_limit);
+            const int minor_hi = std::clamp(std::max(minor_a, minor_b), 0, minor_limit);
+
+            for (int cell = minor_lo / RASTER_TILE_SIZE; cell <= minor_hi / RASTER_TILE_SIZE; ++cell) {
+
+                const int tile_x = span.x_major ? band : cell;
+                const int tile_y = span.x_major ? cell : band;
+
+                chunk_bins[static_cast<std::size_t>(tile_y) * tiles_x + tile_x]
+                    .push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+}
+
+void LineRasterizer::RasterizeTile(std::size_t tile, Framebuffer& target) const {
+
+    const int tile_x = static_cast<int>(tile % tiles_x);
+    const int tile_y = static_cast<int>(tile / tiles_x);
+
+    const TileRect rect {
+        tile_x * RASTER_TILE_SIZE,
+        tile_y * RASTER_TILE_SIZE,
+        std::min((tile_x + 1) * RASTER_TILE_SIZE, target.width),
+        std::min((tile_y + 1) * RASTER_TILE_SIZE, target.height),
+    };
+
+    const std::size_t tile_count = TileCount();
+
+    for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+
+        for (std::uint32_t span : bins[chunk * tile_count + tile]) {
+
+            RasterizeSpan(spans[span], rect, target);
+        }
+    }
+}
+
+} // namespace Core
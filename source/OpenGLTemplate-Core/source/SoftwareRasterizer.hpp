@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SoftwareRasterizer.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define RASTER_TILE_SIZE        64      // pixels per tile side, one job per tile
+#define RASTER_FIXED_SHIFT      16      // fractional bits of the minor axis
+#define RASTER_MIN_CHUNK        1024    // fewest segments one binning job sets up
+
+namespace Core {
+
+class JobSystem;
+
+// RGBA8, red in the lowest byte (the byte order of PNG and PPM)
+std::uint32_t PackColor(const float* color_vec);
+
+////////////////////////////////////////////////////////////////////////////////
+// Framebuffer
+// --RGBA8 pixels, row 0 at the top like an image file (GL's row 0 is the
+//   bottom, SoftwareRenderDevice flips when it maps to window coordinates).
+////////////////////////////////////////////////////////////////////////////////
+struct Framebuffer {
+
+    int width = 0;
+    int height = 0;
+    std::vector<std::uint32_t> pixels;
+
+    void Resize(int new_width, int new_height);
+    void Fill(std::uint32_t color);
+
+    std::uint32_t At(int x, int y) const { return pixels[static_cast<std::size_t>(y) * width + x]; }
+};
+
+// endpoints in pixels, (0, 0) is the top-left corner of the top-left pixel
+struct LineSegment {
+
+    float x0, y0;
+    float x1, y1;
+    std::uint32_t color;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Line Span
+// --A segment clipped to the framebuffer and set up for a DDA along its major
+//   axis: one pixel per major step from major_begin to major_end
+//   (inclusive), the minor coordinate in RASTER_FIXED_SHIFT fixed point.
+// --Integer stepping makes every kernel and every tile split produce exactly
+//   the same pixels.
+////////////////////////////////////////////////////////////////////////////////
+struct LineSpan {
+
+    int major_begin = 0;
+    int major_end = -1;
+    std::int32_t minor_fixed = 0;   // minor coordinate at major_begin
+    std::int32_t step_fixed = 0;    // minor change per major step
+    std::uint32_t color = 0;
+    bool x_major = true;
+};
+
+// half-open pixel rectangle
+struct TileRect {
+
+    int x0, y0;
+    int x1, y1;
+};
+
+// returns false if the segment lies entirely outside the framebuffer
+bool SetupLineSpan(const LineSegment& segment, int width, int height, LineSpan& out);
+
+////////////////////////////////////////////////////////////////////////////////
+// Span Kernels
+// --Write the pixels of one span that fall inside a tile. The SIMD kernels
+//   step 4 (SSE2) or 8 (AVX2) pixels at a time and test them against the
+//   tile together; only the final stores are scalar (there is no scatter
+//   before AVX-512).
+// --RasterizeSpan() dispatches on ActiveSimdLevel(), the level the transform
+//   kernels use. RasterizeSpanScalar() is the reference.
+////////////////////////////////////////////////////////////////////////////////
+void RasterizeSpan(const LineSpan& span, const TileRect& tile, Framebuffer& target);
+void RasterizeSpanScalar(const LineSpan& span, const TileRect& tile, Framebuffer& target);
+
+////////////////////////////////////////////////////////////////////////////////
+// Line Rasterizer
+// --Sets up and bins segments into RASTER_TILE_SIZE tiles, then rasterizes
+//   every tile as its own job. A tile draws its segments in submission order,
+//   so later segments overwrite earlier ones exactly like sequential drawing.
+// --Without a job system (or with zero workers) everything runs on the
+//   calling thread. Bins keep their capacity between calls.
+////////////////////////////////////////////////////////////////////////////////
+class LineRasterizer {
+
+public:
+    void Rasterize(const LineSegment* segments, std::size_t count,
+                   Framebuffer& target, JobSystem* jobs = nullptr);
+
+    std::size_t TileCount() const { return static_cast<std::size_t>(tiles_x) * tiles_y; }
+
+private:
+    void BinRange(std::size_t chunk, std::size_t begin, std::size_t end,
+                  const LineSegment* segments, const Framebuffer& target);
+    void RasterizeTile(std::size_t tile, Framebuffer& target) const;
+
+    int tiles_x = 0;
+    int tiles_y = 0;
+    std::size_t chunk_count = 0;
+    std::size_t chunk_size = 0;
+
+    std::vector<LineSpan> spans;                    // indexed like the segments
+    std::vector<std::vector<std::uint32_t>> bins;   // [chunk * tile count + tile]
+};
+
+} // namespace Core
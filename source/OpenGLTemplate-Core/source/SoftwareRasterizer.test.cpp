@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SoftwareRasterizer.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SoftwareRasterizer.hpp"
+#include "JobSystem.hpp"
+#include "TransformKernels.hpp"
+#include "UnitTest.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+static const std::uint32_t RED = 0xFF0000FF;
+static const std::uint32_t BLUE = 0xFFFF0000;
+
+static int CountColor(const Framebuffer& target, std::uint32_t color) {
+
+    int count = 0;
+
+    for (std::uint32_t pixel : target.pixels) {
+
+        count += pixel == color ? 1 : 0;
+    }
+
+    return count;
+}
+
+static std::vector<LineSegment> RandomSegments(std::size_t count, float extent, unsigned int seed) {
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-0.25f * extent, 1.25f * extent);
+    std::uniform_int_distribution<std::uint32_t> color(1, 0xFFFFFF);
+
+    std::vector<LineSegment> segments(count);
+
+    for (LineSegment& segment : segments) {
+
+        segment = LineSegment{position(rng), position(rng), position(rng), position(rng),
+                              0xFF000000 | color(rng)};
+    }
+
+    return segments;
+}
+
+TEST_CASE(PackColorIsRedInTheLowestByte) {
+
+    const float orange[4] = {1.0f, 0.65f, 0.0f, 1.0f};
+
+    CHECK(PackColor(orange) == 0xFF00A6FF);
+}
+
+TEST_CASE(AxisAlignedLinesCoverEveryPixelOnce) {
+
+    Framebuffer target;
+    target.Resize(16, 16);
+
+    LineRasterizer rasterizer;
+
+    const LineSegment lines[] = {
+        {0.5f, 2.5f, 9.5f, 2.5f, RED},      // row 2, columns 0-9
+        {4.5f, 15.5f, 4.5f, 6.5f, BLUE},    // column 4, rows 6-15
+    };
+
+    rasterizer.Rasterize(lines, 2, target);
+
+    CHECK(CountColor(target, RED) == 10);
+    CHECK(CountColor(target, BLUE) == 10);
+    CHECK(target.At(0, 2) == RED);
+    CHECK(target.At(9, 2) == RED);
+    CHECK(target.At(4, 6) == BLUE);
+    CHECK(target.At(4, 15) == BLUE);
+}
+
+TEST_CASE(DiagonalStepsOnePixelPerColumn) {
+
+    Framebuffer target;
+    target.Resize(8, 8);
+
+    LineRasterizer rasterizer;
+
+    const LineSegment diagonal {0.5f, 0.5f, 7.5f, 7.5f, RED};
+    rasterizer.Rasterize(&diagonal, 1, target);
+
+    CHECK(CountColor(target, RED) == 8);
+
+    for (int i = 0; i < 8; ++i) {
+
+        CHECK(target.At(i, i) == RED);
+    }
+}
+
+TEST_CASE(SegmentsAreClippedToTheFramebuffer) {
+
+    LineSpan span;
+
+    CHECK(!SetupLineSpan(LineSegment{-10.0f, -5.0f, -1.0f, -3.0f, RED}, 8, 8, span));
+    CHECK(!SetupLineSpan(LineSegment{9.0f, 0.0f, 20.0f, 7.0f, RED}, 8, 8, span));
+
+    CHECK(SetupLineSpan(LineSegment{-100.0f, 3.5f, 100.0f, 3.5f, RED}, 8, 8, span));
+    CHECK(span.x_major);
+    CHECK(span.major_begin == 0);
+    CHECK(span.major_end == 7);
+    CHECK((span.minor_fixed >> RASTER_FIXED_SHIFT) == 3);
+}
+
+TEST_CASE(LaterSegmentsOverwriteEarlierOnes) {
+
+    Framebuffer target;
+    target.Resize(200, 200);
+
+    LineRasterizer rasterizer;
+
+    const LineSegment lines[] = {
+        {0.0f, 100.5f, 200.0f, 100.5f, RED},
+        {0.0f, 100.5f, 200.0f, 100.5f, BLUE},
+    };
+
+    rasterizer.Rasterize(lines, 2, target);
+
+    CHECK(CountColor(target, RED) == 0);
+    CHECK(CountColor(target, BLUE) == 200);
+}
+
+TEST_CASE(SimdKernelsMatchScalar) {
+
+    const std::vector<LineSegment> segments = RandomSegments(500, 150.0f, 7);
+    const TileRect tile {10, 20, 137, 91};
+
+    Framebuffer reference;
+    reference.Resize(150, 150);
+
+    for (const LineSegment& segment : segments) {
+
+        LineSpan span;
+
+        if (SetupLineSpan(segment, reference.width, reference.height, span)) {
+
+            RasterizeSpanScalar(span, tile, reference);
+        }
+    }
+
+    for (int level = 0; level <= static_cast<int>(DetectSimdLevel()); ++level) {
+
+        SetSimdLevel(static_cast<SimdLevel>(level));
+
+        Framebuffer target;
+        target.Resize(150, 150);
+
+        for (const LineSegment& segment : segments) {
+
+            LineSpan span;
+
+            if (SetupLineSpan(segment, target.width, target.height, span)) {
+
+                RasterizeSpan(span, tile, target);
+            }
+        }
+
+        CHECK(target.pixels == reference.pixels);
+    }
+
+    SetSimdLevel(DetectSimdLevel());
+}
+
+TEST_CASE(TileParallelMatchesSingleThread) {
+
+    const std::vector<LineSegment> segments = RandomSegments(5000, 300.0f, 11);
+
+    Framebuffer serial;
+    serial.Resize(300, 200);
+
+    LineRasterizer serial_rasterizer;
+    serial_rasterizer.Rasterize(segments.data(), segments.size(), serial);
+
+    JobSystem jobs(3);
+
+    Framebuffer parallel;
+    parallel.Resize(300, 200);
+
+    LineRasterizer parallel_rasterizer;
+
+    // twice, so reused bins must not leak segments from the previous call
+    parallel_rasterizer.Rasterize(segments.data(), segments.size(), parallel, &jobs);
+    parallel.Fill(0);
+    parallel_rasterizer.Rasterize(segments.data(), segments.size(), parallel, &jobs);
+
+    jobs.WaitAll();
+
+    CHECK(parallel_rasterizer.TileCount() == 5 * 4);
+    CHECK(parallel.pixels == serial.pixels);
+}
+
+int main() { return Core::Test::RunAll(); }
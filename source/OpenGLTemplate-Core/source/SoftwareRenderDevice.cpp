@@ -0,0 +1,408 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SoftwareRenderDevice.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SoftwareRenderDevice.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "ImageWriter.hpp"
+#include "IndexedMesh.hpp"
+
+namespace Core {
+
+static constexpr NameHash U_MODEL_MAT = HashName("u_Model_mat");
+static constexpr NameHash U_COLOR_VEC = HashName("u_Color_vec");
+static constexpr NameHash U_POSITION_EXTENT = HashName("u_Position_extent");
+static constexpr NameHash CAMERA_BLOCK = HashName("Camera");
+
+static const float identity_mat[16] = {
+
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float white_color_vec[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+// column-major like GL: out = lhs * rhs
+static void MultiplyMat4(const float* lhs, const float* rhs, float* out) {
+
+    for (int column = 0; column < 4; ++column) {
+
+        for (int row = 0; row < 4; ++row) {
+
+            float sum = 0.0f;
+
+            for (int k = 0; k < 4; ++k) {
+
+                sum += lhs[k * 4 + row] * rhs[column * 4 + k];
+            }
+
+            out[column * 4 + row] = sum;
+        }
+    }
+}
+
+SoftwareRenderDevice::SoftwareRenderDevice(int width, int height, JobSystem* jobs)
+    : job_system(jobs) {
+
+    framebuffer.Resize(width, height);
+
+    viewport[2] = framebuffer.width;
+    viewport[3] = framebuffer.height;
+}
+
+void SoftwareRenderDevice::Flush() {
+
+    rasterizer.Rasterize(pending.data(), pending.size(), framebuffer, job_system);
+    pending.clear();
+}
+
+bool SoftwareRenderDevice::WriteImage(const std::string& path) const {
+
+    return Core::WriteImage(path, framebuffer.pixels.data(), framebuffer.width, framebuffer.height);
+}
+
+void SoftwareRenderDevice::BeginFrameImpl() {
+
+    RecordingRenderDevice::BeginFrameImpl();
+    lines_drawn = 0;
+}
+
+void SoftwareRenderDevice::EndFrameImpl() {
+
+    RecordingRenderDevice::EndFrameImpl();
+    Flush();
+}
+
+void SoftwareRenderDevice::SetViewportImpl(int x, int y, int width, int height) {
+
+    RecordingRenderDevice::SetViewportImpl(x, y, width, height);
+
+    viewport[0] = x;
+    viewport[1] = y;
+    viewport[2] = width;
+    viewport[3] = height;
+}
+
+void SoftwareRenderDevice::ClearImpl(const float* color_vec) {
+
+    RecordingRenderDevice::ClearImpl(color_vec);
+
+    // everything queued so far would be cleared over anyway
+    pending.clear();
+    framebuffer.Fill(PackColor(color_vec));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Vertex Stage
+////////////////////////////////////////////////////////////////////////////////
+static void FetchAttribute(const RecordingRenderDevice& device, const VertexAttribute& attribute,
+                           std::size_t element, float* out) {
+
+    out[0] = out[1] = out[2] = 0.0f;
+    out[3] = 1.0f;
+
+    const RecordedBuffer* buffer = device.Buffer(attribute.buffer);
+
+    if (!buffer || attribute.components <= 0) {
+
+        return;
+    }
+
+    const std::size_t component_size = attribute.format == AttributeFormat::Short ? 2 : 4;
+    const std::size_t stride = attribute.stride ? attribute.stride : component_size * attribute.components;
+    const std::size_t offset = attribute.offset + stride * element;
+
+    if (offset + component_size * attribute.components > buffer->data.size()) {
+
+        return;
+    }
+
+    const std::uint8_t* source = buffer->data.data() + offset;
+
+    for (int i = 0; i < attribute.components && i < 4; ++i) {
+
+        if (attribute.format == AttributeFormat::Float) {
+
+            std::memcpy(&out[i], source + i * 4, 4);
+        }
+        else {
+
+            std::int16_t value;
+            std::memcpy(&value, source + i * 2, 2);
+
+            // GL's signed normalized conversion, see DequantizePosition
+            out[i] = attribute.normalized ? std::max(value / 32767.0f, -1.0f) : value;
+        }
+    }
+}
+
+static bool IsInstanceAttribute(const RecordedVertexArray& vertex_array, unsigned int location) {
+
+    return location < vertex_array.attributes.size() &&
+           vertex_array.attributes[location].components > 0 &&
+           vertex_array.attributes[location].divisor == 1;
+}
+
+void SoftwareRenderDevice::DrawImpl(const DrawCall& draw) {
+
+    RecordingRenderDevice::DrawImpl(draw);
+
+    const RecordedVertexArray* vertex_array = VertexArray(CurrentVertexArray());
+
+    if (!vertex_array || vertex_array->attributes.empty() || !Buffer(vertex_array->index_buffer)) {
+
+        return;
+    }
+
+    const ProgramId program = CurrentProgram();
+
+    const float* extent_value = UniformValue(program, U_POSITION_EXTENT);
+    const float extent = extent_value ? extent_value[0] : 1.0f;
+
+    // the line program reads the camera block; the instanced program shares
+    // its vertex array (and so sees locations 1-4) but has no camera block
+    const RecordedProgram* recorded = Program(program);
+    const RecordedBuffer* camera = nullptr;
+    bool has_camera_block = false;
+
+    if (recorded) {
+
+        for (const auto& block : recorded->block_bindings) {
+
+            if (block.first == CAMERA_BLOCK) {
+
+                camera = Buffer(UniformBufferAt(block.second));
+                has_camera_block = true;
+            }
+        }
+    }
+
+    const bool instanced = !has_camera_block &&
+                           IsInstanceAttribute(*vertex_array, 1) && IsInstanceAttribute(*vertex_array, 2) &&
+                           IsInstanceAttribute(*vertex_array, 3) && IsInstanceAttribute(*vertex_array, 4);
+
+    // non-instanced draws: proj * view * model from the camera block and uniforms
+    float mvp_mat[16];
+    const float* color_vec = white_color_vec;
+
+    if (!instanced) {
+
+        float camera_mats[32];      // proj_mat then view_mat, std140
+        std::memcpy(camera_mats, identity_mat, sizeof(identity_mat));
+        std::memcpy(camera_mats + 16, identity_mat, sizeof(identity_mat));
+
+        if (camera && camera->data.size() >= sizeof(camera_mats)) {
+
+            std::memcpy(camera_mats, camera->data.data(), sizeof(camera_mats));
+        }
+
+        const float* proj_mat = camera_mats;
+        const float* view_mat = camera_mats + 16;
+
+        const float* model_mat = UniformValue(program, U_MODEL_MAT);
+
+        float view_model_mat[16];
+        MultiplyMat4(view_mat, model_mat ? model_mat : identity_mat, view_model_mat);
+        MultiplyMat4(proj_mat, view_model_mat, mvp_mat);
+
+        if (const float* uniform_color = UniformValue(program, U_COLOR_VEC)) {
+
+            color_vec = uniform_color;
+        }
+    }
+
+    const RecordedBuffer& index_buffer = *Buffer(vertex_array->index_buffer);
+    const std::size_t index_total = index_buffer.data.size() / sizeof(std::uint16_t);
+
+    if (draw.first_index < 0 || static_cast<std::size_t>(draw.first_index) >= index_total) {
+
+        return;
+    }
+
+    const std::size_t index_count = std::min<std::size_t>(draw.index_count, index_total - draw.first_index);
+
+    // read in place: copying the indices out would allocate on every draw
+    const std::uint8_t* index_data = index_buffer.data.data() + draw.first_index * sizeof(std::uint16_t);
+
+    auto index_at = [index_data](std::size_t i) {
+
+        std::uint16_t index;
+        std::memcpy(&index, index_data + i * sizeof(std::uint16_t), sizeof(index));
+        return index;
+    };
+
+    const VertexAttribute& position = vertex_array->attributes[0];
+
+    for (int instance = 0; instance < draw.instance_count; ++instance) {
+
+        float columns[3][4];
+        float instance_color_vec[4];
+
+        if (instanced) {
+
+            for (unsigned int column = 0; column < 3; ++column) {
+
+                FetchAttribute(*this, vertex_array->attributes[1 + column], instance, columns[column]);
+            }
+
+            FetchAttribute(*this, vertex_array->attributes[4], instance, instance_color_vec);
+            color_vec = instance_color_vec;
+        }
+
+        const std::uint32_t color = PackColor(color_vec);
+
+        auto to_clip = [&](std::uint16_t index, float* clip) {
+
+            float vertex[4];
+            FetchAttribute(*this, position, static_cast<std::size_t>(index + draw.base_vertex), vertex);
+
+            const float x = vertex[0] * extent;
+            const float y = vertex[1] * extent;
+
+            if (instanced) {
+
+                clip[0] = columns[0][0] * x + columns[1][0] * y + columns[2][0];
+                clip[1] = columns[0][1] * x + columns[1][1] * y + columns[2][1];
+                clip[2] = 0.0f;
+                clip[3] = 1.0f;
+                return;
+            }
+
+            for (int row = 0; row < 4; ++row) {
+
+                clip[row] = mvp_mat[row] * x + mvp_mat[4 + row] * y + mvp_mat[12 + row];
+            }
+        };
+
+        float previous[4];
+        float current[4];
+        float first[4];
+
+        switch (draw.primitive) {
+
+            case(PrimitiveType::LineStrip): {
+
+                bool has_previous = false;
+
+                for (std::size_t i = 0; i < index_count; ++i) {
+
+                    const std::uint16_t index = index_at(i);
+
+                    if (index == PRIMITIVE_RESTART_INDEX) {
+
+                        has_previous = false;
+                        continue;
+                    }
+
+                    to_clip(index, current);
+
+                    if (has_previous) {
+
+                        EmitLine(previous, current, color);
+                    }
+
+                    std::memcpy(previous, current, sizeof(current));
+                    has_previous = true;
+                }
+                break;
+            }
+            case(PrimitiveType::Lines):
+                for (std::size_t i = 0; i + 1 < index_count; i += 2) {
+
+                    to_clip(index_at(i), previous);
+                    to_clip(index_at(i + 1), current);
+                    EmitLine(previous, current, color);
+                }
+                break;
+            case(PrimitiveType::Triangles):
+                for (std::size_t i = 0; i + 2 < index_count; i += 3) {
+
+                    to_clip(index_at(i), first);
+                    to_clip(index_at(i + 1), previous);
+                    to_clip(index_at(i + 2), current);
+
+                    EmitLine(first, previous, color);
+                    EmitLine(previous, current, color);
+                    EmitLine(current, first, color);
+                }
+                break;
+        }
+    }
+}
+
+void SoftwareRenderDevice::EmitLine(const float* clip_a, const float* clip_b, std::uint32_t color) {
+
+    // the template is 2D, w is always 1; skip anything behind the eye
+    if (clip_a[3] <= 0.0f || clip_b[3] <= 0.0f) {
+
+        return;
+    }
+
+    // clip to -w <= x, y <= w like GL, so nothing leaks outside the viewport
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+
+    for (int axis = 0; axis < 2; ++axis) {
+
+        for (float sign : {1.0f, -1.0f}) {
+
+            // distance inside the plane sign * axis = w at each end
+            const float inside_a = clip_a[3] - sign * clip_a[axis];
+            const float inside_b = clip_b[3] - sign * clip_b[axis];
+
+            if (inside_a < 0.0f && inside_b < 0.0f) {
+
+                return;
+            }
+
+            if (inside_a < 0.0f) {
+
+                t0 = std::max(t0, inside_a / (inside_a - inside_b));
+            }
+            else if (inside_b < 0.0f) {
+
+                t1 = std::min(t1, inside_a / (inside_a - inside_b));
+            }
+        }
+    }
+
+    if (t0 > t1) {
+
+        return;
+    }
+
+    auto to_image = [&](float t, float& x, float& y) {
+
+        float clip[4];
+
+        for (int i = 0; i < 4; ++i) {
+
+            clip[i] = clip_a[i] + (clip_b[i] - clip_a[i]) * t;
+        }
+
+        const float ndc_x = clip[0] / clip[3];
+        const float ndc_y = clip[1] / clip[3];
+
+        x = viewport[0] + (ndc_x + 1.0f) * 0.5f * viewport[2];
+        y = framebuffer.height - (viewport[1] + (ndc_y + 1.0f) * 0.5f * viewport[3]);
+    };
+
+    LineSegment& segment = pending.emplace_back();
+    segment.color = color;
+
+    to_image(t0, segment.x0, segment.y0);
+    to_image(t1, segment.x1, segment.y1);
+
+    lines_drawn += 1;
+}
+
+} // namespace Core
@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SoftwareRenderDevice.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "RecordingRenderDevice.hpp"
+#include "SoftwareRasterizer.hpp"
+
+namespace Core {
+
+class JobSystem;
+
+////////////////////////////////////////////////////////////////////////////////
+// Software Render Device
+// --CPU reference renderer: records like RecordingRenderDevice and also
+//   rasterizes every draw into an RGBA8 framebuffer, so frames can be
+//   checked against golden images on machines without a GPU.
+// --Runs the vertex stage of the template's two programs on the CPU: a
+//   program with a "Camera" block gets u_Proj_mat * u_View_mat * u_Model_mat
+//   and u_Color_vec, otherwise per-instance attributes at locations 1-4 are
+//   used when the vertex array has them. Positions are attribute 0 scaled by
+//   u_Position_extent.
+// --Lines are 1 pixel wide, not antialiased and not blended. Triangles are
+//   drawn as their outlines; the template only draws lines.
+// --Draws are queued as segments and rasterized tile-parallel on Flush(),
+//   which Clear() and EndFrame() call.
+////////////////////////////////////////////////////////////////////////////////
+class SoftwareRenderDevice : public RecordingRenderDevice {
+
+public:
+    SoftwareRenderDevice(int width, int height, JobSystem* jobs = nullptr);
+
+    const char* Name() const override { return "Software"; }
+
+    void SetJobSystem(JobSystem* jobs) { job_system = jobs; }
+
+    // rasterizes every draw queued since the last flush
+    void Flush();
+
+    const Framebuffer& Target() const { return framebuffer; }
+    std::size_t LinesDrawn() const { return lines_drawn; }
+
+    // PPM if path ends in ".ppm", PNG otherwise
+    bool WriteImage(const std::string& path) const;
+
+protected:
+    void BeginFrameImpl() override;
+    void EndFrameImpl() override;
+
+    void SetViewportImpl(int x, int y, int width, int height) override;
+    void ClearImpl(const float* color_vec) override;
+
+    void DrawImpl(const DrawCall& draw) override;
+
+private:
+    // clip space endpoints through the viewport, flipped to image rows
+    void EmitLine(const float* clip_a, const float* clip_b, std::uint32_t color);
+
+    Framebuffer framebuffer;
+    LineRasterizer rasterizer;
+    JobSystem* job_system = nullptr;
+
+    int viewport[4] {};
+    std::vector<LineSegment> pending;
+    std::size_t lines_drawn = 0;     // segments queued this frame
+};
+
+} // namespace Core
@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SoftwareRenderDevice.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SoftwareRenderDevice.hpp"
+#include "BatchRenderer.hpp"
+#include "JobSystem.hpp"
+#include "MeshRegistry.hpp"
+#include "Models.hpp"
+#include "UniformBuffer.hpp"
+#include "UnitTest.hpp"
+
+#include <cstdio>
+#include <string>
+
+#define GOLDEN_SIZE         32      // golden images are GOLDEN_SIZE square
+#define GOLDEN_TOLERANCE    2       // differing pixels allowed, for float rounding
+
+using namespace Core;
+
+constexpr NameHash U_MODEL_MAT = HashName("u_Model_mat");
+constexpr NameHash U_COLOR_VEC = HashName("u_Color_vec");
+constexpr NameHash U_POSITION_EXTENT = HashName("u_Position_extent");
+constexpr NameHash CAMERA_BLOCK = HashName("Camera");
+
+static const float black_color_vec[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+static const float white_color_vec[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+////////////////////////////////////////////////////////////////////////////////
+// Golden Images
+// --Each model at a quarter scale in a GOLDEN_SIZE framebuffer with a
+//   GOLDEN_SIZE ortho projection, '#' for drawn pixels. Both the per-entity
+//   and the batched path must produce them.
+////////////////////////////////////////////////////////////////////////////////
+static const char* square_golden[GOLDEN_SIZE] = {
+    "................................",
+    "................................",
+    "................................",
+    "...##########################...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...##########################...",
+    "................................",
+    "................................",
+    "................................",
+};
+
+static const char* hexagon_golden[GOLDEN_SIZE] = {
+    "................................",
+    "................................",
+    "................................",
+    "................................",
+    "................................",
+    ".........##############.........",
+    "........#..............#........",
+    "........#..............#........",
+    ".......#................#.......",
+    ".......#................#.......",
+    "......#..................#......",
+    "......#..................#......",
+    ".....#....................#.....",
+    "....#......................#....",
+    "....#......................#....",
+    "...#........................#...",
+    "...#........................#...",
+    "....#......................#....",
+    "....#......................#....",
+    ".....#....................#.....",
+    "......#..................#......",
+    "......#..................#......",
+    ".......#................#.......",
+    ".......#................#.......",
+    "........#..............#........",
+    "........#..............#........",
+    ".........##############.........",
+    "................................",
+    "................................",
+    "................................",
+    "................................",
+    "................................",
+};
+
+static const char* circle_golden[GOLDEN_SIZE] = {
+    "................................",
+    "................................",
+    "................................",
+    ".............######.............",
+    "..........###......###..........",
+    ".........#............#.........",
+    ".......##..............##.......",
+    "......#..................#......",
+    "......#..................#......",
+    ".....#....................#.....",
+    "....#......................#....",
+    "....#......................#....",
+    "....#......................#....",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "...#........................#...",
+    "....#......................#....",
+    "....#......................#....",
+    "....#......................#....",
+    ".....#....................#.....",
+    "......#..................#......",
+    "......#..................#......",
+    ".......##..............##.......",
+    ".........#............#.........",
+    "..........###......###..........",
+    ".............######.............",
+    "................................",
+    "................................",
+    "................................",
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Scene
+// --The app's setup in miniature: one shared mesh registry, the line program
+//   with the camera block and the instanced program behind a BatchRenderer.
+////////////////////////////////////////////////////////////////////////////////
+struct Scene {
+
+    explicit Scene(const float* line_vertices, std::size_t float_count, JobSystem* jobs = nullptr)
+        : device(GOLDEN_SIZE, GOLDEN_SIZE, jobs) {
+
+        mesh = registry.Register(BuildIndexedMesh(line_vertices, float_count));
+        registry.Upload(device);
+
+        const float position_extent = POSITION_EXTENT;
+
+        line_program = device.CreateProgram("line vs", "line fs");
+        instanced_program = device.CreateProgram("instanced vs", "instanced fs");
+
+        camera.Create(device, 32 * sizeof(float), 0);
+        device.BindUniformBlock(line_program, CAMERA_BLOCK, camera.Binding());
+
+        float camera_mats[32];
+        proj_mat.ToMat4(camera_mats);
+        Affine2D::Identity().ToMat4(camera_mats + 16);
+        camera.Update(camera_mats, sizeof(camera_mats));
+
+        device.UseProgram(line_program);
+        device.SetUniform(U_POSITION_EXTENT, UniformType::Float, &position_extent);
+        device.UseProgram(instanced_program);
+        device.SetUniform(U_POSITION_EXTENT, UniformType::Float, &position_extent);
+
+        batch.Init(device, instanced_program, registry, 4);
+    }
+
+    void DrawPerEntity(const Affine2D& model) {
+
+        float model_mat[16];
+        model.ToMat4(model_mat);
+
+        device.BeginFrame();
+        device.Clear(black_color_vec);
+
+        device.UseProgram(line_program);
+        registry.Bind();
+        device.SetUniform(U_MODEL_MAT, UniformType::Mat4, model_mat);
+        device.SetUniform(U_COLOR_VEC, UniformType::Vec4, white_color_vec);
+        registry.Draw(mesh);
+
+        device.EndFrame();
+    }
+
+    void DrawBatched(const Affine2D& model) {
+
+        device.BeginFrame();
+        device.Clear(black_color_vec);
+
+        batch.Begin();
+        batch.Submit(mesh, proj_mat * model, white_color_vec);
+        batch.Flush();
+
+        device.EndFrame();
+    }
+
+    SoftwareRenderDevice device;
+    MeshRegistry registry;
+    BatchRenderer batch;
+    UniformBuffer camera;
+
+    MeshId mesh{};
+    ProgramId line_program{};
+    ProgramId instanced_program{};
+
+    const Affine2D proj_mat = Affine2D::Ortho(-GOLDEN_SIZE / 2.0f, GOLDEN_SIZE / 2.0f,
+                                              -GOLDEN_SIZE / 2.0f, GOLDEN_SIZE / 2.0f);
+};
+
+// writes <name>.actual.ppm next to the test when the image does not match
+static bool MatchesGolden(const SoftwareRenderDevice& device, const char* const* golden, const char* name) {
+
+    const Framebuffer& target = device.Target();
+    const std::uint32_t background = PackColor(black_color_vec);
+
+    int differences = 0;
+
+    for (int y = 0; y < GOLDEN_SIZE; ++y) {
+
+        for (int x = 0; x < GOLDEN_SIZE; ++x) {
+
+            const bool drawn = target.At(x, y) != background;
+            differences += drawn != (golden[y][x] == '#') ? 1 : 0;
+        }
+    }
+
+    if (differences > GOLDEN_TOLERANCE) {
+
+        std::printf("%s: %d pixels differ from the golden image\n", name, differences);
+        device.WriteImage(std::string(name) + ".actual.ppm");
+        return false;
+    }
+
+    return true;
+}
+
+static const Affine2D quarter_scale = Affine2D::Scale(0.25f, 0.25f);
+
+TEST_CASE(SquareMatchesGolden) {
+
+    Scene scene(square_vertices.data(), square_vertices.size());
+
+    scene.DrawPerEntity(quarter_scale);
+    CHECK(MatchesGolden(scene.device, square_golden, "square_per_entity"));
+
+    scene.DrawBatched(quarter_scale);
+    CHECK(MatchesGolden(scene.device, square_golden, "square_batched"));
+}
+
+TEST_CASE(HexagonMatchesGolden) {
+
+    Scene scene(hexagon_vertices.data(), hexagon_vertices.size());
+
+    scene.DrawPerEntity(quarter_scale);
+    CHECK(MatchesGolden(scene.device, hexagon_golden, "hexagon_per_entity"));
+
+    scene.DrawBatched(quarter_scale);
+    CHECK(MatchesGolden(scene.device, hexagon_golden, "hexagon_batched"));
+}
+
+TEST_CASE(CircleMatchesGolden) {
+
+
+    Scene scene(circle_vertices.data(), circle_vertices.size());
+
+    scene.DrawPerEntity(quarter_scale);
+    CHECK(MatchesGolden(scene.device, circle_golden, "circle_per_entity"));
+
+    scene.DrawBatched(quarter_scale);
+    CHECK(MatchesGolden(scene.device, circle_golden, "circle_batched"));
+}
+
+TEST_CASE(PositiveYIsUpAndViewportApplies) {
+
+    Scene scene(square_vertices.data(), square_vertices.size());
+
+    // the bottom-left quadrant in GL terms is the bottom-left of the image
+    scene.device.SetViewport(0, 0, GOLDEN_SIZE / 2, GOLDEN_SIZE / 2);
+    scene.DrawPerEntity(Affine2D::Translation(0.0f, 8.0f) * quarter_scale);
+
+    const Framebuffer& target = scene.device.Target();
+    const std::uint32_t background = PackColor(black_color_vec);
+
+    int top_half = 0;
+    int bottom_left = 0;
+
+    for (int y = 0; y < GOLDEN_SIZE; ++y) {
+
+        for (int x = 0; x < GOLDEN_SIZE; ++x) {
+
+            const bool drawn = target.At(x, y) != background;
+
+            top_half += drawn && y < GOLDEN_SIZE / 2 ? 1 : 0;
+            bottom_left += drawn && y >= GOLDEN_SIZE / 2 && x < GOLDEN_SIZE / 2 ? 1 : 0;
+        }
+    }
+
+    CHECK(top_half == 0);
+    CHECK(bottom_left > 0);
+}
+
+TEST_CASE(ClearDiscardsEarlierDraws) {
+
+    Scene scene(square_vertices.data(), square_vertices.size());
+
+    float model_mat[16];
+    quarter_scale.ToMat4(model_mat);
+
+    scene.device.BeginFrame();
+    scene.device.UseProgram(scene.line_program);
+    scene.registry.Bind();
+    scene.device.SetUniform(U_MODEL_MAT, UniformType::Mat4, model_mat);
+    scene.registry.Draw(scene.mesh);
+    scene.device.Clear(black_color_vec);
+    scene.device.EndFrame();
+
+    const std::uint32_t background = PackColor(black_color_vec);
+
+    for (std::uint32_t pixel : scene.device.Target().pixels) {
+
+        CHECK(pixel == background);
+    }
+
+    CHECK(scene.device.LinesDrawn() > 0);
+    CHECK(scene.device.CountCommands(RenderCommandType::Draw) == 1);
+}
+
+TEST_CASE(JobSystemRendersTheSameImage) {
+
+
+    JobSystem jobs(2);
+
+    Scene serial(circle_vertices.data(), circle_vertices.size());
+    Scene parallel(circle_vertices.data(), circle_vertices.size(), &jobs);
+
+    serial.DrawBatched(Affine2D::Scale(0.3f, 0.3f));
+    parallel.DrawBatched(Affine2D::Scale(0.3f, 0.3f));
+
+    jobs.WaitAll();
+
+    CHECK(parallel.device.Target().pixels == serial.device.Target().pixels);
+}
+
+int main() { return Core::Test::RunAll(); }
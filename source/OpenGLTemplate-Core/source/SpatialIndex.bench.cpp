@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SpatialIndex.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SpatialIndex.hpp"
+#include "BatchRenderer.hpp"
+#include "Benchmark.hpp"
+#include "EntityStore.hpp"
+#include "InstanceBuilder.hpp"
+#include "JobSystem.hpp"
+#include "Models.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+
+#define ENTITY_COUNT    1000000
+#define WORLD_EXTENT    100000.0f   // entities spread over +-extent world units
+#define VIEW_WIDTH      1920.0f
+#define VIEW_HEIGHT     1080.0f
+#define FRAME_COUNT     100         // frames per timed run of the full frame
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : ENTITY_COUNT;
+
+    MeshRegistry meshes;
+    const MeshId square = meshes.Register(BuildIndexedMesh(square_vertices.data(), square_vertices.size()));
+    const float radius = meshes.Range(square).bounding_radius;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-WORLD_EXTENT, WORLD_EXTENT);
+
+    EntityStore store;
+    store.Reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        store.Create(EntityDesc{position(rng), position(rng), 0.0f, 1.0f, 1.0f, Color{}, square});
+    }
+
+    SpatialIndex index;
+
+    Bench::Run("build index", count, [&]() {
+
+        index.Clear();
+
+        for (std::uint32_t i = 0; i < store.Size(); ++i) {
+
+            index.Insert(store.HandleAt(i).slot, store.PositionX()[i], store.PositionY()[i], radius);
+        }
+    }, 1);
+
+    const Affine2D view_proj = Affine2D::Ortho(-0.5f * VIEW_WIDTH, 0.5f * VIEW_WIDTH,
+                                               -0.5f * VIEW_HEIGHT, 0.5f * VIEW_HEIGHT);
+
+    JobSystem jobs(std::max(1u, std::thread::hardware_concurrency()));
+    InstanceBuilder builder;
+    BatchRenderer batch;
+
+    std::printf("%zu entities, %.0f x %.0f view over a %.0f world\n",
+                count, VIEW_WIDTH, VIEW_HEIGHT, 2.0f * WORLD_EXTENT);
+
+    const double full = Bench::Run("full build (test every entity)", count, [&]() {
+
+        batch.Reset(meshes.MeshCount());
+        builder.Build(jobs, store, meshes, view_proj, batch);
+        jobs.WaitAll();
+    });
+
+    const std::size_t full_visible = builder.VisibleCount();
+
+    std::vector<std::uint32_t> slots;
+    std::vector<std::uint32_t> visible;
+
+    // what the app does each frame: query the view, then build the subset
+    auto build_visible = [&](float alpha) {
+
+        slots.clear();
+        index.Query(VisibleBounds(view_proj), slots);
+
+        visible.resize(slots.size());
+
+        for (std::size_t n = 0; n < slots.size(); ++n) {
+
+            visible[n] = store.IndexOfSlot(slots[n]);
+        }
+
+        std::sort(visible.begin(), visible.end());
+
+        batch.Reset(meshes.MeshCount());
+        builder.Build(jobs, store, meshes, view_proj, batch, alpha, &visible);
+        jobs.WaitAll();
+    };
+
+    const double indexed = Bench::Run("query + subset build", count, [&]() { build_visible(1.0f); });
+
+    std::printf("  visible %zu / %zu, candidates %zu, speedup %.1fx\n",
+                builder.VisibleCount(), full_visible, visible.size(), full / indexed);
+
+    // a whole app frame: a fixed step that moves one entity, its index
+    // update, then the query and an interpolated subset build
+    const std::uint32_t user = 0;
+
+    Bench::Run("full frame (step + query + build)", FRAME_COUNT, [&]() {
+
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+
+            store.BeginStep();
+            store.SaveTransform(user);
+            store.PositionX()[user] += 1.0f;
+            index.Update(store.HandleAt(user).slot, store.PositionX()[user], store.PositionY()[user], radius);
+
+            build_visible(0.5f);
+        }
+    });
+
+    // everything drifts a little, few cross a cell boundary
+    const std::size_t moved = std::min<std::size_t>(count, 100000);
+
+    Bench::Run("update moved entities", moved, [&]() {
+
+        for (std::uint32_t i = 0; i < moved; ++i) {
+
+            float* x = store.PositionX();
+            x[i] += 3.0f;
+            index.Update(store.HandleAt(i).slot, x[i], store.PositionY()[i], radius);
+        }
+    });
+
+    return 0;
+}
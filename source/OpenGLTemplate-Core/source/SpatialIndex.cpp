@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SpatialIndex.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SpatialIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core {
+
+#define SPATIAL_MAX_COORDINATE  (1 << 30)   // cell coordinates are clamped to this
+
+bool Bounds2D::OverlapsCircle(float x, float y, float radius) const {
+
+    const float dx = x - std::clamp(x, min_x, max_x);
+    const float dy = y - std::clamp(y, min_y, max_y);
+
+    return dx * dx + dy * dy <= radius * radius;
+}
+
+Bounds2D Union(const Bounds2D& lhs, const Bounds2D& rhs) {
+
+    return Bounds2D{std::min(lhs.min_x, rhs.min_x), std::min(lhs.min_y, rhs.min_y),
+                    std::max(lhs.max_x, rhs.max_x), std::max(lhs.max_y, rhs.max_y)};
+}
+
+Bounds2D VisibleBounds(const Affine2D& view_proj) {
+
+    const Affine2D clip_to_world = Inverse(view_proj);
+
+    Bounds2D bounds;
+    bounds.min_x = bounds.min_y = INFINITY;
+    bounds.max_x = bounds.max_y = -INFINITY;
+
+    for (float corner_x : {-1.0f, 1.0f}) {
+
+        for (float corner_y : {-1.0f, 1.0f}) {
+
+            float x;
+            float y;
+            clip_to_world.Apply(corner_x, corner_y, x, y);
+
+            bounds.min_x = std::min(bounds.min_x, x);
+            bounds.min_y = std::min(bounds.min_y, y);
+            bounds.max_x = std::max(bounds.max_x, x);
+            bounds.max_y = std::max(bounds.max_y, y);
+        }
+    }
+
+    return bounds;
+}
+
+SpatialIndex::SpatialIndex(float size)
+    : cell_size(size), inverse_cell_size(1.0f / size) {}
+
+int SpatialIndex::CellCoordinate(float value) const {
+
+    const float cell = std::floor(value * inverse_cell_size);
+
+    return static_cast<int>(std::clamp(cell, static_cast<float>(-SPATIAL_MAX_COORDINATE),
+                                             static_cast<float>(SPATIAL_MAX_COORDINATE)));
+}
+
+std::uint64_t SpatialIndex::CellKey(float x, float y) const {
+
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(CellCoordinate(x))) << 32 |
+           static_cast<std::uint32_t>(CellCoordinate(y));
+}
+
+void SpatialIndex::Insert(std::uint32_t id, float x, float y, float radius) {
+
+    if (Contains(id)) {
+
+        Update(id, x, y, radius);
+        return;
+    }
+
+    if (id >= items.size()) {
+
+        items.resize(id + 1);
+    }
+
+    Item& item = items[id];
+    item.x = x;
+    item.y = y;
+    item.radius = radius;
+    item.alive = true;
+
+    Link(id);
+    item_count += 1;
+}
+
+void SpatialIndex::Update(std::uint32_t id, float x, float y, float radius) {
+
+    Item& item = items[id];
+
+    const bool oversized_now = radius > cell_size * 0.5f;
+    const bool moved_cell = oversized_now != item.oversized ||
+                            (!oversized_now && CellKey(x, y) != item.cell);
+
+    if (moved_cell) {
+
+        Unlink(id);
+    }
+
+    item.x = x;
+    item.y = y;
+    item.radius = radius;
+
+    if (moved_cell) {
+
+        Link(id);
+    }
+}
+
+void SpatialIndex::Remove(std::uint32_t id) {
+
+    if (!Contains(id)) {
+
+        return;
+    }
+
+    Unlink(id);
+    items[id].alive = false;
+    item_count -= 1;
+}
+
+void SpatialIndex::Clear() {
+
+    items.clear();
+    cells.clear();
+    oversized.clear();
+    item_count = 0;
+}
+
+void SpatialIndex::Link(std::uint32_t id) {
+
+    Item& item = items[id];
+    item.oversized = item.radius > cell_size * 0.5f;
+
+    std::vector<std::uint32_t>* list = &oversized;
+
+    if (!item.oversized) {
+
+        item.cell = CellKey(item.x, item.y);
+        list = &cells[item.cell];
+    }
+
+    item.position = static_cast<std::uint32_t>(list->size());
+    list->push_back(id);
+}
+
+void SpatialIndex::Unlink(std::uint32_t id) {
+
+    const Item& item = items[id];
+
+    auto cell = cells.end();
+    std::vector<std::uint32_t>* list = &oversized;
+
+    if (!item.oversized) {
+
+        cell = cells.find(item.cell);
+        list = &cell->second;
+    }
+
+    // swap the last item of the list into the hole
+    const std::uint32_t last = list->back();
+    (*list)[item.position] = last;
+    items[last].position = item.position;
+    list->pop_back();
+
+    if (cell != cells.end() && list->empty()) {
+
+        cells.erase(cell);
+    }
+}
+
+void SpatialIndex::Query(const Bounds2D& bounds, std::vector<std::uint32_t>& out) const {
+
+    auto collect = [&](const std::vector<std::uint32_t>& list) {
+
+        for (std::uint32_t id : list) {
+
+            const Item& item = items[id];
+
+            if (bounds.OverlapsCircle(item.x, item.y, item.radius)) {
+
+                out.push_back(id);
+            }
+        }
+    };
+
+    collect(oversized);
+
+    // grid items reach at most half a cell past their own cell
+    const float margin = cell_size * 0.5f;
+
+    const int min_x = CellCoordinate(bounds.min_x - margin);
+    const int min_y = CellCoordinate(bounds.min_y - margin);
+    const int max_x = CellCoordinate(bounds.max_x + margin);
+    const int max_y = CellCoordinate(bounds.max_y + margin);
+
+    const double covered = (static_cast<double>(max_x) - min_x + 1.0) *
+                           (static_cast<double>(max_y) - min_y + 1.0);
+
+    // zoomed far out: walking the occupied cells is cheaper than the range
+    if (covered > static_cast<double>(cells.size())) {
+
+        for (const auto& cell : cells) {
+
+            collect(cell.second);
+        }
+
+        return;
+    }
+
+    for (int y = min_y; y <= max_y; ++y) {
+
+        for (int x = min_x; x <= max_x; ++x) {
+
+            const std::uint64_t key = static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32 |
+                                      static_cast<std::uint32_t>(y);
+
+            auto cell = cells.find(key);
+
+            if (cell != cells.end()) {
+
+                collect(cell->second);
+            }
+        }
+    }
+}
+
+} // namespace Core
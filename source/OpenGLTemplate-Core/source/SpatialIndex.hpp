@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SpatialIndex.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Affine2D.hpp"
+
+#define SPATIAL_CELL_SIZE   256.0f  // world units per grid cell side
+
+namespace Core {
+
+// axis-aligned box in world units
+struct Bounds2D {
+
+    float min_x = 0.0f;
+    float min_y = 0.0f;
+    float max_x = 0.0f;
+    float max_y = 0.0f;
+
+    bool OverlapsCircle(float x, float y, float radius) const;
+};
+
+Bounds2D Union(const Bounds2D& lhs, const Bounds2D& rhs);
+
+// world box around everything view_proj maps into the [-1, 1] view square,
+// rotated views included
+Bounds2D VisibleBounds(const Affine2D& view_proj);
+
+////////////////////////////////////////////////////////////////////////////////
+// Spatial Index
+// --Loose uniform grid over bounding circles. An item lives in the one cell
+//   that holds its center, so moving it only touches the grid when it
+//   crosses into another cell; queries look half a cell further out.
+// --Items larger than half a cell (the coordinate axes) are kept in a short
+//   list that every query tests, so they do not widen every query.
+// --Cells are hashed and only exist while occupied, so the world is
+//   unbounded. Queries cost about the number of cells they cover plus the
+//   items found, independent of the total item count.
+// --Ids are small integers such as entity slots; storage grows to the
+//   largest id. Queries may run concurrently, changes may not.
+////////////////////////////////////////////////////////////////////////////////
+class SpatialIndex {
+
+public:
+    explicit SpatialIndex(float cell_size = SPATIAL_CELL_SIZE);
+
+    void Insert(std::uint32_t id, float x, float y, float radius);
+    void Update(std::uint32_t id, float x, float y, float radius);
+    void Remove(std::uint32_t id);
+    void Clear();
+
+    bool Contains(std::uint32_t id) const { return id < items.size() && items[id].alive; }
+    std::size_t Size() const { return item_count; }
+    std::size_t CellCount() const { return cells.size(); }
+
+    // appends every id whose bounding circle overlaps bounds, in no set order
+    void Query(const Bounds2D& bounds, std::vector<std::uint32_t>& out) const;
+
+private:
+    struct Item {
+
+        float x = 0.0f;
+        float y = 0.0f;
+        float radius = 0.0f;
+
+        std::uint64_t cell = 0;
+        std::uint32_t position = 0;     // index in its cell or in oversized
+        bool oversized = false;
+        bool alive = false;
+    };
+
+    int CellCoordinate(float value) const;
+    std::uint64_t CellKey(float x, float y) const;
+
+    void Link(std::uint32_t id);
+    void Unlink(std::uint32_t id);
+
+    float cell_size;
+    float inverse_cell_size;
+
+    std::vector<Item> items;
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> cells;
+    std::vector<std::uint32_t> oversized;
+
+    std::size_t item_count = 0;
+};
+
+} // namespace Core
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: SpatialIndex.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "SpatialIndex.hpp"
+#include "UnitTest.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+struct Circle {
+
+    float x;
+    float y;
+    float radius;
+};
+
+static std::vector<std::uint32_t> BruteForce(const std::vector<Circle>& circles,
+                                             const std::vector<bool>& alive, const Bounds2D& bounds) {
+
+    std::vector<std::uint32_t> ids;
+
+    for (std::uint32_t id = 0; id < circles.size(); ++id) {
+
+        if (alive[id] && bounds.OverlapsCircle(circles[id].x, circles[id].y, circles[id].radius)) {
+
+            ids.push_back(id);
+        }
+    }
+
+    return ids;
+}
+
+static std::vector<std::uint32_t> SortedQuery(const SpatialIndex& index, const Bounds2D& bounds) {
+
+    std::vector<std::uint32_t> ids;
+    index.Query(bounds, ids);
+    std::sort(ids.begin(), ids.end());
+
+    return ids;
+}
+
+TEST_CASE(CircleOverlapUsesTheClosestPoint) {
+
+    const Bounds2D box {0.0f, 0.0f, 10.0f, 10.0f};
+
+    CHECK(box.OverlapsCircle(5.0f, 5.0f, 0.1f));
+    CHECK(box.OverlapsCircle(12.0f, 5.0f, 2.0f));
+    CHECK(!box.OverlapsCircle(12.0f, 5.0f, 1.9f));
+
+    // near a corner the distance is diagonal
+    CHECK(!box.OverlapsCircle(12.0f, 12.0f, 2.5f));
+    CHECK(box.OverlapsCircle(12.0f, 12.0f, 2.9f));
+}
+
+TEST_CASE(VisibleBoundsCoverRotatedViews) {
+
+    const Affine2D proj = Affine2D::Ortho(-100.0f, 100.0f, -50.0f, 50.0f);
+
+    const Bounds2D straight = VisibleBounds(proj);
+
+    CHECK_NEAR(straight.min_x, -100.0f, 1e-3f);
+    CHECK_NEAR(straight.max_y, 50.0f, 1e-3f);
+
+    // a quarter turn swaps the extents, and the camera offset moves them
+    const Affine2D view = Affine2D::Rotation(1.5707964f) * Affine2D::Translation(-30.0f, 0.0f);
+    const Bounds2D turned = VisibleBounds(proj * view);
+
+    CHECK_NEAR(turned.min_x, 30.0f - 50.0f, 1e-3f);
+    CHECK_NEAR(turned.max_x, 30.0f + 50.0f, 1e-3f);
+    CHECK_NEAR(turned.max_y, 100.0f, 1e-3f);
+}
+
+TEST_CASE(QueriesMatchBruteForce) {
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> position(-5000.0f, 5000.0f);
+    std::uniform_real_distribution<float> radius(0.5f, 60.0f);
+    std::uniform_real_distribution<float> size(10.0f, 3000.0f);
+
+    std::vector<Circle> circles(5000);
+    std::vector<bool> alive(circles.size(), true);
+
+    SpatialIndex index(128.0f);
+
+    for (std::uint32_t id = 0; id < circles.size(); ++id) {
+
+        circles[id] = Circle{position(rng), position(rng), radius(rng)};
+
+        // a few larger than any cell
+        if (id % 500 == 0) {
+
+            circles[id].radius = 1000.0f;
+        }
+
+        index.Insert(id, circles[id].x, circles[id].y, circles[id].radius);
+    }
+
+    for (int round = 0; round < 3; ++round) {
+
+        for (int query = 0; query < 50; ++query) {
+
+            const float x = position(rng);
+            const float y = position(rng);
+            const Bounds2D bounds {x, y, x + size(rng), y + size(rng)};
+
+            CHECK(SortedQuery(index, bounds) == BruteForce(circles, alive, bounds));
+        }
+
+        // move, grow and remove a third of the items between rounds
+        for (std::uint32_t id = round; id < circles.size(); id += 3) {
+
+            if (id % 7 == 0) {
+
+                index.Remove(id);
+                alive[id] = false;
+                continue;
+            }
+
+            circles[id].x += position(rng) * 0.01f;
+            circles[id].y += position(rng) * 0.01f;
+            circles[id].radius = id % 11 == 0 ? 200.0f : radius(rng);
+
+            index.Update(id, circles[id].x, circles[id].y, circles[id].radius);
+        }
+    }
+
+    // far out the query walks occupied cells instead of the range
+    const Bounds2D everything {-1e9f, -1e9f, 1e9f, 1e9f};
+    CHECK(SortedQuery(index, everything) == BruteForce(circles, alive, everything));
+}
+
+TEST_CASE(EmptyCellsAreReleased) {
+
+    SpatialIndex index(100.0f);
+
+    index.Insert(4, 10.0f, 10.0f, 1.0f);
+    index.Insert(9, 20.0f, 20.0f, 1.0f);
+
+    CHECK(index.Size() == 2);
+    CHECK(index.CellCount() == 1);
+
+    index.Update(4, 550.0f, 10.0f, 1.0f);
+    CHECK(index.CellCount() == 2);
+
+    index.Remove(9);
+    index.Remove(9);
+
+    CHECK(!index.Contains(9));
+    CHECK(index.Contains(4));
+    CHECK(index.Size() == 1);
+    CHECK(index.CellCount() == 1);
+
+    std::vector<std::uint32_t> ids;
+    index.Query(Bounds2D{500.0f, 0.0f, 600.0f, 20.0f}, ids);
+
+    CHECK(ids.size() == 1 && ids[0] == 4);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: StartupTracer.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "StartupTracer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+namespace Core {
+
+static std::int64_t SteadyNanoseconds() {
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static double Milliseconds(std::int64_t nanoseconds) {
+
+    return nanoseconds / 1e6;
+}
+
+StartupTracer::StartupTracer()
+    : start_ns(SteadyNanoseconds()) {
+
+    threads.push_back(std::this_thread::get_id());
+}
+
+std::int64_t StartupTracer::NowNanoseconds() const {
+
+    return SteadyNanoseconds() - start_ns;
+}
+
+std::uint32_t StartupTracer::ThreadIndex(std::thread::id thread) {
+
+    const auto found = std::find(threads.begin(), threads.end(), thread);
+
+    if (found != threads.end()) {
+
+        return static_cast<std::uint32_t>(found - threads.begin());
+    }
+
+    threads.push_back(thread);
+    return static_cast<std::uint32_t>(threads.size() - 1);
+}
+
+std::size_t StartupTracer::Begin(const char* name) {
+
+    const std::int64_t now = NowNanoseconds();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    phases.push_back(StartupPhase{name, ThreadIndex(std::this_thread::get_id()), now, -1});
+    return phases.size() - 1;
+}
+
+void StartupTracer::End(std::size_t phase) {
+
+    const std::int64_t now = NowNanoseconds();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (phase < phases.size() && phases[phase].end_ns < 0) {
+
+        phases[phase].end_ns = now;
+    }
+}
+
+void StartupTracer::MarkFirstFrame() {
+
+    const std::int64_t now = NowNanoseconds();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (first_frame_ns < 0) {
+
+        first_frame_ns = now;
+    }
+}
+
+std::vector<StartupPhase> StartupTracer::Phases() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return phases;
+}
+
+std::size_t StartupTracer::ThreadCount() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return threads.size();
+}
+
+std::int64_t StartupTracer::FirstFrameNanoseconds() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return first_frame_ns;
+}
+
+std::int64_t StartupTracer::BusyNanoseconds(std::uint32_t thread_index) const {
+
+    std::vector<std::pair<std::int64_t, std::int64_t>> spans;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (const StartupPhase& phase : phases) {
+
+            if (phase.thread_index == thread_index && phase.end_ns >= 0) {
+
+                spans.emplace_back(phase.begin_ns, phase.end_ns);
+            }
+        }
+    }
+
+    // nested and overlapping phases count once
+    std::sort(spans.begin(), spans.end());
+
+    std::int64_t busy = 0;
+    std::int64_t covered = 0;
+
+    for (const auto& span : spans) {
+
+        const std::int64_t begin = std::max(span.first, covered);
+
+        if (span.second > begin) {
+
+            busy += span.second - begin;
+            covered = span.second;
+        }
+    }
+
+    return busy;
+}
+
+void StartupTracer::WriteReport(std::ostream& out) const {
+
+    const std::vector<StartupPhase> snapshot = Phases();
+    const std::size_t thread_count = ThreadCount();
+    const std::int64_t first_frame = FirstFrameNanoseconds();
+
+    // the timeline spans up to the first frame, or the last phase to end
+    std::int64_t span = std::max<std::int64_t>(first_frame, 1);
+
+    for (const StartupPhase& phase : snapshot) {
+
+        span = std::max(span, phase.end_ns);
+    }
+
+    std::size_t name_width = 5;
+
+    for (const StartupPhase& phase : snapshot) {
+
+        name_width = std::max(name_width, std::string(phase.name).size());
+    }
+
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "%-*s  thread  start ms  dur ms\n", static_cast<int>(name_width), "phase");
+    out << line;
+
+    for (const StartupPhase& phase : snapshot) {
+
+        const std::int64_t end = phase.end_ns >= 0 ? phase.end_ns : span;
+
+        std::snprintf(line, sizeof(line), "%-*s  %6u  %8.2f  %6.2f%s  ", static_cast<int>(name_width), phase.name,
+                      phase.thread_index, Milliseconds(phase.begin_ns), Milliseconds(end - phase.begin_ns),
+                      phase.end_ns >= 0 ? " " : "+");
+        out << line;
+
+        // bar columns cover [begin, end), at least one so short phases show
+        const std::int64_t first_column = phase.begin_ns * STARTUP_REPORT_WIDTH / span;
+        const std::int64_t last_column = std::max(first_column + 1, end * STARTUP_REPORT_WIDTH / span);
+
+        out << '|';
+
+        for (std::int64_t column = 0; column < STARTUP_REPORT_WIDTH; ++column) {
+
+            out << (column >= first_column && column < last_column ? '#' : ' ');
+        }
+
+        out << "|\n";
+    }
+
+    if (first_frame >= 0) {
+
+        std::snprintf(line, sizeof(line), "time to first frame: %.2f ms\n", Milliseconds(first_frame));
+    }
+    else {
+
+        std::snprintf(line, sizeof(line), "time to first frame: not reached\n");
+    }
+
+    out << line;
+
+    for (std::uint32_t thread = 0; thread < thread_count; ++thread) {
+
+        std::snprintf(line, sizeof(line), "thread %u busy: %.2f ms\n", thread, Milliseconds(BusyNanoseconds(thread)));
+        out << line;
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: StartupTracer.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#define STARTUP_REPORT_WIDTH    48      // characters of the report's timeline bars
+
+namespace Core {
+
+struct StartupPhase {
+
+    const char* name;               // must outlive the tracer, normally a literal
+    std::uint32_t thread_index;     // 0 is the thread that created the tracer
+    std::int64_t begin_ns;          // since the tracer was created
+    std::int64_t end_ns;            // -1 while the phase is open
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Startup Tracer
+// --Records named init phases with steady clock timestamps, from any
+//   thread, up to MarkFirstFrame(). Phases are few and short-lived, so a
+//   mutex is fine here (unlike the per-frame Profiler).
+// --WriteReport() prints each phase with its thread, start and duration
+//   plus a timeline bar, then time to first frame and the busy time per
+//   thread, which shows how much init work overlapped.
+////////////////////////////////////////////////////////////////////////////////
+class StartupTracer {
+
+public:
+    StartupTracer();
+
+    // returns the phase to End()
+    std::size_t Begin(const char* name);
+    void End(std::size_t phase);
+
+    void MarkFirstFrame();
+
+    std::int64_t NowNanoseconds() const;
+
+    // in Begin() order
+    std::vector<StartupPhase> Phases() const;
+    std::size_t ThreadCount() const;
+
+    // -1 until MarkFirstFrame()
+    std::int64_t FirstFrameNanoseconds() const;
+
+    // time one thread spent in finished phases, nested phases counted once
+    std::int64_t BusyNanoseconds(std::uint32_t thread_index) const;
+
+    void WriteReport(std::ostream& out) const;
+
+private:
+    std::uint32_t ThreadIndex(std::thread::id thread);
+
+    const std::int64_t start_ns;
+
+    mutable std::mutex mutex;
+    std::vector<StartupPhase> phases;
+    std::vector<std::thread::id> threads;
+    std::int64_t first_frame_ns = -1;
+};
+
+// RAII phase on the calling thread
+class StartupScope {
+
+public:
+    StartupScope(StartupTracer& tracer, const char* name) : tracer(tracer), phase(tracer.Begin(name)) {}
+    ~StartupScope() { tracer.End(phase); }
+
+    StartupScope(const StartupScope&) = delete;
+    StartupScope& operator=(const StartupScope&) = delete;
+
+private:
+    StartupTracer& tracer;
+    std::size_t phase;
+};
+
+} // namespace Core
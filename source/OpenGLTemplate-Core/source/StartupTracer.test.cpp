@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: StartupTracer.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "StartupTracer.hpp"
+#include "UnitTest.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace Core;
+
+TEST_CASE(PhasesKeepBeginOrderAndNest) {
+
+    StartupTracer tracer;
+
+    {
+        StartupScope outer(tracer, "outer");
+        StartupScope inner(tracer, "inner");
+    }
+
+    const std::vector<StartupPhase> phases = tracer.Phases();
+
+    CHECK(phases.size() == 2);
+    CHECK(std::string(phases[0].name) == "outer");
+    CHECK(std::string(phases[1].name) == "inner");
+    CHECK(phases[0].thread_index == 0);
+    CHECK(phases[0].begin_ns <= phases[1].begin_ns);
+    CHECK(phases[1].begin_ns <= phases[1].end_ns);
+    CHECK(phases[1].end_ns <= phases[0].end_ns);
+    CHECK(tracer.BusyNanoseconds(0) == phases[0].end_ns - phases[0].begin_ns);
+}
+
+TEST_CASE(OtherThreadsGetTheirOwnIndex) {
+
+    StartupTracer tracer;
+    tracer.End(tracer.Begin("main"));
+
+    std::thread worker([&tracer]() {
+
+        StartupScope scope(tracer, "worker");
+    });
+    worker.join();
+
+    tracer.End(tracer.Begin("main again"));
+
+    const std::vector<StartupPhase> phases = tracer.Phases();
+
+    CHECK(tracer.ThreadCount() == 2);
+    CHECK(phases[0].thread_index == 0);
+    CHECK(phases[1].thread_index == 1);
+    CHECK(phases[2].thread_index == 0);
+    CHECK(tracer.BusyNanoseconds(1) == phases[1].end_ns - phases[1].begin_ns);
+}
+
+TEST_CASE(FirstFrameIsMarkedOnce) {
+
+    StartupTracer tracer;
+
+    CHECK(tracer.FirstFrameNanoseconds() == -1);
+
+    tracer.MarkFirstFrame();
+    const std::int64_t first_frame = tracer.FirstFrameNanoseconds();
+    tracer.MarkFirstFrame();
+
+    CHECK(first_frame >= 0);
+    CHECK(tracer.FirstFrameNanoseconds() == first_frame);
+}
+
+TEST_CASE(ReportListsPhasesAndTimeToFirstFrame) {
+
+    StartupTracer tracer;
+    tracer.End(tracer.Begin("window"));
+    tracer.Begin("still open");
+
+    std::ostringstream before;
+    tracer.WriteReport(before);
+
+    CHECK(before.str().find("window") != std::string::npos);
+    CHECK(before.str().find("not reached") != std::string::npos);
+
+    tracer.MarkFirstFrame();
+
+    std::ostringstream after;
+    tracer.WriteReport(after);
+
+    CHECK(after.str().find("still open") != std::string::npos);
+    CHECK(after.str().find("time to first frame: ") != std::string::npos);
+    CHECK(after.str().find("thread 0 busy") != std::string::npos);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: StreamBuffer.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "StreamBuffer.hpp"
+
+namespace Core {
+
+const char* StreamModeName(StreamMode mode) {
+
+    switch (mode) {
+
+        case(StreamMode::Persistent): return "persistent mapped";
+        case(StreamMode::Orphaning): return "orphaning";
+    }
+
+    return "?";
+}
+
+void StreamBuffer::Init(RenderDevice& target, BufferTarget buffer_target, std::size_t capacity) {
+
+    device = &target;
+    frame_capacity = capacity;
+    cursor = 0;
+    flushed = 0;
+    region = 0;
+
+    void* mapped = nullptr;
+    buffer = device->CreateMappedBuffer(buffer_target, capacity * STREAM_FRAME_COUNT, &mapped);
+
+    if (buffer) {
+
+        mode = StreamMode::Persistent;
+        mapping = static_cast<std::uint8_t*>(mapped);
+    }
+    else {
+
+        mode = StreamMode::Orphaning;
+        buffer = device->CreateBuffer(buffer_target, capacity, nullptr, BufferUsage::Stream);
+        staging.resize(capacity);
+    }
+}
+
+void StreamBuffer::Shutdown() {
+
+    if (!device) {
+
+        return;
+    }
+
+    for (FenceId& fence : fences) {
+
+        device->DeleteFence(fence);
+        fence = 0;
+    }
+
+    device->DestroyBuffer(buffer);
+    device = nullptr;
+    buffer = 0;
+    mapping = nullptr;
+    staging = {};
+}
+
+void StreamBuffer::BeginFrame() {
+
+    frame_stats = StreamStats{};
+
+    if (mode == StreamMode::Persistent) {
+
+        region = (region + 1) % STREAM_FRAME_COUNT;
+
+        if (fences[region] && !device->IsFenceSignaled(fences[region])) {
+
+            frame_stats.stalls += 1;
+            device->WaitFence(fences[region]);
+        }
+
+        device->DeleteFence(fences[region]);
+        fences[region] = 0;
+    }
+    else if (cursor > 0) {
+
+        // earlier draws keep the old storage, this frame gets fresh storage
+        device->ReallocateBuffer(buffer, frame_capacity);
+    }
+
+    cursor = 0;
+    flushed = 0;
+}
+
+void StreamBuffer::EndFrame() {
+
+    Flush();
+
+    if (mode == StreamMode::Persistent && cursor > 0) {
+
+        fences[region] = device->InsertFence();
+    }
+}
+
+StreamAllocation StreamBuffer::Allocate(std::size_t size, std::size_t alignment) {
+
+    StreamAllocation allocation;
+
+    if (alignment == 0) {
+
+        frame_stats.failed_allocations += 1;
+        return allocation;
+    }
+
+    const std::size_t base = mode == StreamMode::Persistent ? region * frame_capacity : 0;
+
+    // align the offset into the buffer, not into this frame's region
+    const std::size_t unaligned = base + cursor;
+    const std::size_t offset = (unaligned + alignment - 1) / alignment * alignment;
+
+    if (offset + size > base + frame_capacity) {
+
+        frame_stats.failed_allocations += 1;
+        return allocation;
+    }
+
+    cursor = offset + size - base;
+
+    allocation.data = mode == StreamMode::Persistent ? mapping + offset : staging.data() + offset;
+    allocation.buffer = buffer;
+    allocation.offset = offset;
+    allocation.size = size;
+
+    frame_stats.allocations += 1;
+    frame_stats.bytes_allocated += size;
+
+    return allocation;
+}
+
+StreamAllocation StreamBuffer::AllocateVertices(std::size_t count, std::size_t stride) {
+
+    return Allocate(count * stride, stride);
+}
+
+void StreamBuffer::Flush() {
+
+    // mapped writes are coherent, only staged data has to be uploaded
+    if (mode == StreamMode::Orphaning && cursor > flushed) {
+
+        device->UploadBuffer(buffer, flushed, cursor - flushed, staging.data() + flushed);
+    }
+
+    flushed = cursor;
+}
+
+} // namespace Core
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: StreamBuffer.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "RenderDevice.hpp"
+
+#define STREAM_FRAME_COUNT  3   // frames of streamed data the GPU may still be reading
+
+namespace Core {
+
+enum class StreamMode : std::uint8_t {
+
+    Persistent,     // one mapped buffer split into STREAM_FRAME_COUNT regions
+    Orphaning       // one frame of storage, respecified every frame
+};
+
+const char* StreamModeName(StreamMode mode);
+
+// write-only range of this frame's stream, nullptr data when it did not fit
+struct StreamAllocation {
+
+    void* data = nullptr;
+    BufferId buffer = 0;
+    std::size_t offset = 0;         // bytes from the start of buffer
+    std::size_t size = 0;
+
+    explicit operator bool() const { return data != nullptr; }
+};
+
+struct StreamStats {
+
+    std::size_t allocations = 0;
+    std::size_t bytes_allocated = 0;
+    std::size_t failed_allocations = 0;     // did not fit in the frame's capacity, or zero alignment
+    std::size_t stalls = 0;                 // BeginFrame waited on the GPU
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Stream Buffer
+// --Ring of transient per-frame geometry: producers Allocate() ranges, write
+//   them directly and draw from them in the same frame.
+// --With mapped buffers (GL 4.4 or ARB_buffer_storage) the buffer is mapped
+//   once and each frame writes its own region; a fence per region keeps the
+//   CPU from overwriting a region the GPU is still reading. Nothing is
+//   copied by the driver and, unless the GPU is STREAM_FRAME_COUNT frames
+//   behind, nothing waits.
+// --On plain GL 3.3 allocations are staged in memory and Flush() uploads
+//   them; the buffer is orphaned at the start of each frame so the upload
+//   never waits for earlier draws.
+// --Offsets are aligned for AllocateVertices, so a vertex array pointing at
+//   Buffer() can address a range with DrawCall::base_vertex.
+////////////////////////////////////////////////////////////////////////////////
+class StreamBuffer {
+
+public:
+    // frame_capacity bytes may be allocated between BeginFrame and EndFrame
+    void Init(RenderDevice& device, BufferTarget target, std::size_t frame_capacity);
+    void Shutdown();
+
+    void BeginFrame();
+    void EndFrame();
+
+    // alignment need not be a power of two; zero fails the allocation (so
+    // does a zero stride)
+    StreamAllocation Allocate(std::size_t size, std::size_t alignment = 4);
+    StreamAllocation AllocateVertices(std::size_t count, std::size_t stride);
+
+    // makes every allocation so far visible to draws, call before drawing
+    void Flush();
+
+    StreamMode Mode() const { return mode; }
+    BufferId Buffer() const { return buffer; }
+    std::size_t FrameCapacity() const { return frame_capacity; }
+
+    const StreamStats& FrameStats() const { return frame_stats; }
+
+private:
+    RenderDevice* device = nullptr;
+    StreamMode mode = StreamMode::Orphaning;
+    BufferId buffer = 0;
+
+    std::size_t frame_capacity = 0;
+    std::size_t cursor = 0;         // bytes used in the current frame
+    std::size_t flushed = 0;        // bytes already uploaded this frame
+
+    // persistent: the mapping and the fence of each region's last frame
+    std::uint8_t* mapping = nullptr;
+    FenceId fences[STREAM_FRAME_COUNT] {};
+    unsigned int region = 0;
+
+    // orphaning: this frame's data until Flush
+    std::vector<std::uint8_t> staging;
+
+    StreamStats frame_stats;
+};
+
+} // namespace Core
@@ -0,0 +1,256 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: StreamBuffer.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "StreamBuffer.hpp"
+#include "RecordingRenderDevice.hpp"
+#include "UnitTest.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace Core;
+
+// a GPU that finishes a frame `latency` frames after it was submitted; when
+// it does, it checks the streamed bytes it read are still what was written
+class LaggingDevice : public RecordingRenderDevice {
+
+public:
+    explicit LaggingDevice(unsigned int frames_behind) : latency(frames_behind) {}
+
+    // the test's stand-in for a draw reading this range
+    void Read(const StreamAllocation& allocation, std::uint8_t value) {
+
+        reads.push_back(PendingRead{0, allocation.buffer, allocation.offset, allocation.size, value});
+    }
+
+    // called at the end of each frame, after the stream inserted its fence
+    void Present() {
+
+        for (PendingRead& read : reads) {
+
+            read.fence = read.fence ? read.fence : last_fence;
+        }
+
+        if (last_fence > latency) {
+
+            Complete(last_fence - latency);
+        }
+    }
+
+    std::size_t corrupted = 0;
+    std::size_t waits = 0;
+
+protected:
+    FenceId InsertFenceImpl() override {
+
+        last_fence = RecordingRenderDevice::InsertFenceImpl();
+        return last_fence;
+    }
+
+    bool IsFenceSignaledImpl(FenceId fence) override { return fence <= completed; }
+
+    void WaitFenceImpl(FenceId fence) override {
+
+        waits += 1;
+        Complete(fence);
+    }
+
+private:
+    struct PendingRead {
+
+        FenceId fence;
+        BufferId buffer;
+        std::size_t offset;
+        std::size_t size;
+        std::uint8_t value;
+    };
+
+    void Complete(FenceId fence) {
+
+        completed = fence > completed ? fence : completed;
+
+        std::vector<PendingRead> still_pending;
+
+        for (const PendingRead& read : reads) {
+
+            if (read.fence == 0 || read.fence > completed) {
+
+                still_pending.push_back(read);
+                continue;
+            }
+
+            const std::uint8_t* data = Buffer(read.buffer)->data.data() + read.offset;
+
+            for (std::size_t i = 0; i < read.size; ++i) {
+
+                corrupted += data[i] != read.value;
+            }
+        }
+
+        reads.swap(still_pending);
+    }
+
+    unsigned int latency;
+    FenceId last_fence = 0;
+    FenceId completed = 0;
+    std::vector<PendingRead> reads;
+};
+
+static std::size_t RunFrames(LaggingDevice& device, StreamBuffer& stream, int frames, std::size_t& stalls) {
+
+    std::size_t failed = 0;
+    stalls = 0;
+
+    for (int frame = 0; frame < frames; ++frame) {
+
+        stream.BeginFrame();
+
+        for (int draw = 0; draw < 3; ++draw) {
+
+            StreamAllocation allocation = stream.AllocateVertices(10, 8);
+
+            if (!allocation) {
+
+                failed += 1;
+                continue;
+            }
+
+            std::memset(allocation.data, frame + 1, allocation.size);
+            device.Read(allocation, static_cast<std::uint8_t>(frame + 1));
+        }
+
+        stream.EndFrame();
+        device.Present();
+
+        stalls += stream.FrameStats().stalls;
+    }
+
+    return failed;
+}
+
+TEST_CASE(PersistentRingNeverOverwritesFramesInFlight) {
+
+    // the GPU is as far behind as the ring allows: no waits
+    LaggingDevice device(STREAM_FRAME_COUNT - 1);
+
+    StreamBuffer stream;
+    stream.Init(device, BufferTarget::Vertex, 256);
+
+    CHECK(stream.Mode() == StreamMode::Persistent);
+
+    std::size_t stalls = 0;
+
+    CHECK(RunFrames(device, stream, 20, stalls) == 0);
+    CHECK(stalls == 0);
+    CHECK(device.waits == 0);
+    CHECK(device.corrupted == 0);
+
+    stream.Shutdown();
+}
+
+TEST_CASE(PersistentRingWaitsWhenTheGpuFallsBehind) {
+
+    LaggingDevice device(STREAM_FRAME_COUNT + 2);
+
+    StreamBuffer stream;
+    stream.Init(device, BufferTarget::Vertex, 256);
+
+    std::size_t stalls = 0;
+
+    CHECK(RunFrames(device, stream, 20, stalls) == 0);
+    CHECK(stalls == 20 - STREAM_FRAME_COUNT);
+    CHECK(device.waits == stalls);
+    CHECK(device.corrupted == 0);
+
+    // mapped writes need no uploads
+    CHECK(device.CountCommands(RenderCommandType::UploadBuffer) == 0);
+
+    stream.Shutdown();
+}
+
+TEST_CASE(AllocationsAreAlignedAndFitTheFrame) {
+
+    RecordingRenderDevice device;
+
+    StreamBuffer stream;
+    stream.Init(device, BufferTarget::Vertex, 96);
+
+    stream.BeginFrame();
+
+    StreamAllocation bytes = stream.Allocate(5);
+    StreamAllocation vertices = stream.AllocateVertices(3, 12);
+
+    CHECK(bytes && vertices);
+    CHECK(vertices.offset % 12 == 0);
+    CHECK(vertices.offset >= bytes.offset + bytes.size);
+    CHECK(vertices.buffer == stream.Buffer());
+
+    // the frame's region is the second third of the buffer
+    CHECK(bytes.offset == 96);
+
+    CHECK(!stream.Allocate(64));
+    CHECK(stream.FrameStats().failed_allocations == 1);
+
+    // a zero stride is rejected rather than dividing by zero
+    CHECK(!stream.AllocateVertices(2, 0));
+    CHECK(!stream.Allocate(4, 0));
+    CHECK(stream.FrameStats().failed_allocations == 3);
+    CHECK(stream.FrameStats().allocations == 2);
+    CHECK(stream.FrameStats().bytes_allocated == 5 + 36);
+
+    stream.EndFrame();
+
+    // a new frame starts empty
+    stream.BeginFrame();
+    CHECK(stream.Allocate(96));
+    CHECK(stream.FrameStats().failed_allocations == 0);
+
+    stream.Shutdown();
+}
+
+TEST_CASE(OrphaningStagesAndUploadsOncePerFlush) {
+
+    RecordingRenderDevice device;
+    device.SetPersistentMapping(false);
+
+    StreamBuffer stream;
+    stream.Init(device, BufferTarget::Vertex, 64);
+
+    CHECK(stream.Mode() == StreamMode::Orphaning);
+
+    device.BeginFrame();
+    stream.BeginFrame();
+
+    StreamAllocation first = stream.Allocate(8);
+    StreamAllocation second = stream.Allocate(8);
+    std::memset(first.data, 0xAB, 8);
+    std::memset(second.data, 0xCD, 8);
+
+    stream.Flush();
+    stream.EndFrame();
+
+    CHECK(device.CountCommands(RenderCommandType::UploadBuffer) == 1);
+    CHECK(device.CountCommands(RenderCommandType::InsertFence) == 0);
+    CHECK(device.Buffer(stream.Buffer())->data[0] == 0xAB);
+    CHECK(device.Buffer(stream.Buffer())->data[8] == 0xCD);
+
+    // the next frame respecifies the storage before writing again
+    device.BeginFrame();
+    stream.BeginFrame();
+
+    CHECK(device.CountCommands(RenderCommandType::ReallocateBuffer) == 1);
+    CHECK(stream.Allocate(8).offset == 0);
+
+    stream.EndFrame();
+
+    CHECK(device.CountCommands(RenderCommandType::UploadBuffer) == 1);
+
+    stream.Shutdown();
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: TransformKernels.bench.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "TransformKernels.hpp"
+#include "Benchmark.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace Core;
+
+#define ENTITY_COUNT    100000
+
+int main(int argc, char** argv) {
+
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : ENTITY_COUNT;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position_dist(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> rotation_dist(0.0f, 6.28f);
+    std::uniform_real_distribution<float> scale_dist(0.1f, 0.3f);
+
+    std::vector<float> position_x(count);
+    std::vector<float> position_y(count);
+    std::vector<float> rotation(count);
+    std::vector<float> scale_x(count);
+    std::vector<float> scale_y(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        position_x[i] = position_dist(rng);
+        position_y[i] = position_dist(rng);
+        rotation[i] = rotation_dist(rng);
+        scale_x[i] = scale_y[i] = scale_dist(rng);
+    }
+
+    std::cout << "Transform Size:\tmat4 " << sizeof(glm::mat4) << " bytes\t"
+              << "Affine2D " << sizeof(Affine2D) << " bytes" << std::endl;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Reference: per-entity glm 4x4 math, as the app did before Affine2D
+    ////////////////////////////////////////////////////////////////////////////
+    const glm::mat4 proj_mat = glm::ortho(-640.0f, 640.0f, -360.0f, 360.0f, -1.0f, 1.0f);
+    const glm::mat4 view_mat = glm::rotate(glm::mat4(1.0f), 0.3f, glm::vec3(0.0f, 0.0f, 1.0f));
+
+    std::vector<glm::mat4> mvp_mats(count);
+
+    Bench::Run("glm mat4 model-view-projection", count, [&]() {
+
+        for (std::size_t i = 0; i < count; ++i) {
+
+            glm::mat4 model_mat = glm::translate(glm::mat4(1.0f),
+                                                 glm::vec3(position_x[i], position_y[i], 0.0f));
+            model_mat = glm::rotate(model_mat, rotation[i], glm::vec3(0.0f, 0.0f, 1.0f));
+            model_mat = glm::scale(model_mat, glm::vec3(scale_x[i], scale_y[i], 1.0f));
+
+            mvp_mats[i] = proj_mat * view_mat * model_mat;
+        }
+
+        Bench::DoNotOptimize(mvp_mats.data());
+    });
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Affine2D batch kernels at every supported level
+    ////////////////////////////////////////////////////////////////////////////
+    const Affine2D view_proj = Affine2D::Ortho(-640.0f, 640.0f, -360.0f, 360.0f)
+                             * Affine2D::Rotation(0.3f);
+
+    std::vector<Affine2D> transforms(count);
+
+    Bench::Run("Affine2D scalar reference", count, [&]() {
+
+        TransformBatchScalar(view_proj, position_x.data(), position_y.data(), rotation.data(),
+                             scale_x.data(), scale_y.data(), count, transforms.data());
+
+        Bench::DoNotOptimize(transforms.data());
+    });
+
+    for (int level = 1; level <= static_cast<int>(DetectSimdLevel()); ++level) {
+
+        SetSimdLevel(static_cast<SimdLevel>(level));
+
+        const std::string name = std::string("Affine2D batch ") + SimdLevelName(ActiveSimdLevel());
+
+        Bench::Run(name.c_str(), count, [&]() {
+
+            TransformBatch(view_proj, position_x.data(), position_y.data(), rotation.data(),
+                           scale_x.data(), scale_y.data(), count, transforms.data());
+
+            Bench::DoNotOptimize(transforms.data());
+        });
+    }
+
+    return 0;
+}
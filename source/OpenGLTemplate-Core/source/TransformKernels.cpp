@@ -0,0 +1,365 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: TransformKernels.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "TransformKernels.hpp"
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define CORE_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#else
+    #define CORE_SIMD_X86 0
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Kernel Target Attributes
+// --Kernels are compiled for their instruction set per function, so the
+//   library itself builds with the default target and still runs on any CPU.
+////////////////////////////////////////////////////////////////////////////////
+#if defined(__GNUC__) || defined(__clang__)
+    #define CORE_TARGET_SSE2 __attribute__((target("sse2")))
+    #define CORE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define CORE_TARGET_SSE2
+    #define CORE_TARGET_AVX2
+#endif
+
+namespace Core {
+
+const char* SimdLevelName(SimdLevel level) {
+
+    switch(level) {
+        case(SimdLevel::SSE2):
+            return "SSE2";
+        case(SimdLevel::AVX2):
+            return "AVX2";
+        default:
+            return "Scalar";
+    }
+}
+
+SimdLevel DetectSimdLevel() {
+
+#if CORE_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+
+        return SimdLevel::AVX2;
+    }
+
+    if (__builtin_cpu_supports("sse2")) {
+
+        return SimdLevel::SSE2;
+    }
+#elif CORE_SIMD_X86 && defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 0);
+    const int max_leaf = info[0];
+
+    __cpuid(info, 1);
+    const bool has_sse2 = (info[3] & (1 << 26)) != 0;
+    const bool has_avx = (info[2] & (1 << 28)) != 0 && (info[2] & (1 << 27)) != 0;
+
+    // the OS must save the ymm registers for AVX to be usable
+    const bool os_saves_ymm = has_avx && (_xgetbv(0) & 0x6) == 0x6;
+
+    if (os_saves_ymm && max_leaf >= 7) {
+
+        __cpuidex(info, 7, 0);
+
+        if (info[1] & (1 << 5)) {
+
+            return SimdLevel::AVX2;
+        }
+    }
+
+    if (has_sse2) {
+
+        return SimdLevel::SSE2;
+    }
+#endif
+
+    return SimdLevel::Scalar;
+}
+
+static SimdLevel& ActiveLevel() {
+
+    static SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+SimdLevel ActiveSimdLevel() {
+
+    return ActiveLevel();
+}
+
+SimdLevel SetSimdLevel(SimdLevel level) {
+
+    const SimdLevel supported = DetectSimdLevel();
+
+    ActiveLevel() = static_cast<int>(level) <= static_cast<int>(supported) ? level : supported;
+    return ActiveLevel();
+}
+
+void TransformBatchScalar(const Affine2D& view_proj,
+                          const float* position_x, const float* position_y,
+                          const float* rotation,
+                          const float* scale_x, const float* scale_y,
+                          std::size_t count, Affine2D* out) {
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        out[i] = view_proj * Affine2D::FromTRS(position_x[i], position_y[i], rotation[i],
+                                               scale_x[i], scale_y[i]);
+    }
+}
+
+#if CORE_SIMD_X86
+
+////////////////////////////////////////////////////////////////////////////////
+// Polynomial Sine and Cosine
+// --Cody-Waite reduction to r in [-pi/4, pi/4] around the nearest multiple
+//   q of pi/2, then the Cephes single precision polynomials. The quadrant
+//   q selects whether sin/cos are swapped and which signs are flipped.
+////////////////////////////////////////////////////////////////////////////////
+#define SINCOS_TWO_OVER_PI  0.636619772367581343f
+#define SINCOS_PIO2_HI      1.5703125f
+#define SINCOS_PIO2_MID     4.837512969970703125e-4f
+#define SINCOS_PIO2_LO      7.54978995489188216e-8f
+
+#define SINCOS_S0   -1.9515295891e-4f
+#define SINCOS_S1    8.3321608736e-3f
+#define SINCOS_S2   -1.6666654611e-1f
+#define SINCOS_C0    2.443315711809948e-5f
+#define SINCOS_C1   -1.388731625493765e-3f
+#define SINCOS_C2    4.166664568298827e-2f
+
+CORE_TARGET_SSE2
+static inline void SinCos4(__m128 x, __m128& out_sin, __m128& out_cos) {
+
+    const __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(SINCOS_TWO_OVER_PI)));
+    const __m128 q = _mm_cvtepi32_ps(quadrant);
+
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(SINCOS_PIO2_HI)));
+    r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(SINCOS_PIO2_MID)));
+    r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(SINCOS_PIO2_LO)));
+
+    const __m128 z = _mm_mul_ps(r, r);
+
+    __m128 sin_r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SINCOS_S0), z), _mm_set1_ps(SINCOS_S1));
+    sin_r = _mm_add_ps(_mm_mul_ps(sin_r, z), _mm_set1_ps(SINCOS_S2));
+    sin_r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sin_r, z), r), r);
+
+    __m128 cos_r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SINCOS_C0), z), _mm_set1_ps(SINCOS_C1));
+    cos_r = _mm_add_ps(_mm_mul_ps(cos_r, z), _mm_set1_ps(SINCOS_C2));
+    cos_r = _mm_mul_ps(_mm_mul_ps(cos_r, z), z);
+    cos_r = _mm_add_ps(_mm_sub_ps(cos_r, _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.0f));
+
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+
+    const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+    const __m128 sin_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+    const __m128 cos_sign = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+
+    out_sin = _mm_or_ps(_mm_and_ps(swap, cos_r), _mm_andnot_ps(swap, sin_r));
+    out_cos = _mm_or_ps(_mm_and_ps(swap, sin_r), _mm_andnot_ps(swap, cos_r));
+
+    out_sin = _mm_xor_ps(out_sin, sin_sign);
+    out_cos = _mm_xor_ps(out_cos, cos_sign);
+}
+
+CORE_TARGET_AVX2
+static inline void SinCos8(__m256 x, __m256& out_sin, __m256& out_cos) {
+
+    const __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(SINCOS_TWO_OVER_PI)));
+    const __m256 q = _mm256_cvtepi32_ps(quadrant);
+
+    __m256 r = _mm256_sub_ps(x, _mm256_mul_ps(q, _mm256_set1_ps(SINCOS_PIO2_HI)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(q, _mm256_set1_ps(SINCOS_PIO2_MID)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(q, _mm256_set1_ps(SINCOS_PIO2_LO)));
+
+    const __m256 z = _mm256_mul_ps(r, r);
+
+    __m256 sin_r = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SINCOS_S0), z), _mm256_set1_ps(SINCOS_S1));
+    sin_r = _mm256_add_ps(_mm256_mul_ps(sin_r, z), _mm256_set1_ps(SINCOS_S2));
+    sin_r = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sin_r, z), r), r);
+
+    __m256 cos_r = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SINCOS_C0), z), _mm256_set1_ps(SINCOS_C1));
+    cos_r = _mm256_add_ps(_mm256_mul_ps(cos_r, z), _mm256_set1_ps(SINCOS_C2));
+    cos_r = _mm256_mul_ps(_mm256_mul_ps(cos_r, z), z);
+    cos_r = _mm256_add_ps(_mm256_sub_ps(cos_r, _mm256_mul_ps(_mm256_set1_ps(0.5f), z)),
+                          _mm256_set1_ps(1.0f));
+
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+
+    const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+    const __m256 sin_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+    const __m256 cos_sign = _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+
+    out_sin = _mm256_xor_ps(_mm256_blendv_ps(sin_r, cos_r, swap), sin_sign);
+    out_cos = _mm256_xor_ps(_mm256_blendv_ps(cos_r, sin_r, swap), cos_sign);
+}
+
+// transposes four transforms held as structure of arrays into 24 packed floats
+CORE_TARGET_SSE2
+static inline void StoreAffine4(__m128 a, __m128 b, __m128 c, __m128 d,
+                                __m128 tx, __m128 ty, Affine2D* out) {
+
+    _MM_TRANSPOSE4_PS(a, b, c, d);      // a..d now hold the linear parts of out[0..3]
+
+    const __m128 t01 = _mm_unpacklo_ps(tx, ty);
+    const __m128 t23 = _mm_unpackhi_ps(tx, ty);
+
+    float* dst = &out->a;
+
+    _mm_storeu_ps(dst +  0, a);
+    _mm_storeu_ps(dst +  4, _mm_movelh_ps(t01, b));
+    _mm_storeu_ps(dst +  8, _mm_movehl_ps(t01, b));
+    _mm_storeu_ps(dst + 12, c);
+    _mm_storeu_ps(dst + 16, _mm_movelh_ps(t23, d));
+    _mm_storeu_ps(dst + 20, _mm_movehl_ps(t23, d));
+}
+
+CORE_TARGET_SSE2
+static void TransformBatchSSE2(const Affine2D& vp,
+                               const float* position_x, const float* position_y,
+                               const float* rotation,
+                               const float* scale_x, const float* scale_y,
+                               std::size_t count, Affine2D* out) {
+
+    const __m128 va  = _mm_set1_ps(vp.a);
+    const __m128 vb  = _mm_set1_ps(vp.b);
+    const __m128 vc  = _mm_set1_ps(vp.c);
+    const __m128 vd  = _mm_set1_ps(vp.d);
+    const __m128 vtx = _mm_set1_ps(vp.tx);
+    const __m128 vty = _mm_set1_ps(vp.ty);
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+
+        __m128 sin_r;
+        __m128 cos_r;
+        SinCos4(_mm_loadu_ps(rotation + i), sin_r, cos_r);
+
+        const __m128 sx = _mm_loadu_ps(scale_x + i);
+        const __m128 sy = _mm_loadu_ps(scale_y + i);
+        const __m128 px = _mm_loadu_ps(position_x + i);
+        const __m128 py = _mm_loadu_ps(position_y + i);
+
+        // model = translate * rotate * scale
+        const __m128 ma = _mm_mul_ps(cos_r, sx);
+        const __m128 mb = _mm_mul_ps(sin_r, sx);
+        const __m128 mc = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(sin_r, sy));
+        const __m128 md = _mm_mul_ps(cos_r, sy);
+
+        // view_proj * model
+        StoreAffine4(_mm_add_ps(_mm_mul_ps(va, ma), _mm_mul_ps(vc, mb)),
+                     _mm_add_ps(_mm_mul_ps(vb, ma), _mm_mul_ps(vd, mb)),
+                     _mm_add_ps(_mm_mul_ps(va, mc), _mm_mul_ps(vc, md)),
+                     _mm_add_ps(_mm_mul_ps(vb, mc), _mm_mul_ps(vd, md)),
+                     _mm_add_ps(_mm_add_ps(_mm_mul_ps(va, px), _mm_mul_ps(vc, py)), vtx),
+                     _mm_add_ps(_mm_add_ps(_mm_mul_ps(vb, px), _mm_mul_ps(vd, py)), vty),
+                     out + i);
+    }
+
+    TransformBatchScalar(vp, position_x + i, position_y + i, rotation + i,
+                         scale_x + i, scale_y + i, count - i, out + i);
+}
+
+CORE_TARGET_AVX2
+static void TransformBatchAVX2(const Affine2D& vp,
+                               const float* position_x, const float* position_y,
+                               const float* rotation,
+                               const float* scale_x, const float* scale_y,
+                               std::size_t count, Affine2D* out) {
+
+    const __m256 va  = _mm256_set1_ps(vp.a);
+    const __m256 vb  = _mm256_set1_ps(vp.b);
+    const __m256 vc  = _mm256_set1_ps(vp.c);
+    const __m256 vd  = _mm256_set1_ps(vp.d);
+    const __m256 vtx = _mm256_set1_ps(vp.tx);
+    const __m256 vty = _mm256_set1_ps(vp.ty);
+
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+
+        __m256 sin_r;
+        __m256 cos_r;
+        SinCos8(_mm256_loadu_ps(rotation + i), sin_r, cos_r);
+
+        const __m256 sx = _mm256_loadu_ps(scale_x + i);
+        const __m256 sy = _mm256_loadu_ps(scale_y + i);
+        const __m256 px = _mm256_loadu_ps(position_x + i);
+        const __m256 py = _mm256_loadu_ps(position_y + i);
+
+        const __m256 ma = _mm256_mul_ps(cos_r, sx);
+        const __m256 mb = _mm256_mul_ps(sin_r, sx);
+        const __m256 mc = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(sin_r, sy));
+        const __m256 md = _mm256_mul_ps(cos_r, sy);
+
+        const __m256 oa  = _mm256_add_ps(_mm256_mul_ps(va, ma), _mm256_mul_ps(vc, mb));
+        const __m256 ob  = _mm256_add_ps(_mm256_mul_ps(vb, ma), _mm256_mul_ps(vd, mb));
+        const __m256 oc  = _mm256_add_ps(_mm256_mul_ps(va, mc), _mm256_mul_ps(vc, md));
+        const __m256 od  = _mm256_add_ps(_mm256_mul_ps(vb, mc), _mm256_mul_ps(vd, md));
+        const __m256 otx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(va, px), _mm256_mul_ps(vc, py)), vtx);
+        const __m256 oty = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vb, px), _mm256_mul_ps(vd, py)), vty);
+
+        StoreAffine4(_mm256_castps256_ps128(oa), _mm256_castps256_ps128(ob),
+                     _mm256_castps256_ps128(oc), _mm256_castps256_ps128(od),
+                     _mm256_castps256_ps128(otx), _mm256_castps256_ps128(oty),
+                     out + i);
+
+        StoreAffine4(_mm256_extractf128_ps(oa, 1), _mm256_extractf128_ps(ob, 1),
+                     _mm256_extractf128_ps(oc, 1), _mm256_extractf128_ps(od, 1),
+                     _mm256_extractf128_ps(otx, 1), _mm256_extractf128_ps(oty, 1),
+                     out + i + 4);
+    }
+
+    TransformBatchSSE2(vp, position_x + i, position_y + i, rotation + i,
+                       scale_x + i, scale_y + i, count - i, out + i);
+}
+
+#endif // CORE_SIMD_X86
+
+void TransformBatch(const Affine2D& view_proj,
+                    const float* position_x, const float* position_y,
+                    const float* rotation,
+                    const float* scale_x, const float* scale_y,
+                    std::size_t count, Affine2D* out) {
+
+    switch(ActiveLevel()) {
+#if CORE_SIMD_X86
+        case(SimdLevel::AVX2):
+            TransformBatchAVX2(view_proj, position_x, position_y, rotation,
+                               scale_x, scale_y, count, out);
+            return;
+        case(SimdLevel::SSE2):
+            TransformBatchSSE2(view_proj, position_x, position_y, rotation,
+                               scale_x, scale_y, count, out);
+            return;
+#endif
+        default:
+            TransformBatchScalar(view_proj, position_x, position_y, rotation,
+                                 scale_x, scale_y, count, out);
+            return;
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: TransformKernels.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+
+#include "Affine2D.hpp"
+
+namespace Core {
+
+enum class SimdLevel {
+
+    Scalar = 0,
+    SSE2,
+    AVX2
+};
+
+const char* SimdLevelName(SimdLevel level);
+
+// best level the running CPU supports, scalar on non-x86 targets
+SimdLevel DetectSimdLevel();
+
+// level used by TransformBatch(), defaults to DetectSimdLevel()
+SimdLevel ActiveSimdLevel();
+
+// forces a level (clamped to DetectSimdLevel()), returns the level in use
+SimdLevel SetSimdLevel(SimdLevel level);
+
+////////////////////////////////////////////////////////////////////////////////
+// Batch Transform Kernels
+// --Compose view_proj * translate * rotate * scale for count entities stored
+//   as structure of arrays (see EntityStore) into one Affine2D per entity.
+// --TransformBatch() dispatches to the SSE2/AVX2 kernel selected at runtime.
+//   The SIMD kernels use a polynomial sin/cos that stays within about 1e-6 of
+//   std::sin/std::cos for rotations within a few thousand radians.
+// --TransformBatchScalar() is the reference every SIMD kernel is tested
+//   against.
+////////////////////////////////////////////////////////////////////////////////
+void TransformBatch(const Affine2D& view_proj,
+                    const float* position_x, const float* position_y,
+                    const float* rotation,
+                    const float* scale_x, const float* scale_y,
+                    std::size_t count, Affine2D* out);
+
+void TransformBatchScalar(const Affine2D& view_proj,
+                          const float* position_x, const float* position_y,
+                          const float* rotation,
+                          const float* scale_x, const float* scale_y,
+                          std::size_t count, Affine2D* out);
+
+} // namespace Core
@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: TransformKernels.test.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "TransformKernels.hpp"
+#include "UnitTest.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+#define KERNEL_TOLERANCE    1e-4f   // relative to the magnitude of each value
+
+struct EntityArrays {
+
+    std::vector<float> position_x;
+    std::vector<float> position_y;
+    std::vector<float> rotation;
+    std::vector<float> scale_x;
+    std::vector<float> scale_y;
+};
+
+static EntityArrays RandomEntities(std::size_t count, float max_rotation) {
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position_dist(-2000.0f, 2000.0f);
+    std::uniform_real_distribution<float> rotation_dist(-max_rotation, max_rotation);
+    std::uniform_real_distribution<float> scale_dist(0.05f, 4.0f);
+
+    EntityArrays arrays;
+
+    for (std::size_t i = 0; i < count; ++i) {
+
+        arrays.position_x.push_back(position_dist(rng));
+        arrays.position_y.push_back(position_dist(rng));
+        arrays.rotation.push_back(rotation_dist(rng));
+        arrays.scale_x.push_back(scale_dist(rng));
+        arrays.scale_y.push_back(scale_dist(rng));
+    }
+
+    return arrays;
+}
+
+static bool Near(float a, float b) {
+
+    return std::fabs(a - b) <= KERNEL_TOLERANCE * std::fmax(1.0f, std::fabs(b));
+}
+
+// runs every supported kernel against the scalar reference
+static int CountMismatches(const Affine2D& view_proj, const EntityArrays& arrays, std::size_t count) {
+
+    std::vector<Affine2D> expected(count);
+    TransformBatchScalar(view_proj, arrays.position_x.data(), arrays.position_y.data(),
+                         arrays.rotation.data(), arrays.scale_x.data(), arrays.scale_y.data(),
+                         count, expected.data());
+
+    int mismatches = 0;
+
+    for (int level = 0; level <= static_cast<int>(DetectSimdLevel()); ++level) {
+
+        SetSimdLevel(static_cast<SimdLevel>(level));
+
+        std::vector<Affine2D> actual(count + 1);
+        actual[count].a = 123.0f;      // guard against writes past the end
+
+        TransformBatch(view_proj, arrays.position_x.data(), arrays.position_y.data(),
+                       arrays.rotation.data(), arrays.scale_x.data(), arrays.scale_y.data(),
+                       count, actual.data());
+
+        for (std::size_t i = 0; i < count; ++i) {
+
+            const Affine2D& e = expected[i];
+            const Affine2D& r = actual[i];
+
+            if (!Near(r.a, e.a) || !Near(r.b, e.b) || !Near(r.c, e.c) ||
+                !Near(r.d, e.d) || !Near(r.tx, e.tx) || !Near(r.ty, e.ty)) {
+
+                mismatches += 1;
+            }
+        }
+
+        if (actual[count].a != 123.0f) {
+
+            mismatches += 1;
+        }
+    }
+
+    SetSimdLevel(DetectSimdLevel());
+    return mismatches;
+}
+
+TEST_CASE(SetSimdLevelClampsToSupportedLevel) {
+
+    const SimdLevel detected = DetectSimdLevel();
+
+    CHECK(SetSimdLevel(SimdLevel::Scalar) == SimdLevel::Scalar);
+    CHECK(ActiveSimdLevel() == SimdLevel::Scalar);
+    CHECK(static_cast<int>(SetSimdLevel(SimdLevel::AVX2)) <= static_cast<int>(detected));
+    CHECK(ActiveSimdLevel() == detected);
+}
+
+TEST_CASE(KernelsMatchScalarReference) {
+
+    const Affine2D view_proj = Affine2D::Ortho(-640.0f, 640.0f, -360.0f, 360.0f)
+                             * Affine2D::Rotation(0.3f)
+                             * Affine2D::Scale(1.5f, 1.5f);
+
+    const EntityArrays arrays = RandomEntities(1000, 6.3f);
+
+    CHECK(CountMismatches(view_proj, arrays, 1000) == 0);
+}
+
+TEST_CASE(KernelsHandleCountsThatAreNotAMultipleOfTheWidth) {
+
+    const EntityArrays arrays = RandomEntities(32, 6.3f);
+
+    for (std::size_t count = 0; count <= 17; ++count) {
+
+        CHECK(CountMismatches(Affine2D::Identity(), arrays, count) == 0);
+    }
+}
+
+TEST_CASE(KernelsHandleLargeAccumulatedRotations) {
+
+    // the user model's rotation accumulates without wrapping
+    const EntityArrays arrays = RandomEntities(256, 2000.0f);
+
+    CHECK(CountMismatches(Affine2D::Identity(), arrays, 256) == 0);
+}
+
+TEST_CASE(KernelsHitExactQuadrantAngles) {
+
+    EntityArrays arrays;
+
+    for (int k = -8; k <= 8; ++k) {
+
+        arrays.position_x.push_back(0.0f);
+        arrays.position_y.push_back(0.0f);
+        arrays.rotation.push_back(k * 0.785398163f);
+        arrays.scale_x.push_back(1.0f);
+        arrays.scale_y.push_back(1.0f);
+    }
+
+    CHECK(CountMismatches(Affine2D::Identity(), arrays, arrays.rotation.size()) == 0);
+}
+
+int main() { return Core::Test::RunAll(); }
@@ -0,0 +1,37 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: UniformBuffer.cpp
+////////////////////////////////////////////////////////////////////////////////
+#include "UniformBuffer.hpp"
+
+namespace Core {
+
+void UniformBuffer::Create(RenderDevice& target, std::size_t size, unsigned int binding) {
+
+    device = &target;
+    binding_point = binding;
+
+    ubo = device->CreateBuffer(BufferTarget::Uniform, size, nullptr, BufferUsage::Dynamic);
+    device->BindUniformBuffer(ubo, binding_point);
+}
+
+void UniformBuffer::Destroy() {
+
+    if (device) {
+
+        device->DestroyBuffer(ubo);
+    }
+
+    ubo = 0;
+}
+
+void UniformBuffer::Update(const void* data, std::size_t size, std::size_t offset) const {
+
+    device->UploadBuffer(ubo, offset, size, data);
+}
+
+} // namespace Core
@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: UniformBuffer.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+
+#include "RenderDevice.hpp"
+
+namespace Core {
+
+////////////////////////////////////////////////////////////////////////////////
+// Uniform Buffer
+// --Device uniform buffer bound once to a fixed binding point.
+////////////////////////////////////////////////////////////////////////////////
+class UniformBuffer {
+
+public:
+    void Create(RenderDevice& device, std::size_t size, unsigned int binding);
+    void Destroy();
+
+    void Update(const void* data, std::size_t size, std::size_t offset = 0) const;
+
+    unsigned int Binding() const { return binding_point; }
+    BufferId Buffer() const { return ubo; }
+
+private:
+    RenderDevice* device = nullptr;
+    BufferId ubo{};
+    unsigned int binding_point{};
+};
+
+} // namespace Core
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// organization: Bocan Online Templates
+// author: Matthew Buchanan
+// 
+// license: The Unlicense
+// project: cpp-opengl-glfw-glad-cmake
+// file: UnitTest.hpp
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Minimal Unit Test Harness
+// --Each *.test.cpp registers cases with TEST_CASE and ends with
+//   int main() { return Core::Test::RunAll(); }
+// --Checks stay active in release builds (no dependency on assert/NDEBUG).
+////////////////////////////////////////////////////////////////////////////////
+namespace Core::Test {
+
+using TestFunction = void (*)();
+
+struct TestCase {
+
+    const char* name;
+    TestFunction function;
+};
+
+inline std::vector<TestCase>& Registry() {
+
+    static std::vector<TestCase> registry;
+    return registry;
+}
+
+inline int& FailureCount() {
+
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+
+    Registrar(const char* name, TestFunction function) {
+
+        Registry().push_back(TestCase{name, function});
+    }
+};
+
+inline void ReportFailure(const char* file, int line, const char* expression) {
+
+    std::cerr << file << ":" << line << ": CHECK failed: " << expression << std::endl;
+    FailureCount() += 1;
+}
+
+inline int RunAll() {
+
+    for (const auto& test : Registry()) {
+
+        const int failures_before = FailureCount();
+        test.function();
+
+        std::cout << (FailureCount() == failures_before ? "[PASS] " : "[FAIL] ")
+                  << test.name << std::endl;
+    }
+
+    std::cout << Registry().size() << " tests, " << FailureCount() << " failed checks" << std::endl;
+
+    return FailureCount() == 0 ? 0 : 1;
+}
+
+} // namespace Core::Test
+
+#define TEST_CASE(name)                                                     \
+    static void name();                                                     \
+    static const Core::Test::Registrar name##_registrar(#name, name);       \
+    static void name()
+
+#define CHECK(expression)                                                   \
+    do {                                                                    \
+        if (!(expression)) {                                                \
+            Core::Test::ReportFailure(__FILE__, __LINE__, #expression);     \
+        }                                                                   \
+    } while (0)
+
+#define CHECK_NEAR(a, b, tolerance)                                         \
+    CHECK(std::fabs(static_cast<double>(a) - static_cast<double>(b))        \
+          <= static_cast<double>(tolerance))